@@ -11,6 +11,7 @@
 
 #include "op.h"
 #include "search_result.h"
+#include "util/cancellation_token.h"
 
 namespace Acoustid {
 
@@ -20,7 +21,8 @@ class BaseIndex {
     virtual ~BaseIndex() {}
 
     virtual bool containsDocument(uint32_t docId) = 0;
-    virtual std::vector<SearchResult> search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs) = 0;
+    virtual std::vector<SearchResult> search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs,
+                                             CancellationTokenSharedPtr cancellation) = 0;
 
     virtual bool hasAttribute(const QString &name) = 0;
     virtual QString getAttribute(const QString &name) = 0;
@@ -0,0 +1,132 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "block_cache.h"
+
+#include <QHash>
+#include <QMutex>
+#include <list>
+
+namespace Acoustid {
+
+struct BlockCache::Shard {
+    struct Entry {
+        uint64_t key;
+        BlockDataSharedPtr data;
+        size_t size;
+    };
+
+    QMutex mutex;
+    // Most recently used entries are at the front.
+    std::list<Entry> entries;
+    QHash<quint64, std::list<Entry>::iterator> index;
+    size_t size = 0;
+};
+
+static inline uint64_t makeKey(int segmentId, size_t block) { return (uint64_t(uint32_t(segmentId)) << 32) | block; }
+
+static inline int segmentIdFromKey(uint64_t key) { return int(key >> 32); }
+
+BlockCache::BlockCache(size_t maxSize) : m_shards(new Shard[NUM_SHARDS]), m_maxSize(maxSize) {}
+
+BlockCache::~BlockCache() {}
+
+size_t BlockCache::maxSize() const { return m_maxSize.load(); }
+
+void BlockCache::setMaxSize(size_t maxSize) {
+    m_maxSize.store(maxSize);
+    for (int i = 0; i < NUM_SHARDS; i++) {
+        auto &shard = m_shards[i];
+        QMutexLocker locker(&shard.mutex);
+        evict(shard, maxSize / NUM_SHARDS);
+    }
+}
+
+size_t BlockCache::size() const {
+    size_t size = 0;
+    for (int i = 0; i < NUM_SHARDS; i++) {
+        auto &shard = m_shards[i];
+        QMutexLocker locker(&shard.mutex);
+        size += shard.size;
+    }
+    return size;
+}
+
+BlockCache::Shard &BlockCache::shard(uint64_t key) {
+    // Neighbouring blocks of the same segment should end up in different shards.
+    return m_shards[(key * UINT64_C(0x9E3779B97F4A7C15)) >> 60];
+}
+
+BlockDataSharedPtr BlockCache::get(int segmentId, size_t block) {
+    auto key = makeKey(segmentId, block);
+    auto &shard = this->shard(key);
+    QMutexLocker locker(&shard.mutex);
+    auto it = shard.index.constFind(key);
+    if (it == shard.index.constEnd()) {
+        m_missCount.fetchAndAddRelaxed(1);
+        return BlockDataSharedPtr();
+    }
+    auto entry = it.value();
+    shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+    m_hitCount.fetchAndAddRelaxed(1);
+    return entry->data;
+}
+
+void BlockCache::insert(int segmentId, size_t block, const BlockDataSharedPtr &data) {
+    auto maxShardSize = maxSize() / NUM_SHARDS;
+    auto size = data->memoryUsage();
+    if (size > maxShardSize) {
+        return;
+    }
+    auto key = makeKey(segmentId, block);
+    auto &shard = this->shard(key);
+    QMutexLocker locker(&shard.mutex);
+    auto it = shard.index.constFind(key);
+    if (it != shard.index.constEnd()) {
+        // Another search decoded the same block at the same time.
+        return;
+    }
+    evict(shard, maxShardSize - size);
+    shard.entries.push_front(Shard::Entry{key, data, size});
+    shard.index.insert(key, shard.entries.begin());
+    shard.size += size;
+}
+
+void BlockCache::evict(Shard &shard, size_t maxSize) {
+    while (shard.size > maxSize && !shard.entries.empty()) {
+        const auto &entry = shard.entries.back();
+        shard.size -= entry.size;
+        shard.index.remove(entry.key);
+        shard.entries.pop_back();
+        m_evictionCount.fetchAndAddRelaxed(1);
+    }
+}
+
+void BlockCache::invalidateSegment(int segmentId) {
+    for (int i = 0; i < NUM_SHARDS; i++) {
+        auto &shard = m_shards[i];
+        QMutexLocker locker(&shard.mutex);
+        auto it = shard.entries.begin();
+        while (it != shard.entries.end()) {
+            if (segmentIdFromKey(it->key) == segmentId) {
+                shard.size -= it->size;
+                shard.index.remove(it->key);
+                it = shard.entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void BlockCache::clear() {
+    for (int i = 0; i < NUM_SHARDS; i++) {
+        auto &shard = m_shards[i];
+        QMutexLocker locker(&shard.mutex);
+        shard.entries.clear();
+        shard.index.clear();
+        shard.size = 0;
+    }
+}
+
+}  // namespace Acoustid
@@ -0,0 +1,68 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_BLOCK_CACHE_H_
+#define ACOUSTID_INDEX_BLOCK_CACHE_H_
+
+#include <QAtomicInteger>
+#include <QSharedPointer>
+
+#include "common.h"
+#include "segment_data_reader.h"
+
+namespace Acoustid {
+
+// Cache of decoded data blocks, shared by all searches on one index.
+//
+// Blocks are identified by segment ID and block number. The cache is split
+// into shards, each with its own lock and LRU list, so that concurrent
+// searches don't fight over a single mutex. The memory budget is divided
+// equally between the shards. A cache with zero size is disabled.
+class BlockCache {
+ public:
+    BlockCache(size_t maxSize = 0);
+    ~BlockCache();
+
+    bool isEnabled() const { return maxSize() > 0; }
+
+    // Memory budget in bytes.
+    size_t maxSize() const;
+    void setMaxSize(size_t maxSize);
+
+    // Memory currently used by cached blocks, in bytes.
+    size_t size() const;
+
+    BlockDataSharedPtr get(int segmentId, size_t block);
+    void insert(int segmentId, size_t block, const BlockDataSharedPtr &data);
+
+    // Remove all blocks belonging to the segment.
+    void invalidateSegment(int segmentId);
+
+    void clear();
+
+    uint64_t hitCount() const { return m_hitCount.load(); }
+    uint64_t missCount() const { return m_missCount.load(); }
+    uint64_t evictionCount() const { return m_evictionCount.load(); }
+
+ private:
+    ACOUSTID_DISABLE_COPY(BlockCache)
+
+    struct Shard;
+
+    static const int NUM_SHARDS = 16;
+
+    Shard &shard(uint64_t key);
+    void evict(Shard &shard, size_t maxSize);
+
+    std::unique_ptr<Shard[]> m_shards;
+    QAtomicInteger<quint64> m_maxSize;
+    QAtomicInteger<quint64> m_hitCount;
+    QAtomicInteger<quint64> m_missCount;
+    QAtomicInteger<quint64> m_evictionCount;
+};
+
+typedef QSharedPointer<BlockCache> BlockCacheSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_BLOCK_CACHE_H_
@@ -0,0 +1,74 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "block_cache.h"
+
+using namespace Acoustid;
+
+static BlockDataSharedPtr makeBlock(uint32_t firstKey, size_t length) {
+    std::vector<uint32_t> items(length * 2 - 1, 1);
+    auto block = QSharedPointer<BlockData>::create();
+    block->assign(items.data(), length, firstKey);
+    return block;
+}
+
+TEST(BlockCacheTest, Disabled) {
+    BlockCache cache;
+    ASSERT_FALSE(cache.isEnabled());
+    cache.insert(1, 0, makeBlock(100, 10));
+    ASSERT_TRUE(cache.get(1, 0).isNull());
+    ASSERT_EQ(0, cache.size());
+}
+
+TEST(BlockCacheTest, GetAndInsert) {
+    BlockCache cache(1024 * 1024);
+    ASSERT_TRUE(cache.isEnabled());
+    ASSERT_TRUE(cache.get(1, 0).isNull());
+    ASSERT_EQ(1, cache.missCount());
+
+    auto block = makeBlock(100, 10);
+    cache.insert(1, 0, block);
+    ASSERT_EQ(block->memoryUsage(), cache.size());
+
+    auto cachedBlock = cache.get(1, 0);
+    ASSERT_EQ(block.data(), cachedBlock.data());
+    ASSERT_EQ(100, cachedBlock->key(0));
+    ASSERT_EQ(1, cache.hitCount());
+
+    ASSERT_TRUE(cache.get(2, 0).isNull());
+    ASSERT_TRUE(cache.get(1, 1).isNull());
+    ASSERT_EQ(3, cache.missCount());
+}
+
+TEST(BlockCacheTest, Eviction) {
+    auto blockSize = makeBlock(0, 100)->memoryUsage();
+    // Room for a few blocks in each shard.
+    BlockCache cache(blockSize * 16 * 4);
+    for (size_t i = 0; i < 1000; i++) {
+        cache.insert(1, i, makeBlock(i, 100));
+    }
+    ASSERT_LE(cache.size(), cache.maxSize());
+    ASSERT_LT(0, cache.evictionCount());
+
+    // The most recently inserted block is still there.
+    ASSERT_FALSE(cache.get(1, 999).isNull());
+
+    cache.setMaxSize(0);
+    ASSERT_EQ(0, cache.size());
+}
+
+TEST(BlockCacheTest, InvalidateSegment) {
+    BlockCache cache(1024 * 1024);
+    for (size_t i = 0; i < 10; i++) {
+        cache.insert(1, i, makeBlock(i, 10));
+        cache.insert(2, i, makeBlock(i, 10));
+    }
+    cache.invalidateSegment(1);
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(cache.get(1, i).isNull());
+        ASSERT_FALSE(cache.get(2, i).isNull());
+    }
+    ASSERT_EQ(makeBlock(0, 10)->memoryUsage() * 10, cache.size());
+}
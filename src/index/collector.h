@@ -4,6 +4,7 @@
 #ifndef ACOUSTID_INDEX_COLLECTOR_H_
 #define ACOUSTID_INDEX_COLLECTOR_H_
 
+#include <vector>
 #include "common.h"
 
 namespace Acoustid {
@@ -13,6 +14,42 @@ class Collector
 public:
 	virtual ~Collector() {}
 	virtual void collect(uint32_t id) = 0;
+
+	// Collect all the ids, used to pass all documents matching one term at once.
+	virtual void collectMany(const uint32_t *ids, size_t count)
+	{
+		for (size_t i = 0; i < count; i++) {
+			collect(ids[i]);
+		}
+	}
+
+	// Collect the same id multiple times, used when merging partial results.
+	virtual void collectCount(uint32_t id, unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; i++) {
+			collect(id);
+		}
+	}
+
+	// Collect the id only if it was already collected before. Used once new
+	// documents can no longer reach minCompetitiveScore().
+	virtual void collectExisting(uint32_t id)
+	{
+		collect(id);
+	}
+
+	// Documents whose final score is lower than this can't change the results.
+	virtual unsigned int minCompetitiveScore()
+	{
+		return 0;
+	}
+
+	// Append the collected documents with at least minScore hits to ids, in no particular
+	// order. Returns false if the collector can't tell, then any document might matter.
+	virtual bool competitiveDocuments(unsigned int minScore, std::vector<uint32_t> *ids)
+	{
+		return false;
+	}
 };
 
 }
@@ -0,0 +1,37 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "document_filter.h"
+
+namespace Acoustid {
+
+DocumentFilter::DocumentFilter(uint32_t minId, uint32_t maxId, const QByteArray &bitmap)
+    : m_minId(minId), m_maxId(maxId), m_bitmap(bitmap) {
+    if (!m_bitmap.isEmpty()) {
+        // Keep the range within the bitmap, so that contains() doesn't need to check its size.
+        uint64_t lastBitmapId = uint64_t(m_minId) + uint64_t(m_bitmap.size()) * 8 - 1;
+        if (lastBitmapId < m_maxId) {
+            m_maxId = lastBitmapId;
+        }
+    }
+}
+
+void DocumentFilterCollector::collectMany(const uint32_t *ids, size_t count) {
+    // Filter in chunks, so that the target still gets whole batches.
+    const size_t CHUNK_SIZE = 256;
+    uint32_t chunk[CHUNK_SIZE];
+    size_t chunkSize = 0;
+    for (size_t i = 0; i < count; i++) {
+        chunk[chunkSize] = ids[i];
+        chunkSize += m_filter->contains(ids[i]);
+        if (chunkSize == CHUNK_SIZE) {
+            m_target->collectMany(chunk, chunkSize);
+            chunkSize = 0;
+        }
+    }
+    if (chunkSize > 0) {
+        m_target->collectMany(chunk, chunkSize);
+    }
+}
+
+}  // namespace Acoustid
@@ -0,0 +1,90 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_DOCUMENT_FILTER_H_
+#define ACOUSTID_INDEX_DOCUMENT_FILTER_H_
+
+#include <QByteArray>
+#include <QSharedPointer>
+
+#include "collector.h"
+#include "common.h"
+
+namespace Acoustid {
+
+// Restricts searches to a subset of documents.
+//
+// The documents are the ids in [minId, maxId], and if there is a bitmap,
+// only those with their bit set. Bit i of the bitmap (byte i / 8, bit i % 8)
+// stands for document minId + i, documents past the end of the bitmap are
+// excluded. An empty bitmap means no bitmap.
+class DocumentFilter {
+ public:
+    DocumentFilter(uint32_t minId = 0, uint32_t maxId = UINT32_MAX, const QByteArray &bitmap = QByteArray());
+
+    uint32_t minId() const { return m_minId; }
+    uint32_t maxId() const { return m_maxId; }
+    const QByteArray &bitmap() const { return m_bitmap; }
+
+    // Returns true if the filter doesn't exclude any document.
+    bool matchesAll() const { return m_minId == 0 && m_maxId == UINT32_MAX && m_bitmap.isEmpty(); }
+
+    bool contains(uint32_t id) const {
+        if (id < m_minId || id > m_maxId) {
+            return false;
+        }
+        if (m_bitmap.isEmpty()) {
+            return true;
+        }
+        uint32_t bit = id - m_minId;
+        return (uint8_t(m_bitmap.constData()[bit >> 3]) >> (bit & 7)) & 1;
+    }
+
+ private:
+    uint32_t m_minId;
+    uint32_t m_maxId;
+    QByteArray m_bitmap;
+};
+
+typedef QSharedPointer<DocumentFilter> DocumentFilterSharedPtr;
+
+// Passes only the hits of documents matching the filter to the target collector,
+// so the other documents never take space in it.
+class DocumentFilterCollector : public Collector {
+ public:
+    DocumentFilterCollector(Collector *target, const DocumentFilter *filter) : m_target(target), m_filter(filter) {}
+
+    void collect(uint32_t id) override {
+        if (m_filter->contains(id)) {
+            m_target->collect(id);
+        }
+    }
+
+    void collectMany(const uint32_t *ids, size_t count) override;
+
+    void collectCount(uint32_t id, unsigned int count) override {
+        if (m_filter->contains(id)) {
+            m_target->collectCount(id, count);
+        }
+    }
+
+    void collectExisting(uint32_t id) override {
+        if (m_filter->contains(id)) {
+            m_target->collectExisting(id);
+        }
+    }
+
+    unsigned int minCompetitiveScore() override { return m_target->minCompetitiveScore(); }
+
+    bool competitiveDocuments(unsigned int minScore, std::vector<uint32_t> *ids) override {
+        return m_target->competitiveDocuments(minScore, ids);
+    }
+
+ private:
+    Collector *m_target;
+    const DocumentFilter *m_filter;
+};
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_DOCUMENT_FILTER_H_
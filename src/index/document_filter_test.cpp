@@ -0,0 +1,71 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "document_filter.h"
+#include "top_hits_collector.h"
+
+using namespace Acoustid;
+
+TEST(DocumentFilterTest, Range) {
+    DocumentFilter all;
+    ASSERT_TRUE(all.matchesAll());
+    ASSERT_TRUE(all.contains(0));
+    ASSERT_TRUE(all.contains(UINT32_MAX));
+
+    DocumentFilter filter(10, 20);
+    ASSERT_FALSE(filter.matchesAll());
+    ASSERT_FALSE(filter.contains(9));
+    ASSERT_TRUE(filter.contains(10));
+    ASSERT_TRUE(filter.contains(20));
+    ASSERT_FALSE(filter.contains(21));
+}
+
+TEST(DocumentFilterTest, Bitmap) {
+    // Documents 100, 102, 108 and 115.
+    QByteArray bitmap("\x05\x81", 2);
+    DocumentFilter filter(100, UINT32_MAX, bitmap);
+    ASSERT_EQ(115, filter.maxId());
+    std::vector<uint32_t> ids;
+    for (uint32_t id = 0; id < 1000; id++) {
+        if (filter.contains(id)) {
+            ids.push_back(id);
+        }
+    }
+    ASSERT_EQ(std::vector<uint32_t>({100, 102, 108, 115}), ids);
+
+    // The range can exclude a part of the bitmap.
+    DocumentFilter narrow(100, 110, bitmap);
+    ASSERT_EQ(110, narrow.maxId());
+    ASSERT_TRUE(narrow.contains(108));
+    ASSERT_FALSE(narrow.contains(115));
+
+    // The bitmap can't reach past the last document ID.
+    DocumentFilter last(UINT32_MAX - 1, UINT32_MAX, QByteArray("\x02", 1));
+    ASSERT_FALSE(last.contains(UINT32_MAX - 1));
+    ASSERT_TRUE(last.contains(UINT32_MAX));
+}
+
+TEST(DocumentFilterTest, Collector) {
+    DocumentFilter filter(2, 3);
+    TopHitsCollector target(10);
+    DocumentFilterCollector collector(&target, &filter);
+
+    std::vector<uint32_t> ids(1000, 2);
+    ids.push_back(1);
+    ids.push_back(3);
+    collector.collectMany(ids.data(), ids.size());
+    collector.collect(4);
+    collector.collectCount(3, 2);
+    collector.collectCount(5, 2);
+    collector.collectExisting(2);
+    collector.collectExisting(1);
+
+    QList<Result> results = target.topResults();
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(2, results[0].id());
+    ASSERT_EQ(1001, results[0].score());
+    ASSERT_EQ(3, results[1].id());
+    ASSERT_EQ(3, results[1].score());
+}
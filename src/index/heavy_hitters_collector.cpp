@@ -0,0 +1,213 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "heavy_hitters_collector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Acoustid {
+
+HeavyHittersCollector::HeavyHittersCollector(size_t numHits, int topScorePercent, double maxError)
+    : m_numHits(numHits), m_topScorePercent(topScorePercent), m_maxError(maxError), m_capacity(capacityFor(numHits, maxError)),
+      m_totalCount(0) {
+    // Keep the hash table at most half full.
+    int bits = 4;
+    while ((size_t(1) << bits) < m_capacity * 2) {
+        bits++;
+    }
+    m_table.assign(size_t(1) << bits, EMPTY_SLOT);
+    m_mask = m_table.size() - 1;
+    m_shift = 32 - bits;
+    m_heap.reserve(m_capacity);
+}
+
+HeavyHittersCollector::~HeavyHittersCollector() {}
+
+size_t HeavyHittersCollector::capacityFor(size_t numHits, double maxError) {
+    size_t capacity = maxError > 0 ? size_t(std::min(std::ceil(1.0 / maxError), double(MAX_CAPACITY))) : MAX_CAPACITY;
+    return std::min(MAX_CAPACITY, std::max({capacity, numHits, size_t(1)}));
+}
+
+void HeavyHittersCollector::collectMany(const uint32_t *ids, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        add(ids[i], 1);
+    }
+}
+
+void HeavyHittersCollector::collectCount(uint32_t id, unsigned int count) {
+    if (count > 0) {
+        add(id, count);
+    }
+}
+
+void HeavyHittersCollector::collectExisting(uint32_t id) {
+    uint32_t pos = m_table[findSlot(id)];
+    if (pos != EMPTY_SLOT) {
+        m_totalCount++;
+        m_heap[pos].count++;
+        siftDown(pos);
+    }
+}
+
+void HeavyHittersCollector::add(uint32_t id, uint32_t count) {
+    m_totalCount += count;
+    size_t slot = findSlot(id);
+    uint32_t pos = m_table[slot];
+    if (pos != EMPTY_SLOT) {
+        m_heap[pos].count += count;
+        siftDown(pos);
+        return;
+    }
+    if (m_heap.size() < m_capacity) {
+        m_table[slot] = m_heap.size();
+        m_heap.push_back(Entry{id, count, 0, uint32_t(slot)});
+        siftUp(m_heap.size() - 1);
+        return;
+    }
+    // Replace the document with the lowest count, its count becomes the new document's error.
+    Entry &min = m_heap[0];
+    removeSlot(min.slot);
+    // Removing the old ID can shift the following slots, so look for the new one's slot again.
+    slot = findSlot(id);
+    m_table[slot] = 0;
+    min.id = id;
+    min.error = min.count;
+    min.count += count;
+    min.slot = slot;
+    siftDown(0);
+}
+
+size_t HeavyHittersCollector::findSlot(uint32_t id) const {
+    size_t slot = homeSlot(id);
+    while (m_table[slot] != EMPTY_SLOT && m_heap[m_table[slot]].id != id) {
+        slot = (slot + 1) & m_mask;
+    }
+    return slot;
+}
+
+void HeavyHittersCollector::removeSlot(size_t slot) {
+    // Shift the following entries back, so that no probe sequence has a hole in it.
+    size_t hole = slot;
+    size_t next = (hole + 1) & m_mask;
+    while (m_table[next] != EMPTY_SLOT) {
+        size_t home = homeSlot(m_heap[m_table[next]].id);
+        if (((next - home) & m_mask) >= ((next - hole) & m_mask)) {
+            m_table[hole] = m_table[next];
+            m_heap[m_table[hole]].slot = hole;
+            hole = next;
+        }
+        next = (next + 1) & m_mask;
+    }
+    m_table[hole] = EMPTY_SLOT;
+}
+
+void HeavyHittersCollector::siftUp(size_t pos) {
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (m_heap[parent].count <= m_heap[pos].count) {
+            return;
+        }
+        swapEntries(pos, parent);
+        pos = parent;
+    }
+}
+
+void HeavyHittersCollector::siftDown(size_t pos) {
+    size_t size = m_heap.size();
+    while (true) {
+        size_t smallest = pos;
+        size_t left = 2 * pos + 1, right = left + 1;
+        if (left < size && m_heap[left].count < m_heap[smallest].count) {
+            smallest = left;
+        }
+        if (right < size && m_heap[right].count < m_heap[smallest].count) {
+            smallest = right;
+        }
+        if (smallest == pos) {
+            return;
+        }
+        swapEntries(pos, smallest);
+        pos = smallest;
+    }
+}
+
+void HeavyHittersCollector::swapEntries(size_t a, size_t b) {
+    std::swap(m_heap[a], m_heap[b]);
+    m_table[m_heap[a].slot] = a;
+    m_table[m_heap[b].slot] = b;
+}
+
+void HeavyHittersCollector::clear() {
+    m_heap.clear();
+    std::fill(m_table.begin(), m_table.end(), EMPTY_SLOT);
+    m_totalCount = 0;
+}
+
+void HeavyHittersCollector::merge(const HeavyHittersCollector &other) {
+    // A document a full collector doesn't track might have had up to its lowest count.
+    uint32_t minCount = m_heap.size() < m_capacity ? 0 : m_heap[0].count;
+    uint32_t otherMinCount = other.m_heap.size() < other.m_capacity ? 0 : other.m_heap[0].count;
+
+    std::vector<Entry> entries;
+    entries.reserve(m_heap.size() + other.m_heap.size());
+    for (const auto &entry : m_heap) {
+        uint32_t pos = other.m_table[other.findSlot(entry.id)];
+        if (pos != EMPTY_SLOT) {
+            const Entry &otherEntry = other.m_heap[pos];
+            entries.push_back(Entry{entry.id, entry.count + otherEntry.count, entry.error + otherEntry.error, 0});
+        } else {
+            entries.push_back(Entry{entry.id, entry.count + otherMinCount, entry.error + otherMinCount, 0});
+        }
+    }
+    for (const auto &entry : other.m_heap) {
+        if (m_table[findSlot(entry.id)] == EMPTY_SLOT) {
+            entries.push_back(Entry{entry.id, entry.count + minCount, entry.error + minCount, 0});
+        }
+    }
+
+    // Keep the documents with the most hits, in a min-heap with a fresh hash table.
+    auto moreHits = [](const Entry &a, const Entry &b) { return a.count > b.count; };
+    if (entries.size() > m_capacity) {
+        std::nth_element(entries.begin(), entries.begin() + m_capacity, entries.end(), moreHits);
+        entries.resize(m_capacity);
+    }
+    std::make_heap(entries.begin(), entries.end(), moreHits);
+    std::fill(m_table.begin(), m_table.end(), EMPTY_SLOT);
+    m_heap.swap(entries);
+    for (size_t pos = 0; pos < m_heap.size(); pos++) {
+        size_t slot = findSlot(m_heap[pos].id);
+        m_table[slot] = pos;
+        m_heap[pos].slot = slot;
+    }
+    m_totalCount += other.m_totalCount;
+}
+
+QList<Result> HeavyHittersCollector::topResults() {
+    QList<Result> results;
+    if (m_heap.empty() || m_numHits == 0) {
+        return results;
+    }
+    // Documents that took over a slot late have a large error, ranking them by
+    // their guaranteed count keeps them from pushing out the real matches.
+    std::vector<Entry> entries(m_heap);
+    size_t numHits = std::min(m_numHits, entries.size());
+    std::partial_sort(entries.begin(), entries.begin() + numHits, entries.end(), [](const Entry &a, const Entry &b) {
+        uint32_t scoreA = a.count - a.error, scoreB = b.count - b.error;
+        if (scoreA != scoreB) {
+            return scoreA > scoreB;
+        }
+        return a.id < b.id;
+    });
+    unsigned int minScore = (50 + (entries.front().count - entries.front().error) * m_topScorePercent) / 100;
+    for (size_t i = 0; i < numHits; i++) {
+        unsigned int score = entries[i].count - entries[i].error;
+        if (score < minScore) {
+            break;
+        }
+        results.append(Result(entries[i].id, score));
+    }
+    return results;
+}
+
+}  // namespace Acoustid
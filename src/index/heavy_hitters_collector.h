@@ -0,0 +1,109 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_HEAVY_HITTERS_COLLECTOR_H_
+#define ACOUSTID_INDEX_HEAVY_HITTERS_COLLECTOR_H_
+
+#include <QList>
+#include <vector>
+
+#include "collector.h"
+#include "common.h"
+#include "top_hits_collector.h"
+
+namespace Acoustid {
+
+// Collects the most frequent documents in bounded memory.
+//
+// This is the SpaceSaving algorithm. At most capacity() documents are tracked.
+// When a new document comes and the table is full, it takes the place of the
+// document with the lowest count and inherits that count as its error. With N
+// hits collected, every count is off by at most N / capacity(), and every
+// document with more hits than that is guaranteed to be tracked.
+//
+// It's meant for queries of very common terms, where counting every candidate
+// document exactly would need a huge hash table.
+class HeavyHittersCollector : public Collector {
+ public:
+    // The error bound is a fraction of all collected hits, it determines the number of tracked documents.
+    HeavyHittersCollector(size_t numHits, int topScorePercent = 0, double maxError = DEFAULT_MAX_ERROR);
+    ~HeavyHittersCollector();
+
+    void collect(uint32_t id) override { add(id, 1); }
+    void collectMany(const uint32_t *ids, size_t count) override;
+    void collectCount(uint32_t id, unsigned int count) override;
+    void collectExisting(uint32_t id) override;
+
+    size_t numHits() const { return m_numHits; }
+    int topScorePercent() const { return m_topScorePercent; }
+    double maxError() const { return m_maxError; }
+
+    // Maximum number of tracked documents.
+    size_t capacity() const { return m_capacity; }
+
+    // Number of currently tracked documents.
+    size_t size() const { return m_heap.size(); }
+
+    // Total number of hits collected.
+    uint64_t totalCount() const { return m_totalCount; }
+
+    // Upper bound of the error of any count so far.
+    uint64_t maxCountError() const { return m_heap.size() < m_capacity ? 0 : m_totalCount / m_capacity; }
+
+    // Forget all collected hits, but keep the memory for the next search.
+    void clear();
+
+    // Add the hits another collector with the same capacity counted in a different part of the
+    // index. A document only one of them tracks gets the other one's lowest count, both as hits
+    // and as error, and only the documents with the most hits are kept. The error bound holds
+    // for all hits of both collectors, as if they were collected by this one.
+    void merge(const HeavyHittersCollector &other);
+
+    // The best hits, scored by the number of hits they are guaranteed to have.
+    QList<Result> topResults();
+
+    // Number of tracked documents needed for the error bound, clamped to [numHits, MAX_CAPACITY].
+    static size_t capacityFor(size_t numHits, double maxError);
+
+    static constexpr double DEFAULT_MAX_ERROR = 0.00001;
+    static constexpr size_t MAX_CAPACITY = 1 << 20;
+
+ private:
+    struct Entry {
+        uint32_t id;
+        uint32_t count;
+        // Hits that might have belonged to the documents this one replaced.
+        uint32_t error;
+        // Position of the entry in the hash table.
+        uint32_t slot;
+    };
+
+    void add(uint32_t id, uint32_t count);
+
+    // Slot of the ID in the hash table, or the empty slot where it would be inserted.
+    size_t findSlot(uint32_t id) const;
+    void removeSlot(size_t slot);
+    size_t homeSlot(uint32_t id) const { return (id * UINT32_C(2654435769)) >> m_shift; }
+
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+    void swapEntries(size_t a, size_t b);
+
+    static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    size_t m_numHits;
+    int m_topScorePercent;
+    double m_maxError;
+    size_t m_capacity;
+    uint64_t m_totalCount;
+    // Min-heap of the tracked documents by count.
+    std::vector<Entry> m_heap;
+    // Open addressing hash table with linear probing, mapping IDs to their heap position.
+    std::vector<uint32_t> m_table;
+    size_t m_mask;
+    int m_shift;
+};
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_HEAVY_HITTERS_COLLECTOR_H_
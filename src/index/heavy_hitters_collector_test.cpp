@@ -0,0 +1,124 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "heavy_hitters_collector.h"
+
+using namespace Acoustid;
+
+TEST(HeavyHittersCollectorTest, Exact) {
+    // With enough capacity for all documents, the counts are exact.
+    HeavyHittersCollector collector(3, 0, 0.01);
+    ASSERT_EQ(100, collector.capacity());
+    uint32_t ids[] = {1, 2, 3, 4, 2, 3, 4, 3, 4, 4};
+    collector.collectMany(ids, 10);
+    collector.collectCount(5, 2);
+    collector.collectExisting(6);
+    ASSERT_EQ(5, collector.size());
+    ASSERT_EQ(12, collector.totalCount());
+    ASSERT_EQ(0, collector.maxCountError());
+
+    QList<Result> results = collector.topResults();
+    ASSERT_EQ(3, results.size());
+    ASSERT_EQ(4, results[0].id());
+    ASSERT_EQ(4, results[0].score());
+    ASSERT_EQ(3, results[1].id());
+    ASSERT_EQ(3, results[1].score());
+    ASSERT_EQ(2, results[2].id());
+    ASSERT_EQ(2, results[2].score());
+}
+
+TEST(HeavyHittersCollectorTest, TopScorePercent) {
+    HeavyHittersCollector collector(10, 70, 0.01);
+    uint32_t ids[] = {1, 2, 3, 4, 2, 3, 4, 3, 4, 4};
+    collector.collectMany(ids, 10);
+    QList<Result> results = collector.topResults();
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(4, results[0].id());
+    ASSERT_EQ(3, results[1].id());
+}
+
+TEST(HeavyHittersCollectorTest, BoundedMemory) {
+    HeavyHittersCollector collector(3, 0, 0.001);
+    ASSERT_EQ(1000, collector.capacity());
+    // A few frequent documents among many that appear only once.
+    for (uint32_t i = 0; i < 100000; i++) {
+        collector.collect(1000 + i);
+        if (i % 100 == 0) {
+            collector.collect(1);
+        }
+        if (i % 200 == 0) {
+            collector.collect(2);
+        }
+        if (i % 400 == 0) {
+            collector.collect(3);
+        }
+    }
+    ASSERT_EQ(1000, collector.size());
+    ASSERT_EQ(101750, collector.totalCount());
+    ASSERT_EQ(101, collector.maxCountError());
+
+    QList<Result> results = collector.topResults();
+    ASSERT_EQ(3, results.size());
+    ASSERT_EQ(1, results[0].id());
+    ASSERT_EQ(1000, results[0].score());
+    ASSERT_EQ(2, results[1].id());
+    ASSERT_EQ(500, results[1].score());
+    ASSERT_EQ(3, results[2].id());
+    ASSERT_EQ(250, results[2].score());
+
+    collector.clear();
+    ASSERT_EQ(0, collector.size());
+    ASSERT_TRUE(collector.topResults().isEmpty());
+}
+
+TEST(HeavyHittersCollectorTest, Merge) {
+    // The same hits as in BoundedMemory, split between two collectors.
+    HeavyHittersCollector collector(3, 0, 0.001), other(3, 0, 0.001);
+    for (uint32_t i = 0; i < 100000; i++) {
+        HeavyHittersCollector &target = i < 30000 ? collector : other;
+        target.collect(1000 + i);
+        if (i % 100 == 0) {
+            target.collect(1);
+        }
+        if (i % 200 == 0) {
+            target.collect(2);
+        }
+        if (i % 400 == 0) {
+            target.collect(3);
+        }
+    }
+    // A document only one of them tracks.
+    collector.collectCount(4, 200);
+
+    collector.merge(other);
+    ASSERT_EQ(1000, collector.size());
+    ASSERT_EQ(101950, collector.totalCount());
+
+    // The guaranteed hits are a lower bound of the real ones, within the error bound.
+    QList<Result> results = collector.topResults();
+    ASSERT_EQ(3, results.size());
+    ASSERT_EQ(1, results[0].id());
+    ASSERT_GE(1000, results[0].score());
+    ASSERT_LE(1000 - collector.maxCountError(), results[0].score());
+    ASSERT_EQ(2, results[1].id());
+    ASSERT_GE(500, results[1].score());
+    ASSERT_LE(500 - collector.maxCountError(), results[1].score());
+    ASSERT_EQ(3, results[2].id());
+    ASSERT_GE(250, results[2].score());
+
+    // Merging into an empty collector keeps the counts.
+    HeavyHittersCollector empty(3, 0, 0.001);
+    empty.merge(collector);
+    ASSERT_EQ(collector.size(), empty.size());
+    ASSERT_EQ(collector.totalCount(), empty.totalCount());
+    ASSERT_EQ(results[0].score(), empty.topResults()[0].score());
+}
+
+TEST(HeavyHittersCollectorTest, Capacity) {
+    ASSERT_EQ(100000, HeavyHittersCollector::capacityFor(10, 0.00001));
+    ASSERT_EQ(500, HeavyHittersCollector::capacityFor(500, 0.01));
+    ASSERT_EQ(HeavyHittersCollector::MAX_CAPACITY, HeavyHittersCollector::capacityFor(10, 0));
+    ASSERT_EQ(HeavyHittersCollector::MAX_CAPACITY, HeavyHittersCollector::capacityFor(10, 1e-9));
+}
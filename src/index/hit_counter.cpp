@@ -0,0 +1,76 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "hit_counter.h"
+
+#include <algorithm>
+
+namespace Acoustid {
+
+// Smallest table that is ever allocated.
+static const size_t MIN_CAPACITY = 64;
+
+// Tables larger than this are freed by clear(), so that one huge search
+// doesn't keep the memory allocated forever.
+static const size_t MAX_RETAINED_CAPACITY = 1 << 20;
+
+HitCounter::HitCounter(size_t expectedSize) { reserve(expectedSize); }
+
+void HitCounter::reserve(size_t size) {
+    // Keep the load factor at most 50%, long probe sequences kill the performance.
+    size_t capacity = MIN_CAPACITY;
+    while (capacity < size * 2) {
+        capacity *= 2;
+    }
+    if (capacity > m_entries.size()) {
+        resize(capacity);
+    }
+}
+
+void HitCounter::clear() {
+    if (m_entries.size() > MAX_RETAINED_CAPACITY) {
+        m_entries.clear();
+        m_size = 0;
+        resize(MIN_CAPACITY);
+        return;
+    }
+    if (m_size > 0) {
+        std::fill(m_entries.begin(), m_entries.end(), Entry{0, 0});
+        m_size = 0;
+    }
+}
+
+uint32_t HitCounter::get(uint32_t id) const {
+    size_t pos = slot(id);
+    while (true) {
+        const Entry &entry = m_entries[pos];
+        if (entry.count == 0) {
+            return 0;
+        }
+        if (entry.id == id) {
+            return entry.count;
+        }
+        pos = (pos + 1) & m_mask;
+    }
+}
+
+void HitCounter::resize(size_t capacity) {
+    std::vector<Entry> oldEntries(capacity, Entry{0, 0});
+    m_entries.swap(oldEntries);
+    m_mask = capacity - 1;
+    m_maxSize = capacity / 2;
+    m_shift = 32;
+    for (size_t i = capacity; i > 1; i >>= 1) {
+        m_shift--;
+    }
+    m_size = 0;
+    for (const auto &entry : oldEntries) {
+        if (entry.count != 0) {
+            add(entry.id, entry.count);
+        }
+    }
+}
+
+void HitCounter::grow() { resize(m_entries.size() * 2); }
+
+}  // namespace Acoustid
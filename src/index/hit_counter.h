@@ -0,0 +1,110 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_HIT_COUNTER_H_
+#define ACOUSTID_INDEX_HIT_COUNTER_H_
+
+#include <vector>
+
+#include "common.h"
+
+namespace Acoustid {
+
+// Counts hits per document ID.
+//
+// This is a flat hash table with linear probing, stored in a single array.
+// Counting a hit is typically one memory access and never allocates, unless
+// the table needs to grow. Clearing the table keeps the allocated memory, so
+// the same instance can be cheaply reused for many searches.
+class HitCounter {
+ public:
+    struct Entry {
+        uint32_t id;
+        uint32_t count;
+    };
+
+    HitCounter(size_t expectedSize = 0);
+
+    // Number of unique IDs in the table.
+    size_t size() const { return m_size; }
+    bool isEmpty() const { return m_size == 0; }
+
+    // Number of slots in the table.
+    size_t capacity() const { return m_entries.size(); }
+
+    // Make sure the table can hold the given number of IDs without growing.
+    void reserve(size_t size);
+
+    // Remove all IDs from the table, but keep the memory allocated.
+    void clear();
+
+    // Add hits for the ID and return its new count.
+    uint32_t add(uint32_t id, uint32_t count = 1) {
+        size_t pos = slot(id);
+        while (true) {
+            Entry &entry = m_entries[pos];
+            if (entry.count == 0) {
+                if (m_size >= m_maxSize) {
+                    grow();
+                    return add(id, count);
+                }
+                entry.id = id;
+                entry.count = count;
+                m_size++;
+                return count;
+            }
+            if (entry.id == id) {
+                entry.count += count;
+                return entry.count;
+            }
+            pos = (pos + 1) & m_mask;
+        }
+    }
+
+    // Add a hit for the ID only if it is already in the table. Returns its
+    // new count, or 0 if the ID was not found.
+    uint32_t addIfPresent(uint32_t id) {
+        if (m_size == 0) {
+            return 0;
+        }
+        size_t pos = slot(id);
+        while (true) {
+            Entry &entry = m_entries[pos];
+            if (entry.count == 0) {
+                return 0;
+            }
+            if (entry.id == id) {
+                return ++entry.count;
+            }
+            pos = (pos + 1) & m_mask;
+        }
+    }
+
+    uint32_t get(uint32_t id) const;
+
+    // Call the function with each non-empty entry, in no particular order.
+    template <typename Func>
+    void forEach(Func func) const {
+        for (const auto &entry : m_entries) {
+            if (entry.count != 0) {
+                func(entry);
+            }
+        }
+    }
+
+ private:
+    size_t slot(uint32_t id) const { return (id * UINT32_C(2654435769)) >> m_shift; }
+
+    void resize(size_t capacity);
+    void grow();
+
+    std::vector<Entry> m_entries;
+    size_t m_size = 0;
+    size_t m_maxSize = 0;
+    size_t m_mask = 0;
+    int m_shift = 0;
+};
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_HIT_COUNTER_H_
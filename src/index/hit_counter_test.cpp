@@ -0,0 +1,60 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include <QHash>
+
+#include "hit_counter.h"
+
+using namespace Acoustid;
+
+TEST(HitCounterTest, AddAndGet) {
+    HitCounter counter;
+    ASSERT_TRUE(counter.isEmpty());
+    counter.add(1);
+    counter.add(2);
+    counter.add(2);
+    counter.add(3, 5);
+    ASSERT_EQ(3, counter.size());
+    ASSERT_EQ(1, counter.get(1));
+    ASSERT_EQ(2, counter.get(2));
+    ASSERT_EQ(5, counter.get(3));
+    ASSERT_EQ(0, counter.get(4));
+}
+
+TEST(HitCounterTest, Grow) {
+    HitCounter counter;
+    QHash<uint32_t, uint32_t> expected;
+    for (uint32_t i = 0; i < 10000; i++) {
+        uint32_t id = i * 7919 % 3001;
+        counter.add(id);
+        expected[id] += 1;
+    }
+    ASSERT_EQ(expected.size(), counter.size());
+    ASSERT_LE(counter.size() * 2, counter.capacity());
+    for (auto it = expected.constBegin(); it != expected.constEnd(); ++it) {
+        ASSERT_EQ(it.value(), counter.get(it.key())) << "Different count for " << it.key();
+    }
+    size_t visited = 0;
+    counter.forEach([&](const HitCounter::Entry &entry) {
+        ASSERT_EQ(expected.value(entry.id), entry.count);
+        visited++;
+    });
+    ASSERT_EQ(expected.size(), visited);
+}
+
+TEST(HitCounterTest, ClearKeepsMemory) {
+    HitCounter counter(1000);
+    auto capacity = counter.capacity();
+    ASSERT_LE(2000, capacity);
+    for (uint32_t i = 0; i < 1000; i++) {
+        counter.add(i);
+    }
+    counter.clear();
+    ASSERT_TRUE(counter.isEmpty());
+    ASSERT_EQ(capacity, counter.capacity());
+    ASSERT_EQ(0, counter.get(10));
+    counter.add(10);
+    ASSERT_EQ(1, counter.get(10));
+}
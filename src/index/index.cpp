@@ -14,10 +14,48 @@
 
 using namespace Acoustid;
 
+// Switch the segments to the given layout. The segment indexes are immutable once shared,
+// so they are replaced by copies, reusing those already built for the same segment in `current`.
+static void applySegmentIndexLayout(IndexInfo &info, const IndexInfo &current, SegmentIndexLayout layout)
+{
+	for (int i = 0; i < info.segmentCount(); i++) {
+		SegmentIndexSharedPtr index = info.segment(i).index();
+		if (index.isNull() || index->layout() == layout) {
+			continue;
+		}
+		SegmentIndexSharedPtr newIndex;
+		for (const auto &segment : current.segments()) {
+			if (segment.id() == info.segment(i).id() && segment.index() && segment.index()->layout() == layout) {
+				newIndex = segment.index();
+				break;
+			}
+		}
+		if (newIndex.isNull()) {
+			newIndex = index->withLayout(layout);
+		}
+		info.segments()[i].setIndex(newIndex);
+	}
+}
+
 Index::Index(DirectorySharedPtr dir, bool create)
 	: m_mutex(QMutex::Recursive), m_dir(dir), m_open(false),
 	  m_hasWriter(false),
-	  m_deleter(new IndexFileDeleter(dir))
+	  m_blockCache(BlockCacheSharedPtr::create()),
+	  m_resultCache(SearchResultCacheSharedPtr::create()),
+	  m_singleFlight(SearchSingleFlightSharedPtr::create()),
+	  m_deleter(new IndexFileDeleter(dir, m_blockCache)),
+	  m_searchThreads(1),
+	  m_prefetchBlocks(false),
+	  m_approximateSearchThreshold(0),
+	  m_approximateSearchError(HeavyHittersCollector::DEFAULT_MAX_ERROR),
+	  m_frequentTermCutoff(0),
+	  m_frequentTermMode(DEMOTE_FREQUENT_TERMS),
+	  m_skippedBlockCount(0),
+	  m_cancelledSearchCount(0),
+	  m_majorFaultCount(0),
+	  m_approximateSearchCount(0),
+	  m_frequentTermCount(0),
+	  m_segmentIndexLayout(SORTED_INDEX_LAYOUT)
 {
 	open(create);
 }
@@ -30,6 +68,98 @@ bool Index::containsDocument(uint32_t docId) {
     return true;
 }
 
+QThreadPool *Index::threadPool() {
+    QMutexLocker locker(&m_mutex);
+    return m_threadPool;
+}
+
+void Index::setThreadPool(QThreadPool *pool) {
+    QMutexLocker locker(&m_mutex);
+    m_threadPool = pool;
+}
+
+int Index::searchThreads() {
+    QMutexLocker locker(&m_mutex);
+    return m_searchThreads;
+}
+
+void Index::setSearchThreads(int numThreads) {
+    QMutexLocker locker(&m_mutex);
+    m_searchThreads = numThreads;
+}
+
+bool Index::prefetchBlocks() {
+    QMutexLocker locker(&m_mutex);
+    return m_prefetchBlocks;
+}
+
+void Index::setPrefetchBlocks(bool prefetch) {
+    QMutexLocker locker(&m_mutex);
+    m_prefetchBlocks = prefetch;
+}
+
+size_t Index::approximateSearchThreshold() {
+    QMutexLocker locker(&m_mutex);
+    return m_approximateSearchThreshold;
+}
+
+void Index::setApproximateSearchThreshold(size_t threshold) {
+    QMutexLocker locker(&m_mutex);
+    m_approximateSearchThreshold = threshold;
+}
+
+double Index::approximateSearchError() {
+    QMutexLocker locker(&m_mutex);
+    return m_approximateSearchError;
+}
+
+void Index::setApproximateSearchError(double maxError) {
+    QMutexLocker locker(&m_mutex);
+    m_approximateSearchError = maxError;
+}
+
+size_t Index::frequentTermCutoff() {
+    QMutexLocker locker(&m_mutex);
+    return m_frequentTermCutoff;
+}
+
+void Index::setFrequentTermCutoff(size_t cutoff) {
+    QMutexLocker locker(&m_mutex);
+    m_frequentTermCutoff = cutoff;
+}
+
+FrequentTermMode Index::frequentTermMode() {
+    QMutexLocker locker(&m_mutex);
+    return m_frequentTermMode;
+}
+
+void Index::setFrequentTermMode(FrequentTermMode mode) {
+    QMutexLocker locker(&m_mutex);
+    m_frequentTermMode = mode;
+}
+
+SegmentIndexLayout Index::segmentIndexLayout() {
+    QMutexLocker locker(&m_mutex);
+    return m_segmentIndexLayout;
+}
+
+void Index::setSegmentIndexLayout(SegmentIndexLayout layout) {
+    QMutexLocker locker(&m_mutex);
+    m_segmentIndexLayout = layout;
+    applySegmentIndexLayout(m_info, m_info, layout);
+}
+
+size_t Index::segmentIndexMemoryUsage() {
+    QMutexLocker locker(&m_mutex);
+    size_t size = 0;
+    for (const auto &segment : m_info.segments()) {
+        if (segment.index()) {
+            size += segment.index()->memoryUsage();
+        }
+    }
+    return size;
+}
+
 bool Index::exists(const QSharedPointer<Directory> &dir) {
     return IndexInfo::findCurrentRevision(dir.get()) >= 0;
 }
@@ -126,7 +256,9 @@ void Index::updateInfo(const IndexInfo& oldInfo, const IndexInfo& newInfo, bool
 		m_deleter->decRef(oldInfo);
 	}
 	if (updateIndex) {
-		m_info = newInfo;
+		IndexInfo info = newInfo;
+		applySegmentIndexLayout(info, m_info, m_segmentIndexLayout);
+		m_info = info;
 		for (int i = 0; i < m_info.segmentCount(); i++) {
 			assert(!m_info.segment(i).index().isNull());
 		}
@@ -183,7 +315,9 @@ void Index::applyUpdates(const OpBatch &batch) {
 
 }
 
-std::vector<SearchResult> Index::search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs) {
+std::vector<SearchResult> Index::search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs,
+                                       CancellationTokenSharedPtr cancellation) {
     auto reader = openReader();
+    reader->setCancellationToken(cancellation);
     return reader->search(terms.data(), terms.size(), timeoutInMSecs);
 }
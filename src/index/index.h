@@ -5,15 +5,22 @@
 #define ACOUSTID_INDEX_H_
 
 #include <QDeadlineTimer>
+#include <QAtomicInteger>
 #include <QMutex>
+#include <QPointer>
 #include <QThreadPool>
 #include <QWaitCondition>
 
 #include "base_index.h"
+#include "block_cache.h"
 #include "common.h"
+#include "heavy_hitters_collector.h"
 #include "index.h"
 #include "index_info.h"
+#include "search_result_cache.h"
+#include "search_single_flight.h"
 #include "segment_index.h"
+#include "segment_term_stats.h"
 #include "store/directory.h"
 
 namespace Acoustid {
@@ -33,7 +40,74 @@ class Index : public BaseIndex, public QEnableSharedFromThis<Index> {
     virtual ~Index();
 
     void close() {}
-    void setThreadPool(QThreadPool *pool) { }
+
+    // Thread pool used to search multiple segments in parallel.
+    QThreadPool *threadPool();
+    void setThreadPool(QThreadPool *pool);
+
+    // Maximum number of threads used by a single search, including the calling thread.
+    // Values lower than 2 mean that segments are searched sequentially.
+    int searchThreads();
+    void setSearchThreads(int numThreads);
+
+    // Request the data blocks from the OS before each search, so that the page faults
+    // of a memory mapped index overlap. Disabled by default.
+    bool prefetchBlocks();
+    void setPrefetchBlocks(bool prefetch);
+
+    // Top hits searches expected to read more postings than the threshold count their hits
+    // approximately, in bounded memory, with the error bound as a fraction of all hits.
+    // Zero threshold, the default, means that all searches are exact.
+    size_t approximateSearchThreshold();
+    void setApproximateSearchThreshold(size_t threshold);
+    double approximateSearchError();
+    void setApproximateSearchError(double maxError);
+
+    // Terms found in more documents than the cutoff are skipped or only add to the scores of
+    // documents found by the other terms, see FrequentTermMode. Zero cutoff, the default, disables it.
+    size_t frequentTermCutoff();
+    void setFrequentTermCutoff(size_t cutoff);
+    FrequentTermMode frequentTermMode();
+    void setFrequentTermMode(FrequentTermMode mode);
+
+    // Cache of decoded data blocks, disabled by default.
+    BlockCacheSharedPtr blockCache() { return m_blockCache; }
+    void setBlockCacheSize(size_t maxSize) { m_blockCache->setMaxSize(maxSize); }
+
+    // Cache of search results for the current revision, disabled by default.
+    SearchResultCacheSharedPtr resultCache() { return m_resultCache; }
+    void setResultCacheSize(size_t maxSize) { m_resultCache->setMaxSize(maxSize); }
+
+    // Identical searches running at the same time are collapsed into one, enabled by default.
+    SearchSingleFlightSharedPtr singleFlight() { return m_singleFlight; }
+    void setSingleFlightEnabled(bool enabled) { m_singleFlight->setEnabled(enabled); }
+
+    // Layout of the block keys in memory, used for all segments of the index.
+    SegmentIndexLayout segmentIndexLayout();
+    void setSegmentIndexLayout(SegmentIndexLayout layout);
+
+    // Memory used by the block indexes of the current segments.
+    size_t segmentIndexMemoryUsage();
+
+    // Number of data blocks that searches didn't need to read thanks to the block filters.
+    uint64_t skippedBlockCount() const { return m_skippedBlockCount.load(); }
+    void addSkippedBlocks(uint64_t count) { m_skippedBlockCount.fetchAndAddRelaxed(count); }
+
+    // Number of searches that were stopped because nobody was waiting for them anymore.
+    uint64_t cancelledSearchCount() const { return m_cancelledSearchCount.load(); }
+    void addCancelledSearch() { m_cancelledSearchCount.fetchAndAddRelaxed(1); }
+
+    // Number of major page faults taken by searches.
+    uint64_t majorFaultCount() const { return m_majorFaultCount.load(); }
+    void addMajorFaults(uint64_t count) { m_majorFaultCount.fetchAndAddRelaxed(count); }
+
+    // Number of searches that counted their hits approximately.
+    uint64_t approximateSearchCount() const { return m_approximateSearchCount.load(); }
+    void addApproximateSearch() { m_approximateSearchCount.fetchAndAddRelaxed(1); }
+
+    // Number of query terms that were skipped or demoted for being too frequent.
+    uint64_t frequentTermCount() const { return m_frequentTermCount.load(); }
+    void addFrequentTerms(uint64_t count) { m_frequentTermCount.fetchAndAddRelaxed(count); }
 
     // Return true if the index exists on disk.
     static bool exists(const QSharedPointer<Directory> &dir);
@@ -44,7 +118,8 @@ class Index : public BaseIndex, public QEnableSharedFromThis<Index> {
     IndexInfo info() { return m_info; }
 
     virtual bool containsDocument(uint32_t docId) override;
-    virtual std::vector<SearchResult> search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs = 0) override;
+    virtual std::vector<SearchResult> search(const std::vector<uint32_t> &terms, int64_t timeoutInMSecs = 0,
+                                             CancellationTokenSharedPtr cancellation = CancellationTokenSharedPtr()) override;
 
     virtual bool hasAttribute(const QString &name) override;
     virtual QString getAttribute(const QString &name) override;
@@ -76,9 +151,25 @@ class Index : public BaseIndex, public QEnableSharedFromThis<Index> {
     DirectorySharedPtr m_dir;
     bool m_hasWriter;
     QWaitCondition m_writerReleased;
+    BlockCacheSharedPtr m_blockCache;
+    SearchResultCacheSharedPtr m_resultCache;
+    SearchSingleFlightSharedPtr m_singleFlight;
     std::unique_ptr<IndexFileDeleter> m_deleter;
     IndexInfo m_info;
     bool m_open;
+    QPointer<QThreadPool> m_threadPool;
+    int m_searchThreads;
+    bool m_prefetchBlocks;
+    size_t m_approximateSearchThreshold;
+    double m_approximateSearchError;
+    size_t m_frequentTermCutoff;
+    FrequentTermMode m_frequentTermMode;
+    QAtomicInteger<quint64> m_skippedBlockCount;
+    QAtomicInteger<quint64> m_cancelledSearchCount;
+    QAtomicInteger<quint64> m_majorFaultCount;
+    QAtomicInteger<quint64> m_approximateSearchCount;
+    QAtomicInteger<quint64> m_frequentTermCount;
+    SegmentIndexLayout m_segmentIndexLayout;
 };
 
 typedef QWeakPointer<Index> IndexWeakPtr;
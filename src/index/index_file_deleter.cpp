@@ -6,8 +6,8 @@
 
 using namespace Acoustid;
 
-IndexFileDeleter::IndexFileDeleter(DirectorySharedPtr dir)
-	: m_dir(dir)
+IndexFileDeleter::IndexFileDeleter(DirectorySharedPtr dir, BlockCacheSharedPtr blockCache)
+	: m_dir(dir), m_blockCache(blockCache)
 {
 }
 
@@ -39,21 +39,34 @@ void IndexFileDeleter::incRef(const QString& file)
 
 void IndexFileDeleter::decRef(const IndexInfo& info)
 {
-	QList<QString> files = info.files();
-	for (int i = 0; i < files.size(); i++) {
-		decRef(files.at(i));
+	if (info.revision() < 0) {
+		return;
+	}
+	decRef(IndexInfo::indexInfoFileName(info.revision()));
+	const SegmentInfoList& segments = info.segments();
+	for (int i = 0; i < segments.size(); i++) {
+		decRef(segments.at(i));
 	}
 }
 
 void IndexFileDeleter::decRef(const SegmentInfo& info)
 {
-	QList<QString> files = info.files();
-	for (int i = 0; i < files.size(); i++) {
-		decRef(files.at(i));
+	decRef(info.indexFileName());
+	if (info.filter()) {
+		decRef(info.filterFileName());
+	}
+	if (info.blockFilter()) {
+		decRef(info.blockFilterFileName());
+	}
+	if (info.termStats()) {
+		decRef(info.termStatsFileName());
+	}
+	if (decRef(info.dataFileName()) && m_blockCache) {
+		m_blockCache->invalidateSegment(info.id());
 	}
 }
 
-void IndexFileDeleter::decRef(const QString& file)
+bool IndexFileDeleter::decRef(const QString& file)
 {
 	int count = m_refCounts.value(file) - 1;
 	//qDebug() << "DecRef" << file << count;
@@ -61,9 +74,9 @@ void IndexFileDeleter::decRef(const QString& file)
 		qDebug() << "Deleting file" << file;
 		m_dir->deleteFile(file);
 		m_refCounts.remove(file);
+		return true;
 	}
-	else {
-		m_refCounts[file] = count;
-	}
+	m_refCounts[file] = count;
+	return false;
 }
 
@@ -5,6 +5,7 @@
 #define ACOUSTID_INDEX_FILE_DELETER_H_
 
 #include "common.h"
+#include "block_cache.h"
 #include "segment_info.h"
 #include "index_info.h"
 
@@ -13,7 +14,7 @@ namespace Acoustid {
 class IndexFileDeleter
 {
 public:
-	IndexFileDeleter(DirectorySharedPtr dir);
+	IndexFileDeleter(DirectorySharedPtr dir, BlockCacheSharedPtr blockCache = BlockCacheSharedPtr());
 	virtual ~IndexFileDeleter();
 
 	void incRef(const IndexInfo& info);
@@ -21,12 +22,14 @@ public:
 	void incRef(const SegmentInfo& info);
 	void decRef(const SegmentInfo& info);
 	void incRef(const QString& file);
-	void decRef(const QString& file);
+	// Returns true if the file was deleted.
+	bool decRef(const QString& file);
 
 protected:
 	ACOUSTID_DISABLE_COPY(IndexFileDeleter)
 
 	DirectorySharedPtr m_dir;
+	BlockCacheSharedPtr m_blockCache;
 	QMap<QString, int> m_refCounts;
 };
 
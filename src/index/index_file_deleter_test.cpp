@@ -43,3 +43,26 @@ TEST(IndexFileDeleterTest, KeepOnInc)
 	deleter.incRef("test.txt");
 	ASSERT_TRUE(dir->fileExists("test.txt"));
 }
+
+TEST(IndexFileDeleterTest, InvalidateBlockCache)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	auto cache = BlockCacheSharedPtr::create(1024 * 1024);
+	SegmentInfo segment(3);
+	delete dir->createFile(segment.indexFileName());
+	delete dir->createFile(segment.dataFileName());
+
+	uint32_t items[] = { 1 };
+	auto block = QSharedPointer<BlockData>::create();
+	block->assign(items, 1, 100);
+	cache->insert(3, 0, block);
+
+	IndexFileDeleter deleter(dir, cache);
+	deleter.incRef(segment);
+	deleter.incRef(segment);
+	deleter.decRef(segment);
+	ASSERT_FALSE(cache->get(3, 0).isNull());
+	deleter.decRef(segment);
+	ASSERT_TRUE(cache->get(3, 0).isNull());
+	ASSERT_FALSE(dir->fileExists(segment.dataFileName()));
+}
@@ -88,6 +88,21 @@ void IndexInfo::load(InputStream* rawInput, bool loadIndexes, Directory* dir)
 		SegmentInfo segment(id, blockCount, lastKey, checksum);
 		if (loadIndexes) {
 			segment.setIndex(SegmentIndexReader(dir->openFile(segment.indexFileName()), segment.blockCount()).read());
+			segment.setDataReader(SegmentDataReaderSharedPtr::create(dir->openFile(segment.dataFileName()), BLOCK_SIZE));
+			if (segment.blockCount()) {
+				segment.setFirstKey(segment.index()->key(0));
+			}
+			if (dir->fileExists(segment.filterFileName())) {
+				std::unique_ptr<InputStream> filterInput(dir->openFile(segment.filterFileName()));
+				segment.setFilter(SegmentFilter::load(filterInput.get()));
+			}
+			if (dir->fileExists(segment.blockFilterFileName())) {
+				segment.setBlockFilter(SegmentBlockFilterSharedPtr::create(dir->openFile(segment.blockFilterFileName()), segment.blockCount()));
+			}
+			if (dir->fileExists(segment.termStatsFileName())) {
+				std::unique_ptr<InputStream> termStatsInput(dir->openFile(segment.termStatsFileName()));
+				segment.setTermStats(SegmentTermStats::load(termStatsInput.get()));
+			}
 		}
 		addSegment(segment);
 	}
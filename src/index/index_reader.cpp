@@ -2,28 +2,365 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <algorithm>
-#include <QDateTime>
+#include <exception>
+#include <memory>
+#include <QAtomicInt>
+#include <numeric>
+#include <QMutex>
+#include <QRunnable>
+#include <QWaitCondition>
 #include "store/directory.h"
 #include "store/input_stream.h"
 #include "store/output_stream.h"
+#include "util/defer.h"
+#include "util/page_faults.h"
 #include "segment_index_reader.h"
 #include "segment_data_reader.h"
 #include "segment_searcher.h"
 #include "index.h"
 #include "index_reader.h"
+#include "index_utils.h"
+#include "heavy_hitters_collector.h"
+#include "hit_counter.h"
 #include "top_hits_collector.h"
 
 using namespace Acoustid;
 
+namespace {
+
+// Returns true if the sorted fingerprint has items within the segment's key range.
+bool overlapsSegment(const std::vector<uint32_t> &fingerprint, const SegmentInfo &segment)
+{
+	return !fingerprint.empty() && fingerprint.front() <= segment.lastKey() && fingerprint.back() >= segment.firstKey();
+}
+
+// Number of fingerprint items that might be found in the segment, which is also
+// the highest score a single document can get from it.
+unsigned int maxSegmentScore(const std::vector<uint32_t> &fingerprint, const SegmentInfo &segment)
+{
+	auto begin = std::lower_bound(fingerprint.begin(), fingerprint.end(), segment.firstKey());
+	auto end = std::upper_bound(begin, fingerprint.end(), segment.lastKey());
+	if (!segment.filter()) {
+		return end - begin;
+	}
+	unsigned int count = 0;
+	for (auto it = begin; it != end; ++it) {
+		if (segment.filter()->mightContain(*it)) {
+			count++;
+		}
+	}
+	return count;
+}
+
+// Order in which the segments are searched. The largest segments go first, so that
+// a search which runs out of time has already covered most of the index.
+std::vector<int> searchOrder(const SegmentInfoList &segments)
+{
+	std::vector<int> order(segments.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&segments](int a, int b) {
+		return segments.at(a).blockCount() > segments.at(b).blockCount();
+	});
+	return order;
+}
+
+QDeadlineTimer makeDeadline(int64_t timeoutInMSecs)
+{
+	return timeoutInMSecs > 0 ? QDeadlineTimer(timeoutInMSecs) : QDeadlineTimer(QDeadlineTimer::Forever);
+}
+
+// Time left until the deadline, as a timeout for the search methods. An expired
+// deadline still gives a tiny timeout rather than zero, which means no limit.
+int64_t remainingTimeout(const QDeadlineTimer &deadline)
+{
+	return deadline.isForever() ? 0 : std::max<int64_t>(1, deadline.remainingTime());
+}
+
+// Stop the search if nobody is waiting for it anymore or if it ran out of time.
+void checkInterrupted(const QDeadlineTimer &deadline, const CancellationTokenSharedPtr &cancellation)
+{
+	if (cancellation && cancellation->isCancelled()) {
+		throw SearchCancelled();
+	}
+	if (deadline.hasExpired()) {
+		throw TimeoutExceeded();
+	}
+}
+
+// Passes a document to the target collector at most once per query item, no matter
+// how many variants of the item it matches.
+class FoldedHitsCollector : public Collector
+{
+public:
+	FoldedHitsCollector(Collector *target) : m_target(target) {}
+
+	void collect(uint32_t id) override
+	{
+		if (m_seen.add(id) == 1) {
+			m_target->collect(id);
+		}
+	}
+
+private:
+	Collector *m_target;
+	HitCounter m_seen;
+};
+
+// Wraps the collectors of a batch search in filtering collectors, if there is a document filter.
+std::vector<Collector *> filterCollectors(const std::vector<Collector *> &collectors, const DocumentFilter *filter,
+	std::vector<DocumentFilterCollector> &filtered)
+{
+	std::vector<Collector *> result(collectors);
+	if (filter) {
+		filtered.reserve(collectors.size());
+		for (size_t i = 0; i < collectors.size(); i++) {
+			filtered.emplace_back(collectors[i], filter);
+			result[i] = &filtered.back();
+		}
+	}
+	return result;
+}
+
+// Appends the term and all terms that differ from it in at most maxDistance of the bits in bitMask.
+void addHammingNeighbours(uint32_t term, int maxDistance, uint32_t bitMask, std::vector<uint32_t> &terms)
+{
+	terms.push_back(term);
+	if (maxDistance < 1) {
+		return;
+	}
+	for (int i = 0; i < 32; i++) {
+		uint32_t bit1 = uint32_t(1) << i;
+		if (!(bitMask & bit1)) {
+			continue;
+		}
+		terms.push_back(term ^ bit1);
+		if (maxDistance < 2) {
+			continue;
+		}
+		for (int j = i + 1; j < 32; j++) {
+			uint32_t bit2 = uint32_t(1) << j;
+			if (bitMask & bit2) {
+				terms.push_back(term ^ bit1 ^ bit2);
+			}
+		}
+	}
+}
+
+// Part of a parallel search, the fingerprint items [begin, end) in one segment.
+struct SearchTask
+{
+	int segment;
+	size_t begin;
+	size_t end;
+};
+
+// Split the search into tasks, in the search order of the segments. Segments large enough
+// for more than one thread are split into key ranges, each with its own slice of the items.
+std::vector<SearchTask> planParallelSearch(const std::vector<uint32_t> &fingerprint, const SegmentInfoList &segments, int numThreads)
+{
+	std::vector<SearchTask> tasks;
+	for (int i : searchOrder(segments)) {
+		const SegmentInfo &s = segments.at(i);
+		if (!overlapsSegment(fingerprint, s)) {
+			continue;
+		}
+		size_t numPartitions = std::min<size_t>(numThreads, s.blockCount() / IndexReader::MIN_PARTITION_BLOCKS);
+		if (numPartitions < 2) {
+			tasks.push_back(SearchTask { i, 0, fingerprint.size() });
+			continue;
+		}
+		SegmentSearcher searcher(s.index(), SegmentDataReaderSharedPtr(), s.lastKey());
+		std::vector<size_t> bounds = searcher.partition(fingerprint.data(), fingerprint.size(), numPartitions);
+		for (size_t k = 0; k + 1 < bounds.size(); k++) {
+			tasks.push_back(SearchTask { i, bounds[k], bounds[k + 1] });
+		}
+	}
+	return tasks;
+}
+
+// State shared by all threads taking part in one search. Tasks are claimed
+// one at a time, so threads that finish early just pick up more of them.
+class ParallelSearch
+{
+public:
+	ParallelSearch(IndexReader *reader, std::vector<uint32_t> &fingerprint, Collector *collector, std::vector<SearchTask> tasks, QDeadlineTimer deadline)
+		: m_reader(reader), m_fingerprint(fingerprint), m_collector(collector),
+		  m_heavyHitters(dynamic_cast<HeavyHittersCollector *>(collector)), m_tasks(std::move(tasks)),
+		  m_deadline(deadline), m_cancellation(reader->cancellationToken()),
+		  m_filter(reader->documentFilter()), m_allowPartialResults(reader->allowPartialResults()),
+		  m_nextTask(0), m_aborted(0), m_timedOut(0), m_workerMajorFaults(0), m_activeWorkers(0)
+	{
+	}
+
+	void run()
+	{
+		// Each pool thread keeps its own collector, so the memory is reused by the next search.
+		static thread_local TopHitsCollector localCollector(0);
+		// Approximate searches count in bounded memory on every thread, the threads' counts are merged at the end.
+		std::unique_ptr<HeavyHittersCollector> localHeavyHitters;
+		Collector *local = &localCollector;
+		if (m_heavyHitters) {
+			localHeavyHitters.reset(new HeavyHittersCollector(m_heavyHitters->numHits(), m_heavyHitters->topScorePercent(),
+				m_heavyHitters->maxError()));
+			local = localHeavyHitters.get();
+		}
+		else {
+			localCollector.clear();
+			localCollector.reserve(m_fingerprint.size());
+		}
+		DocumentFilterCollector filtered(local, m_filter.data());
+		Collector *target = m_filter ? static_cast<Collector *>(&filtered) : local;
+		size_t skippedBlocks = 0;
+		try {
+			const SegmentInfoList& segments = m_reader->info().segments();
+			while (!m_aborted.loadAcquire() && !m_timedOut.loadAcquire()) {
+				size_t i = m_nextTask.fetchAndAddOrdered(1);
+				if (i >= m_tasks.size()) {
+					break;
+				}
+				checkInterrupted(m_deadline, m_cancellation);
+				const SearchTask &task = m_tasks[i];
+				const SegmentInfo& s = segments.at(task.segment);
+				SegmentSearcher searcher(s.index(), m_reader->sharedSegmentDataReader(s), s.lastKey());
+				searcher.setBlockCache(m_reader->blockCache(), s.id());
+				searcher.setFilter(s.filter());
+				searcher.setBlockFilter(s.blockFilter());
+				searcher.setDeadline(m_deadline);
+				searcher.setCancellationToken(m_cancellation);
+				searcher.search(m_fingerprint.data() + task.begin, task.end - task.begin, target);
+				skippedBlocks += searcher.skippedBlockCount();
+			}
+		}
+		catch (const TimeoutExceeded &) {
+			if (!m_allowPartialResults) {
+				fail(std::current_exception());
+				return;
+			}
+			// Keep what was found so far, other threads stop after their current segment.
+			m_timedOut.storeRelease(1);
+		}
+		catch (...) {
+			fail(std::current_exception());
+			return;
+		}
+		m_reader->addSkippedBlocks(skippedBlocks);
+		QMutexLocker locker(&m_mutex);
+		if (m_aborted.loadAcquire()) {
+			return;
+		}
+		if (localHeavyHitters) {
+			m_heavyHitters->merge(*localHeavyHitters);
+		}
+		else {
+			localCollector.mergeInto(m_collector);
+		}
+	}
+
+	// True if the search ran out of time and the results are partial.
+	bool timedOut() const { return m_timedOut.loadAcquire(); }
+
+	// Major page faults taken by the pool threads.
+	uint64_t workerMajorFaults() const { return m_workerMajorFaults.loadAcquire(); }
+	void addWorkerMajorFaults(uint64_t count) { m_workerMajorFaults.fetchAndAddOrdered(count); }
+
+	void addWorker()
+	{
+		QMutexLocker locker(&m_mutex);
+		m_activeWorkers++;
+	}
+
+	void finishWorker()
+	{
+		QMutexLocker locker(&m_mutex);
+		if (--m_activeWorkers == 0) {
+			m_workersFinished.wakeAll();
+		}
+	}
+
+	void waitForWorkers()
+	{
+		QMutexLocker locker(&m_mutex);
+		while (m_activeWorkers > 0) {
+			m_workersFinished.wait(&m_mutex);
+		}
+		if (m_error) {
+			std::rethrow_exception(m_error);
+		}
+	}
+
+private:
+	void fail(std::exception_ptr error)
+	{
+		QMutexLocker locker(&m_mutex);
+		if (!m_error) {
+			m_error = error;
+		}
+		m_aborted.storeRelease(1);
+	}
+
+	IndexReader *m_reader;
+	std::vector<uint32_t> &m_fingerprint;
+	Collector *m_collector;
+	HeavyHittersCollector *m_heavyHitters;
+	std::vector<SearchTask> m_tasks;
+	QDeadlineTimer m_deadline;
+	CancellationTokenSharedPtr m_cancellation;
+	DocumentFilterSharedPtr m_filter;
+	bool m_allowPartialResults;
+	QAtomicInt m_nextTask;
+	QAtomicInt m_aborted;
+	QAtomicInt m_timedOut;
+	QAtomicInteger<quint64> m_workerMajorFaults;
+	QMutex m_mutex;
+	QWaitCondition m_workersFinished;
+	int m_activeWorkers;
+	std::exception_ptr m_error;
+};
+
+class ParallelSearchTask : public QRunnable
+{
+public:
+	ParallelSearchTask(ParallelSearch *search) : m_search(search) {}
+
+	void run() override
+	{
+		uint64_t majorFaults = majorPageFaults();
+		m_search->run();
+		m_search->addWorkerMajorFaults(majorPageFaults() - majorFaults);
+		m_search->finishWorker();
+	}
+
+private:
+	ParallelSearch *m_search;
+};
+
+}
+
 IndexReader::IndexReader(DirectorySharedPtr dir, const IndexInfo& info)
-	: m_dir(dir), m_info(info)
+	: m_dir(dir), m_info(info), m_searchThreads(1), m_allowPartialResults(false), m_partial(false),
+	  m_prefetchBlocks(false), m_approximate(false), m_approximateSearchThreshold(0),
+	  m_approximateSearchError(HeavyHittersCollector::DEFAULT_MAX_ERROR), m_frequentTermCutoff(0),
+	  m_frequentTermMode(DEMOTE_FREQUENT_TERMS), m_majorFaults(0)
 {
 }
 
 IndexReader::IndexReader(IndexSharedPtr index)
-	: m_dir(index->directory()), m_index(index)
+	: m_dir(index->directory()), m_index(index), m_allowPartialResults(false), m_partial(false),
+	  m_prefetchBlocks(false), m_approximate(false), m_approximateSearchThreshold(0),
+	  m_approximateSearchError(HeavyHittersCollector::DEFAULT_MAX_ERROR), m_frequentTermCutoff(0),
+	  m_frequentTermMode(DEMOTE_FREQUENT_TERMS), m_majorFaults(0)
 {
 	m_info = m_index->acquireInfo();
+	m_threadPool = m_index->threadPool();
+	m_searchThreads = m_index->searchThreads();
+	m_prefetchBlocks = m_index->prefetchBlocks();
+	m_approximateSearchThreshold = m_index->approximateSearchThreshold();
+	m_approximateSearchError = m_index->approximateSearchError();
+	m_frequentTermCutoff = m_index->frequentTermCutoff();
+	m_frequentTermMode = m_index->frequentTermMode();
+	m_blockCache = m_index->blockCache();
+	m_resultCache = m_index->resultCache();
+	m_singleFlight = m_index->singleFlight();
 }
 
 IndexReader::~IndexReader()
@@ -38,27 +375,343 @@ SegmentDataReader* IndexReader::segmentDataReader(const SegmentInfo& segment)
 	return new SegmentDataReader(m_dir->openFile(segment.dataFileName()), BLOCK_SIZE);
 }
 
+SegmentDataReaderSharedPtr IndexReader::sharedSegmentDataReader(const SegmentInfo& segment)
+{
+	SegmentDataReaderSharedPtr reader = segment.dataReader();
+	if (!reader) {
+		reader = SegmentDataReaderSharedPtr(segmentDataReader(segment));
+	}
+	return reader;
+}
+
 void IndexReader::search(const uint32_t* fingerprint, size_t length, Collector* collector, int64_t timeoutInMSecs)
 {
-    auto deadline = timeoutInMSecs > 0 ? (QDateTime::currentMSecsSinceEpoch() + timeoutInMSecs) : 0;
-    std::vector<uint32_t> fp(fingerprint, fingerprint + length);
+	auto deadline = makeDeadline(timeoutInMSecs);
+	m_partial = false;
+	m_majorFaults = 0;
+	uint64_t majorFaults = majorPageFaults();
+	defer {
+		addMajorFaults(majorPageFaults() - majorFaults);
+	};
+	DocumentFilterCollector filtered(collector, m_documentFilter.data());
+	if (m_documentFilter) {
+		collector = &filtered;
+	}
+	std::vector<uint32_t> fp(fingerprint, fingerprint + length);
+	std::sort(fp.begin(), fp.end());
+	removeStopTerms(fp);
+	std::vector<uint32_t> frequent;
+	if (m_frequentTermCutoff > 0) {
+		frequent = removeFrequentTerms(fp);
+	}
+	if (frequent.empty() || m_frequentTermMode == SKIP_FREQUENT_TERMS) {
+		searchTerms(fp, collector, deadline, 0);
+		return;
+	}
+	// The rare terms go first, the frequent ones can then only add to the scores of the documents they found.
+	searchTerms(fp, collector, deadline, frequent.size());
+	if (!m_partial) {
+		// Only the blocks that can contain the documents found so far are read.
+		searchTerms(frequent, collector, deadline, 0, true);
+	}
+}
+
+void IndexReader::searchExisting(const uint32_t *fingerprint, size_t length, Collector *collector, int64_t timeoutInMSecs)
+{
+	auto deadline = makeDeadline(timeoutInMSecs);
+	m_partial = false;
+	m_majorFaults = 0;
+	uint64_t majorFaults = majorPageFaults();
+	defer {
+		addMajorFaults(majorPageFaults() - majorFaults);
+	};
+	// The collector's documents already went through the document filter, there is no need to check them again.
+	std::vector<uint32_t> fp(fingerprint, fingerprint + length);
 	std::sort(fp.begin(), fp.end());
+	removeStopTerms(fp);
+	searchTerms(fp, collector, deadline, 0, true);
+}
+
+void IndexReader::searchTerms(std::vector<uint32_t> &fp, Collector *collector, const QDeadlineTimer &deadline, unsigned int maxScoreLater,
+	bool existingOnly)
+{
+	if (m_prefetchBlocks && !existingOnly) {
+		prefetchSegmentBlocks(fp);
+	}
 	const SegmentInfoList& segments = m_info.segments();
-	for (int i = 0; i < segments.size(); i++) {
-        if (deadline > 0) {
-            if (QDateTime::currentMSecsSinceEpoch() > deadline) {
-                throw TimeoutExceeded();
-            }
-        }
-		const SegmentInfo& s = segments.at(i);
-		SegmentSearcher searcher(s.index(), segmentDataReader(s), s.lastKey());
-		searcher.search(fp.data(), fp.size(), collector);
+	if (!existingOnly && m_searchThreads > 1 && m_threadPool && searchParallel(fp, collector, deadline, m_searchThreads)) {
+		return;
 	}
+	std::vector<int> order = searchOrder(segments);
+	// Highest score a document can get from the segments searched after each segment.
+	std::vector<unsigned int> maxScoreAfter(segments.size(), maxScoreLater);
+	for (int i = segments.size() - 1; i > 0; i--) {
+		maxScoreAfter[i - 1] = maxScoreAfter[i] + maxSegmentScore(fp, segments.at(order[i]));
+	}
+	size_t skippedBlocks = 0;
+	try {
+		for (int i = 0; i < segments.size(); i++) {
+			checkInterrupted(deadline, m_cancellation);
+			const SegmentInfo& s = segments.at(order[i]);
+			if (!overlapsSegment(fp, s)) {
+				continue;
+			}
+			SegmentSearcher searcher(s.index(), sharedSegmentDataReader(s), s.lastKey());
+			searcher.setBlockCache(m_blockCache, s.id());
+			searcher.setFilter(s.filter());
+			searcher.setBlockFilter(s.blockFilter());
+			searcher.setDeadline(deadline);
+			searcher.setCancellationToken(m_cancellation);
+			if (existingOnly) {
+				searcher.searchExisting(fp.data(), fp.size(), collector, maxScoreAfter[i]);
+			}
+			else {
+				searcher.searchWithPruning(fp.data(), fp.size(), collector, maxScoreAfter[i]);
+			}
+			skippedBlocks += searcher.skippedBlockCount();
+		}
+	}
+	catch (const TimeoutExceeded &) {
+		if (!m_allowPartialResults) {
+			throw;
+		}
+		m_partial = true;
+	}
+	catch (const SearchCancelled &) {
+		addCancelledSearch();
+		throw;
+	}
+	addSkippedBlocks(skippedBlocks);
+}
+
+uint64_t IndexReader::termFrequency(uint32_t term) const
+{
+	uint64_t frequency = 0;
+	for (const auto &s : m_info.segments()) {
+		if (s.termStats() && term >= s.firstKey() && term <= s.lastKey()) {
+			frequency += s.termStats()->postingCount(term);
+		}
+	}
+	return frequency;
+}
+
+void IndexReader::removeStopTerms(std::vector<uint32_t> &fingerprint) const
+{
+	// A key stopped in one segment could still have postings in older ones, it doesn't match in any.
+	for (const auto &s : m_info.segments()) {
+		SegmentTermStatsSharedPtr stats = s.termStats();
+		if (stats && !stats->stopKeys().empty()) {
+			fingerprint.erase(std::remove_if(fingerprint.begin(), fingerprint.end(), [&stats](uint32_t term) {
+				return stats->isStopKey(term);
+			}), fingerprint.end());
+		}
+	}
+}
+
+std::vector<uint32_t> IndexReader::removeFrequentTerms(std::vector<uint32_t> &fingerprint)
+{
+	std::vector<uint32_t> rare, frequent;
+	for (uint32_t term : fingerprint) {
+		if (termFrequency(term) > m_frequentTermCutoff) {
+			frequent.push_back(term);
+		}
+		else {
+			rare.push_back(term);
+		}
+	}
+	// A fingerprint made only of frequent terms is searched as it is, there is nothing better to go by.
+	if (frequent.empty() || rare.empty()) {
+		return std::vector<uint32_t>();
+	}
+	if (m_index) {
+		m_index->addFrequentTerms(frequent.size());
+	}
+	fingerprint.swap(rare);
+	return frequent;
+}
+
+void IndexReader::addSkippedBlocks(size_t count)
+{
+	if (m_index && count) {
+		m_index->addSkippedBlocks(count);
+	}
+}
+
+void IndexReader::addCancelledSearch()
+{
+	if (m_index) {
+		m_index->addCancelledSearch();
+	}
+}
+
+void IndexReader::addMajorFaults(uint64_t count)
+{
+	m_majorFaults += count;
+	if (m_index && count) {
+		m_index->addMajorFaults(count);
+	}
+}
+
+void IndexReader::prefetchSegmentBlocks(const std::vector<uint32_t> &fingerprint)
+{
+	for (const auto &s : m_info.segments()) {
+		// Only segments kept open are worth it, others would open the data file just for this.
+		SegmentDataReaderSharedPtr dataReader = s.dataReader();
+		if (!dataReader || !overlapsSegment(fingerprint, s)) {
+			continue;
+		}
+		SegmentSearcher searcher(s.index(), dataReader, s.lastKey());
+		searcher.setFilter(s.filter());
+		searcher.setBlockFilter(s.blockFilter());
+		searcher.prefetch(fingerprint.data(), fingerprint.size());
+	}
+}
+
+bool IndexReader::searchParallel(std::vector<uint32_t> &fingerprint, Collector *collector, QDeadlineTimer deadline, int numThreads)
+{
+	QThreadPool *pool = m_threadPool;
+	// Don't split the search into more parts than there are threads to run them.
+	numThreads = std::min(numThreads, 1 + std::max(0, pool->maxThreadCount() - pool->activeThreadCount()));
+	std::vector<SearchTask> tasks = planParallelSearch(fingerprint, m_info.segments(), numThreads);
+	if (numThreads < 2 || tasks.size() < 2) {
+		return false;
+	}
+	numThreads = std::min<size_t>(numThreads, tasks.size());
+	ParallelSearch search(this, fingerprint, collector, std::move(tasks), deadline);
+	for (int i = 1; i < numThreads; i++) {
+		// Only use threads that are free right now. The calling thread might be
+		// running in the same pool, so waiting for a queued task could deadlock.
+		auto task = new ParallelSearchTask(&search);
+		search.addWorker();
+		if (!pool->tryStart(task)) {
+			search.finishWorker();
+			delete task;
+			break;
+		}
+	}
+	search.run();
+	// The calling thread's own page faults are counted by search().
+	defer {
+		addMajorFaults(search.workerMajorFaults());
+	};
+	try {
+		search.waitForWorkers();
+	}
+	catch (const SearchCancelled &) {
+		addCancelledSearch();
+		throw;
+	}
+	m_partial = search.timedOut();
+	return true;
+}
+
+void IndexReader::searchBatch(const std::vector<std::vector<uint32_t>> &fingerprints, const std::vector<Collector *> &collectors, int64_t timeoutInMSecs)
+{
+	assert(fingerprints.size() == collectors.size());
+	auto deadline = makeDeadline(timeoutInMSecs);
+	m_partial = false;
+	m_majorFaults = 0;
+
+	// Merge all fingerprints into one sorted list of unique terms, each with a list of queries it belongs to.
+	// The stop keys don't match anything, like in search().
+	std::vector<std::pair<uint32_t, uint32_t>> items;
+	std::vector<uint32_t> fp;
+	for (size_t i = 0; i < fingerprints.size(); i++) {
+		fp = fingerprints[i];
+		removeStopTerms(fp);
+		for (uint32_t term : fp) {
+			items.emplace_back(term, i);
+		}
+	}
+	std::sort(items.begin(), items.end());
+	items.erase(std::unique(items.begin(), items.end()), items.end());
+	std::vector<uint32_t> terms, offsets, queries;
+	queries.reserve(items.size());
+	for (const auto &item : items) {
+		if (terms.empty() || terms.back() != item.first) {
+			terms.push_back(item.first);
+			offsets.push_back(queries.size());
+		}
+		queries.push_back(item.second);
+	}
+	offsets.push_back(queries.size());
+	if (m_prefetchBlocks) {
+		prefetchSegmentBlocks(terms);
+	}
+
+	std::vector<DocumentFilterCollector> filtered;
+	auto targets = filterCollectors(collectors, m_documentFilter.data(), filtered);
+	searchSegments(deadline, [&](const SegmentInfo &segment, SegmentSearcher &searcher) {
+		if (overlapsSegment(terms, segment)) {
+			searcher.searchBatch(terms.data(), terms.size(), offsets.data(), queries.data(), targets.data());
+		}
+	});
+}
+
+void IndexReader::searchInterleaved(const std::vector<std::vector<uint32_t>> &fingerprints, const std::vector<Collector *> &collectors, int64_t timeoutInMSecs)
+{
+	assert(fingerprints.size() == collectors.size());
+	auto deadline = makeDeadline(timeoutInMSecs);
+	m_partial = false;
+	m_majorFaults = 0;
+
+	std::vector<std::vector<uint32_t>> sortedFingerprints(fingerprints);
+	for (auto &fingerprint : sortedFingerprints) {
+		std::sort(fingerprint.begin(), fingerprint.end());
+		removeStopTerms(fingerprint);
+	}
+
+	std::vector<DocumentFilterCollector> filtered;
+	auto targets = filterCollectors(collectors, m_documentFilter.data(), filtered);
+	searchSegments(deadline, [&](const SegmentInfo &segment, SegmentSearcher &searcher) {
+		if (segment.blockCount() > 0) {
+			searcher.searchInterleaved(sortedFingerprints, targets.data());
+		}
+	});
+}
+
+template <typename SearchFunc>
+void IndexReader::searchSegments(const QDeadlineTimer &deadline, SearchFunc search)
+{
+	uint64_t majorFaults = majorPageFaults();
+	defer {
+		addMajorFaults(majorPageFaults() - majorFaults);
+	};
+	const SegmentInfoList& segments = m_info.segments();
+	std::vector<int> order = searchOrder(segments);
+	size_t skippedBlocks = 0;
+	try {
+		for (int i : order) {
+			checkInterrupted(deadline, m_cancellation);
+			const SegmentInfo& s = segments.at(i);
+			SegmentSearcher searcher(s.index(), sharedSegmentDataReader(s), s.lastKey());
+			searcher.setBlockCache(m_blockCache, s.id());
+			searcher.setFilter(s.filter());
+			searcher.setBlockFilter(s.blockFilter());
+			searcher.setDeadline(deadline);
+			searcher.setCancellationToken(m_cancellation);
+			search(s, searcher);
+			skippedBlocks += searcher.skippedBlockCount();
+		}
+	}
+	catch (const TimeoutExceeded &) {
+		if (!m_allowPartialResults) {
+			throw;
+		}
+		m_partial = true;
+	}
+	catch (const SearchCancelled &) {
+		addCancelledSearch();
+		throw;
+	}
+	addSkippedBlocks(skippedBlocks);
 }
 
 std::vector<SearchResult> IndexReader::search(const uint32_t* fingerprint, size_t length, int64_t timeoutInMSecs)
 {
+    // Neither cached nor shared with identical searches, this always searches the current segments.
     TopHitsCollector collector(1000);
+    collector.reserve(length);
     search(fingerprint, length, &collector, timeoutInMSecs);
     std::vector<SearchResult> results;
     for (const auto result : collector.topResults()) {
@@ -66,3 +719,166 @@ std::vector<SearchResult> IndexReader::search(const uint32_t* fingerprint, size_
     }
     return results;
 }
+
+QList<Result> IndexReader::searchTopHits(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent, int64_t timeoutInMSecs, bool useCache)
+{
+	// The document filter is not part of the cache key, filtered searches always run on their own.
+	bool cacheEnabled = m_resultCache && m_resultCache->isEnabled() && !m_documentFilter;
+	bool collapseEnabled = m_singleFlight && m_singleFlight->isEnabled() && !m_documentFilter;
+	if (!cacheEnabled && !collapseEnabled) {
+		return searchTopHitsUncached(fingerprint, length, maxResults, topScorePercent, timeoutInMSecs);
+	}
+	SearchResultCacheKey key(fingerprint, length, maxResults, topScorePercent, m_info.revision());
+	QList<Result> results;
+	if (cacheEnabled && useCache && m_resultCache->get(key, &results, &m_approximate)) {
+		m_partial = false;
+		return results;
+	}
+
+	// Wait for an identical search if there is one in progress. If it fails,
+	// one of its waiters runs the search again and the others wait for that one.
+	auto deadline = makeDeadline(timeoutInMSecs);
+	SearchSingleFlight::CallSharedPtr call;
+	while (collapseEnabled && !m_singleFlight->start(key, &call)) {
+		try {
+			if (m_singleFlight->wait(call, deadline, m_cancellation, &results, &m_approximate)) {
+				m_partial = false;
+				m_majorFaults = 0;
+				return results;
+			}
+		}
+		catch (const TimeoutExceeded &) {
+			if (!m_allowPartialResults) {
+				throw;
+			}
+			m_partial = true;
+			return QList<Result>();
+		}
+		catch (const SearchCancelled &) {
+			addCancelledSearch();
+			throw;
+		}
+	}
+
+	try {
+		results = searchTopHitsUncached(key.terms().data(), key.terms().size(), maxResults, topScorePercent, remainingTimeout(deadline));
+	}
+	catch (...) {
+		if (call) {
+			m_singleFlight->finish(call, nullptr);
+		}
+		throw;
+	}
+	// Partial results are not shared and not cached, the next search might have more time.
+	if (call) {
+		m_singleFlight->finish(call, m_partial ? nullptr : &results, m_approximate);
+	}
+	if (cacheEnabled && !m_partial) {
+		m_resultCache->insert(key, results, m_approximate);
+	}
+	return results;
+}
+
+QList<Result> IndexReader::searchTopHitsUncached(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent, int64_t timeoutInMSecs)
+{
+	// The estimate doesn't know how many postings the document filter leaves, filtered searches stay exact.
+	m_approximate = m_approximateSearchThreshold > 0 && !m_documentFilter &&
+		estimatePostings(fingerprint, length) > m_approximateSearchThreshold;
+	if (m_approximate) {
+		if (m_index) {
+			m_index->addApproximateSearch();
+		}
+		HeavyHittersCollector collector(maxResults, topScorePercent, m_approximateSearchError);
+		search(fingerprint, length, &collector, timeoutInMSecs);
+		return collector.topResults();
+	}
+	TopHitsCollector collector(maxResults, topScorePercent);
+	collector.reserve(length);
+	search(fingerprint, length, &collector, timeoutInMSecs);
+	return collector.topResults();
+}
+
+size_t IndexReader::estimatePostings(const uint32_t *fingerprint, size_t length)
+{
+	std::vector<uint32_t> fp(fingerprint, fingerprint + length);
+	std::sort(fp.begin(), fp.end());
+	size_t postings = 0;
+	for (const auto &s : m_info.segments()) {
+		if (!overlapsSegment(fp, s)) {
+			continue;
+		}
+		SegmentSearcher searcher(s.index(), SegmentDataReaderSharedPtr(), s.lastKey());
+		searcher.setFilter(s.filter());
+		postings += searcher.estimatePostings(fp.data(), fp.size());
+	}
+	return postings;
+}
+
+QList<Result> IndexReader::searchSampled(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent,
+	size_t sampleStride, size_t numCandidates, int64_t timeoutInMSecs)
+{
+	if (sampleStride == 0) {
+		sampleStride = std::max<size_t>(1, length / SAMPLED_SEARCH_TERMS);
+	}
+	if (numCandidates == 0) {
+		numCandidates = std::max<size_t>(MIN_SAMPLED_SEARCH_CANDIDATES, maxResults * 4);
+	}
+	auto deadline = makeDeadline(timeoutInMSecs);
+
+	std::vector<uint32_t> sample, rest;
+	sample.reserve(length / sampleStride + 1);
+	rest.reserve(length - length / sampleStride);
+	for (size_t i = 0; i < length; i++) {
+		(i % sampleStride == 0 ? sample : rest).push_back(fingerprint[i]);
+	}
+
+	TopHitsCollector candidates(numCandidates);
+	candidates.reserve(sample.size());
+	search(sample.data(), sample.size(), &candidates, timeoutInMSecs);
+	bool partial = m_partial;
+	uint64_t majorFaults = m_majorFaults;
+
+	// The candidates already have the counts for the sampled items, add the rest.
+	TopHitsCollector collector(maxResults, topScorePercent);
+	for (const auto &candidate : candidates.topResults()) {
+		collector.collectCount(candidate.id(), candidate.score());
+	}
+	if (!rest.empty() && !partial) {
+		searchExisting(rest.data(), rest.size(), &collector, remainingTimeout(deadline));
+		partial = partial || m_partial;
+		majorFaults += m_majorFaults;
+	}
+	m_partial = partial;
+	m_majorFaults = majorFaults;
+	return collector.topResults();
+}
+
+QList<Result> IndexReader::searchExpanded(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent,
+	int maxDistance, uint32_t bitMask, int64_t timeoutInMSecs)
+{
+	maxDistance = std::min(maxDistance, MAX_EXPANSION_DISTANCE);
+	if (bitMask == 0) {
+		bitMask = 0xFFFFFFFF;
+	}
+	TopHitsCollector collector(maxResults, topScorePercent);
+	collector.reserve(length);
+
+	// Repeated items count once, like in search().
+	std::vector<uint32_t> items(fingerprint, fingerprint + length);
+	std::sort(items.begin(), items.end());
+	items.erase(std::unique(items.begin(), items.end()), items.end());
+
+	// Every item becomes a query of its own, so that its variants share a collector.
+	std::vector<std::vector<uint32_t>> variants(items.size());
+	std::vector<FoldedHitsCollector> folded;
+	std::vector<Collector *> collectors;
+	folded.reserve(items.size());
+	collectors.reserve(items.size());
+	for (size_t i = 0; i < items.size(); i++) {
+		addHammingNeighbours(items[i], maxDistance, bitMask, variants[i]);
+		folded.emplace_back(&collector);
+		collectors.push_back(&folded.back());
+	}
+	searchBatch(variants, collectors, timeoutInMSecs);
+	return collector.topResults();
+}
@@ -4,10 +4,18 @@
 #ifndef ACOUSTID_INDEX_READER_H_
 #define ACOUSTID_INDEX_READER_H_
 
+#include <QDeadlineTimer>
+#include <QPointer>
+#include <QThreadPool>
 #include "common.h"
+#include "block_cache.h"
+#include "document_filter.h"
+#include "search_result_cache.h"
+#include "search_single_flight.h"
 #include "segment_index.h"
 #include "index.h"
 #include "index_info.h"
+#include "util/cancellation_token.h"
 
 namespace Acoustid {
 
@@ -29,15 +37,178 @@ public:
 		return m_index;
 	}
 
+	QThreadPool *threadPool() const { return m_threadPool; }
+	void setThreadPool(QThreadPool *pool) { m_threadPool = pool; }
+
+	int searchThreads() const { return m_searchThreads; }
+	void setSearchThreads(int numThreads) { m_searchThreads = numThreads; }
+
+	// When enabled, a search that runs out of time returns the hits it has found
+	// so far instead of throwing TimeoutExceeded.
+	bool allowPartialResults() const { return m_allowPartialResults; }
+	void setAllowPartialResults(bool allow) { m_allowPartialResults = allow; }
+
+	// Returns true if the last search ran out of time and its results are partial.
+	bool isPartial() const { return m_partial; }
+
+	// When enabled, the data blocks a search will read are requested from the OS
+	// before searching, so that the page faults of a memory mapped index overlap.
+	bool prefetchBlocks() const { return m_prefetchBlocks; }
+	void setPrefetchBlocks(bool prefetch) { m_prefetchBlocks = prefetch; }
+
+	// Top hits searches expected to read more postings than the threshold count their hits
+	// approximately with HeavyHittersCollector, in bounded memory. Zero means never. Searches
+	// with a document filter are always exact.
+	size_t approximateSearchThreshold() const { return m_approximateSearchThreshold; }
+	void setApproximateSearchThreshold(size_t threshold) { m_approximateSearchThreshold = threshold; }
+
+	// Error bound of approximate searches, as a fraction of all hits.
+	double approximateSearchError() const { return m_approximateSearchError; }
+	void setApproximateSearchError(double maxError) { m_approximateSearchError = maxError; }
+
+	// Terms found in more documents than the cutoff, according to the segment term statistics, are
+	// skipped or demoted, see FrequentTermMode. Zero cutoff, the default, means that all terms are searched.
+	size_t frequentTermCutoff() const { return m_frequentTermCutoff; }
+	void setFrequentTermCutoff(size_t cutoff) { m_frequentTermCutoff = cutoff; }
+	FrequentTermMode frequentTermMode() const { return m_frequentTermMode; }
+	void setFrequentTermMode(FrequentTermMode mode) { m_frequentTermMode = mode; }
+
+	// Number of documents containing the term, if it's frequent enough to have statistics in any segment.
+	uint64_t termFrequency(uint32_t term) const;
+
+	// Returns true if the last top hits search counted its hits approximately.
+	bool isApproximate() const { return m_approximate; }
+
+	// Number of major page faults taken by the last search, on all threads.
+	uint64_t majorFaultCount() const { return m_majorFaults; }
+
+	// Searches only count hits of the documents matching the filter, the others never reach
+	// the collectors. A filter that matches all documents is the same as no filter.
+	DocumentFilterSharedPtr documentFilter() const { return m_documentFilter; }
+	void setDocumentFilter(DocumentFilterSharedPtr filter)
+	{
+		m_documentFilter = filter && !filter->matchesAll() ? filter : DocumentFilterSharedPtr();
+	}
+
+	// Searches stop with SearchCancelled soon after the token is cancelled.
+	CancellationTokenSharedPtr cancellationToken() const { return m_cancellation; }
+	void setCancellationToken(CancellationTokenSharedPtr cancellation) { m_cancellation = cancellation; }
+
 	void search(const uint32_t *fingerprint, size_t length, Collector *collector, int64_t timeoutInMSecs = 0);
     std::vector<SearchResult> search(const uint32_t *fingerprint, size_t length, int64_t timeoutInMSecs = 0);
 
+	// Search for the top hits, using the index's result cache if it's enabled.
+	// With useCache set to false, cached results are ignored, but the fresh ones are still stored.
+	// If an identical search is already running, this waits for its results instead of searching.
+	QList<Result> searchTopHits(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent = 0, int64_t timeoutInMSecs = 0, bool useCache = true);
+
+	// Estimate the number of postings a search for the fingerprint would read, from the block
+	// ranges of its items in all segments.
+	size_t estimatePostings(const uint32_t *fingerprint, size_t length);
+
+	// Search in two phases, trading a little recall for speed on long fingerprints. Every
+	// `sampleStride`-th item of the fingerprint is searched first, then the best `numCandidates`
+	// documents are rescored with the remaining items, so their scores are exact.
+	// Zero `sampleStride` or `numCandidates` picks a value based on the fingerprint length
+	// or the number of results.
+	QList<Result> searchSampled(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent = 0,
+		size_t sampleStride = 0, size_t numCandidates = 0, int64_t timeoutInMSecs = 0);
+
+	// Search tolerating bit errors in the fingerprint items. Each item also matches items that
+	// differ from it in at most `maxDistance` of the bits set in `bitMask`, but a document still
+	// scores at most once per item. A zero `bitMask` means all bits, the same as in the server
+	// protocols. All variants are searched in one pass over the segments.
+	QList<Result> searchExpanded(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent = 0,
+		int maxDistance = 1, uint32_t bitMask = 0xFFFFFFFF, int64_t timeoutInMSecs = 0);
+
+	// Search for many fingerprints in one pass over the segments, results for
+	// fingerprints[i] are passed to collectors[i].
+	void searchBatch(const std::vector<std::vector<uint32_t>> &fingerprints, const std::vector<Collector *> &collectors, int64_t timeoutInMSecs = 0);
+
+	// Search for many fingerprints, each on its own, but interleaved with each other, so that
+	// the memory loads of one overlap with the work on the others. Results for fingerprints[i]
+	// are passed to collectors[i].
+	void searchInterleaved(const std::vector<std::vector<uint32_t>> &fingerprints, const std::vector<Collector *> &collectors, int64_t timeoutInMSecs = 0);
+
+	BlockCacheSharedPtr blockCache() const { return m_blockCache; }
+
 	SegmentDataReader* segmentDataReader(const SegmentInfo& segment);
 
+	// Returns the reader kept open by the segment, or opens a new one if there is none.
+	SegmentDataReaderSharedPtr sharedSegmentDataReader(const SegmentInfo& segment);
+
+	// Add to the index statistics of blocks skipped by the block filters.
+	void addSkippedBlocks(size_t count);
+
+	// Add to the index statistics of searches stopped by their cancellation token.
+	void addCancelledSearch();
+
+	// Add to the major page faults of the last search and to the index statistics.
+	void addMajorFaults(uint64_t count);
+
+	// Number of fingerprint items searched in the first phase of searchSampled() by default.
+	static const size_t SAMPLED_SEARCH_TERMS = 128;
+	// Minimum number of candidates rescored by searchSampled() by default.
+	static const size_t MIN_SAMPLED_SEARCH_CANDIDATES = 100;
+	// Minimum number of blocks per key range when a segment is searched by multiple threads.
+	static const size_t MIN_PARTITION_BLOCKS = 128;
+	// Highest Hamming distance supported by searchExpanded(), larger values are clamped.
+	static const int MAX_EXPANSION_DISTANCE = 2;
+
 protected:
+	// Search the segments on multiple threads, splitting large segments into key ranges.
+	// Returns false without searching if the search can't be split or there are no free threads.
+	// The threads don't prune, each of them only sees a part of any document's hits, which
+	// can't tell whether the document is going to make it into the results. A HeavyHittersCollector
+	// gets one of its own kind on every thread, so approximate searches stay in bounded memory.
+	bool searchParallel(std::vector<uint32_t> &fingerprint, Collector *collector, QDeadlineTimer deadline, int numThreads);
+
+	// Search for the sorted terms in all segments. Documents can get up to `maxScoreLater` more
+	// hits from terms searched after these, so pruning has to leave room for them. With `existingOnly`
+	// only the documents the collector already has are counted, on this thread.
+	void searchTerms(std::vector<uint32_t> &fp, Collector *collector, const QDeadlineTimer &deadline, unsigned int maxScoreLater,
+		bool existingOnly = false);
+
+	// Add the hits of the fingerprint to the documents the collector already has. Only the blocks
+	// that can contain those documents are read, so this is much cheaper than a full search.
+	void searchExisting(const uint32_t *fingerprint, size_t length, Collector *collector, int64_t timeoutInMSecs);
+
+	// Remove the terms that are stop keys in any segment from the sorted fingerprint.
+	void removeStopTerms(std::vector<uint32_t> &fingerprint) const;
+
+	// Move the terms above the frequent term cutoff out of the sorted fingerprint and return them.
+	std::vector<uint32_t> removeFrequentTerms(std::vector<uint32_t> &fingerprint);
+
+	// Search for the top hits with an exact or approximate collector, depending on the estimated postings.
+	QList<Result> searchTopHitsUncached(const uint32_t *fingerprint, size_t length, size_t maxResults, int topScorePercent, int64_t timeoutInMSecs);
+
+	// Request the data blocks that a search for the sorted fingerprint will read in all segments.
+	void prefetchSegmentBlocks(const std::vector<uint32_t> &fingerprint);
+
+	// Run the search function on all segments, with the segment searcher set up for the reader's
+	// caches, deadline and cancellation token.
+	template <typename SearchFunc>
+	void searchSegments(const QDeadlineTimer &deadline, SearchFunc search);
+
 	DirectorySharedPtr m_dir;
 	IndexInfo m_info;
 	IndexSharedPtr m_index;
+	QPointer<QThreadPool> m_threadPool;
+	int m_searchThreads;
+	bool m_allowPartialResults;
+	bool m_partial;
+	bool m_prefetchBlocks;
+	bool m_approximate;
+	size_t m_approximateSearchThreshold;
+	double m_approximateSearchError;
+	size_t m_frequentTermCutoff;
+	FrequentTermMode m_frequentTermMode;
+	uint64_t m_majorFaults;
+	CancellationTokenSharedPtr m_cancellation;
+	DocumentFilterSharedPtr m_documentFilter;
+	BlockCacheSharedPtr m_blockCache;
+	SearchResultCacheSharedPtr m_resultCache;
+	SearchSingleFlightSharedPtr m_singleFlight;
 };
 
 }
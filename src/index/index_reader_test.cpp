@@ -2,7 +2,9 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <gtest/gtest.h>
+#include <QThread>
 #include "util/test_utils.h"
+#include "store/fs_directory.h"
 #include "store/ram_directory.h"
 #include "store/input_stream.h"
 #include "store/output_stream.h"
@@ -10,6 +12,7 @@
 #include "index.h"
 #include "index_writer.h"
 #include "index_reader.h"
+#include "segment_searcher.h"
 
 using namespace Acoustid;
 
@@ -44,3 +47,1086 @@ TEST(IndexReaderTest, Search)
 	}
 }
 
+
+TEST(IndexReaderTest, SearchParallel)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	{
+		auto writer = index->openWriter();
+		for (uint32_t i = 0; i < 20; i++) {
+			uint32_t fp[] = { 1, 2 + i, 100 + i * 2, 200 };
+			writer->addDocument(i + 1, fp, 4);
+			writer->commit();
+		}
+	}
+
+	uint32_t query[] = { 1, 5, 106, 200 };
+
+	IndexReader reader(index);
+	TopHitsCollector expected(100);
+	reader.search(query, 4, &expected);
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(4);
+	index->setThreadPool(&pool);
+	index->setSearchThreads(4);
+
+	IndexReader parallelReader(index);
+	ASSERT_EQ(&pool, parallelReader.threadPool());
+	ASSERT_EQ(4, parallelReader.searchThreads());
+	TopHitsCollector collector(100);
+	parallelReader.search(query, 4, &collector);
+
+	auto expectedResults = expected.topResults();
+	auto results = collector.topResults();
+	ASSERT_EQ(20, results.size());
+	ASSERT_EQ(expectedResults.size(), results.size());
+	ASSERT_EQ(4, results.at(0).id());
+	ASSERT_EQ(4, results.at(0).score());
+	QHash<uint32_t, double> expectedScores;
+	for (const auto &result : expectedResults) {
+		expectedScores[result.id()] = result.score();
+	}
+	for (const auto &result : results) {
+		ASSERT_EQ(expectedScores.value(result.id()), result.score());
+	}
+}
+
+TEST(IndexReaderTest, SearchParallelPartitions)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	// One segment with enough blocks to be split between threads.
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 10000; id++) {
+			std::vector<uint32_t> fp;
+			for (uint32_t i = 0; i < 20; i++) {
+				fp.push_back((id * 7919 + i * 104729) % 100000);
+			}
+			writer->addDocument(id, fp.data(), fp.size());
+		}
+		writer->optimize();
+		writer->commit();
+	}
+	IndexInfo info = index->info();
+	ASSERT_EQ(1, info.segments().size());
+	const SegmentInfo &segment = info.segments().at(0);
+	ASSERT_LE(4 * IndexReader::MIN_PARTITION_BLOCKS, segment.blockCount());
+
+	std::vector<uint32_t> query;
+	for (uint32_t i = 0; i < 200; i++) {
+		query.push_back((7919 * 3 + i * 104729) % 100000);
+		query.push_back(i * 500);
+	}
+	std::sort(query.begin(), query.end());
+
+	SegmentSearcher searcher(segment.index(), segment.dataReader(), segment.lastKey());
+	auto bounds = searcher.partition(query.data(), query.size(), 4);
+	ASSERT_EQ(5, bounds.size());
+	ASSERT_EQ(0, bounds.front());
+	ASSERT_EQ(query.size(), bounds.back());
+	for (size_t k = 1; k < bounds.size(); k++) {
+		ASSERT_LT(bounds[k - 1], bounds[k]);
+		ASSERT_NE(query[bounds[k] - 1], query[bounds[k]]);
+	}
+
+	IndexReader reader(index);
+	TopHitsCollector expected(100);
+	reader.search(query.data(), query.size(), &expected);
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(4);
+	index->setThreadPool(&pool);
+	index->setSearchThreads(4);
+
+	IndexReader parallelReader(index);
+	TopHitsCollector collector(100);
+	parallelReader.search(query.data(), query.size(), &collector);
+
+	auto expectedResults = expected.topResults();
+	auto results = collector.topResults();
+	ASSERT_EQ(100, results.size());
+	ASSERT_EQ(expectedResults.size(), results.size());
+	for (int i = 0; i < results.size(); i++) {
+		ASSERT_EQ(expectedResults.at(i).id(), results.at(i).id());
+		ASSERT_EQ(expectedResults.at(i).score(), results.at(i).score());
+	}
+}
+
+TEST(IndexReaderTest, SearchWithBlockCache)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+	index->setBlockCacheSize(1024 * 1024);
+
+	uint32_t fp1[] = { 7, 9, 12 };
+	uint32_t fp2[] = { 7, 9, 11 };
+
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1, 3);
+		writer->addDocument(2, fp2, 3);
+		writer->commit();
+	}
+
+	for (int i = 0; i < 2; i++) {
+		IndexReader reader(index);
+		TopHitsCollector collector(100);
+		reader.search(fp1, 3, &collector);
+		ASSERT_EQ(2, collector.topResults().size());
+		ASSERT_EQ(1, collector.topResults().at(0).id());
+		ASSERT_EQ(3, collector.topResults().at(0).score());
+		ASSERT_EQ(2, collector.topResults().at(1).id());
+		ASSERT_EQ(2, collector.topResults().at(1).score());
+	}
+
+	ASSERT_EQ(1, index->blockCache()->missCount());
+	ASSERT_EQ(1, index->blockCache()->hitCount());
+}
+
+TEST(IndexReaderTest, SharedSegmentDataReaders)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	uint32_t fp1[] = { 7, 9, 12 };
+	uint32_t fp2[] = { 7, 9, 11 };
+
+	{
+		IndexSharedPtr index(new Index(dir, true));
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1, 3);
+		writer->commit();
+		writer->addDocument(2, fp2, 3);
+		writer->commit();
+		for (const auto &segment : writer->info().segments()) {
+			ASSERT_FALSE(segment.dataReader().isNull());
+		}
+	}
+
+	IndexSharedPtr index(new Index(dir));
+	IndexReader reader(index);
+	ASSERT_FALSE(reader.info().segments().isEmpty());
+	for (const auto &segment : reader.info().segments()) {
+		ASSERT_FALSE(segment.dataReader().isNull());
+		ASSERT_EQ(segment.dataReader(), reader.sharedSegmentDataReader(segment));
+	}
+
+	TopHitsCollector collector(100);
+	reader.search(fp1, 3, &collector);
+	ASSERT_EQ(2, collector.topResults().size());
+	ASSERT_EQ(1, collector.topResults().at(0).id());
+	ASSERT_EQ(3, collector.topResults().at(0).score());
+	ASSERT_EQ(2, collector.topResults().at(1).id());
+	ASSERT_EQ(2, collector.topResults().at(1).score());
+}
+
+TEST(IndexReaderTest, SearchWithSegmentFilter)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+	index->setBlockCacheSize(1024 * 1024);
+
+	uint32_t fp1[] = { 7, 9, 12 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1, 3);
+		writer->commit();
+	}
+
+	IndexReader reader(index);
+	ASSERT_EQ(1, reader.info().segmentCount());
+	const SegmentInfo &segment = reader.info().segment(0);
+	ASSERT_FALSE(segment.filter().isNull());
+	ASSERT_TRUE(dir->fileExists(segment.filterFileName()));
+	ASSERT_EQ(7, segment.firstKey());
+	ASSERT_EQ(12, segment.lastKey());
+
+	// Neither the filter nor the key range match, no blocks are read.
+	uint32_t fp2[] = { 1, 8, 10, 11, 100 };
+	TopHitsCollector collector(100);
+	reader.search(fp2, 5, &collector);
+	ASSERT_EQ(0, collector.topResults().size());
+	ASSERT_EQ(0, index->blockCache()->missCount());
+
+	reader.search(fp1, 3, &collector);
+	ASSERT_EQ(1, collector.topResults().size());
+	ASSERT_EQ(3, collector.topResults().at(0).score());
+
+	// The filter is loaded with the index.
+	IndexSharedPtr index2(new Index(dir));
+	IndexReader reader2(index2);
+	ASSERT_FALSE(reader2.info().segment(0).filter().isNull());
+	ASSERT_EQ(7, reader2.info().segment(0).firstKey());
+}
+
+TEST(IndexReaderTest, SearchBatch)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp1[] = { 7, 9, 12 };
+	uint32_t fp2[] = { 7, 9, 11 };
+	uint32_t fp3[] = { 3, 11, 20 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1, 3);
+		writer->addDocument(2, fp2, 3);
+		writer->commit();
+		writer->addDocument(3, fp3, 3);
+		writer->commit();
+	}
+
+	std::vector<std::vector<uint32_t>> queries = {
+		{ 7, 9, 12 },
+		{ 11, 11, 20 },
+		{ 100, 200 },
+		{ 9, 3 },
+	};
+
+	TopHitsCollector c1(10), c2(10), c3(10), c4(10);
+	std::vector<Collector *> collectors = { &c1, &c2, &c3, &c4 };
+	IndexReader reader(index);
+	reader.searchBatch(queries, collectors);
+
+	for (size_t i = 0; i < queries.size(); i++) {
+		TopHitsCollector expected(10);
+		reader.search(queries[i].data(), queries[i].size(), &expected);
+		auto expectedResults = expected.topResults();
+		auto results = static_cast<TopHitsCollector *>(collectors[i])->topResults();
+		ASSERT_EQ(expectedResults.size(), results.size()) << "query " << i;
+		for (int j = 0; j < results.size(); j++) {
+			ASSERT_EQ(expectedResults.at(j).id(), results.at(j).id()) << "query " << i;
+			ASSERT_EQ(expectedResults.at(j).score(), results.at(j).score()) << "query " << i;
+		}
+	}
+
+	ASSERT_EQ(2, c1.topResults().size());
+	ASSERT_EQ(1, c1.topResults().at(0).id());
+	ASSERT_EQ(3, c1.topResults().at(0).score());
+	ASSERT_EQ(2, c2.topResults().size());
+	ASSERT_EQ(3, c2.topResults().at(0).id());
+	ASSERT_EQ(2, c2.topResults().at(0).score());
+	ASSERT_EQ(0, c3.topResults().size());
+	ASSERT_EQ(3, c4.topResults().size());
+}
+
+TEST(IndexReaderTest, SearchInterleaved)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	// Enough documents for many blocks in a few segments.
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 600; id++) {
+			std::vector<uint32_t> fp;
+			for (uint32_t i = 0; i < 20; i++) {
+				fp.push_back((id * 7 + i * 13) % 1000);
+			}
+			writer->addDocument(id, fp.data(), fp.size());
+			if (id % 200 == 0) {
+				writer->commit();
+			}
+		}
+	}
+
+	// More queries than are searched at the same time, including ones with no hits.
+	std::vector<std::vector<uint32_t>> queries;
+	for (uint32_t q = 0; q < 40; q++) {
+		std::vector<uint32_t> fp;
+		for (uint32_t i = 0; i < 10; i++) {
+			fp.push_back(q % 5 == 0 ? 5000 + i : (q * 31 + i * 13) % 1000);
+		}
+		queries.push_back(fp);
+	}
+
+	std::vector<std::unique_ptr<TopHitsCollector>> collectors;
+	std::vector<Collector *> collectorPtrs;
+	for (size_t i = 0; i < queries.size(); i++) {
+		collectors.emplace_back(new TopHitsCollector(10));
+		collectorPtrs.push_back(collectors.back().get());
+	}
+	IndexReader reader(index);
+	reader.searchInterleaved(queries, collectorPtrs);
+
+	for (size_t i = 0; i < queries.size(); i++) {
+		TopHitsCollector expected(10);
+		reader.search(queries[i].data(), queries[i].size(), &expected);
+		auto expectedResults = expected.topResults();
+		auto results = collectors[i]->topResults();
+		ASSERT_EQ(expectedResults.size(), results.size()) << "query " << i;
+		for (int j = 0; j < results.size(); j++) {
+			ASSERT_EQ(expectedResults.at(j).id(), results.at(j).id()) << "query " << i;
+			ASSERT_EQ(expectedResults.at(j).score(), results.at(j).score()) << "query " << i;
+		}
+	}
+	ASSERT_EQ(0, collectors[0]->topResults().size());
+	ASSERT_EQ(10, collectors[1]->topResults().size());
+}
+
+namespace {
+
+// Counts the hits that were only collected for already known documents.
+class PruningTopHitsCollector : public TopHitsCollector
+{
+public:
+	PruningTopHitsCollector(size_t numHits) : TopHitsCollector(numHits), m_existingHits(0) {}
+	void collectExisting(uint32_t id) override { m_existingHits++; TopHitsCollector::collectExisting(id); }
+	size_t existingHits() const { return m_existingHits; }
+private:
+	size_t m_existingHits;
+};
+
+// Never prunes anything, used as a reference.
+class ExhaustiveTopHitsCollector : public TopHitsCollector
+{
+public:
+	ExhaustiveTopHitsCollector(size_t numHits) : TopHitsCollector(numHits) {}
+	unsigned int minCompetitiveScore() override { return 0; }
+};
+
+}
+
+TEST(IndexReaderTest, SearchWithPruning)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	{
+		auto writer = index->openWriter();
+		srand(1234);
+		for (uint32_t i = 0; i < 2000; i++) {
+			std::vector<uint32_t> fp;
+			for (uint32_t j = 0; j < 20; j++) {
+				fp.push_back(rand() % 200);
+			}
+			writer->addDocument(i + 1, fp.data(), fp.size());
+			if (i % 500 == 499) {
+				writer->commit();
+			}
+		}
+		// Documents that match the query very well.
+		for (uint32_t i = 0; i < 5; i++) {
+			uint32_t fp[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100 };
+			writer->addDocument(5000 + i, fp, 10 - i);
+		}
+		writer->commit();
+	}
+
+	uint32_t query[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100 };
+
+	IndexReader reader(index);
+	ExhaustiveTopHitsCollector expected(3);
+	reader.search(query, 10, &expected);
+	PruningTopHitsCollector collector(3);
+	reader.search(query, 10, &collector);
+
+	auto expectedResults = expected.topResults();
+	auto results = collector.topResults();
+	ASSERT_EQ(3, results.size());
+	ASSERT_EQ(expectedResults.size(), results.size());
+	for (int i = 0; i < results.size(); i++) {
+		ASSERT_EQ(expectedResults.at(i).id(), results.at(i).id());
+		ASSERT_EQ(expectedResults.at(i).score(), results.at(i).score());
+	}
+	ASSERT_LT(0, collector.existingHits());
+}
+
+TEST(IndexReaderTest, SearchWithPruningSkipsBlocks)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t query[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 1000 };
+	{
+		auto writer = index->openWriter();
+		// Term 1000 is in every document, its postings span many blocks.
+		for (uint32_t id = 1; id <= 5000; id++) {
+			writer->addDocument(id, query + 10, 1);
+		}
+		for (uint32_t i = 0; i < 5; i++) {
+			std::vector<uint32_t> fp(query, query + 10 - i);
+			fp.push_back(1000);
+			writer->addDocument(10000 + i, fp.data(), fp.size());
+		}
+		writer->commit();
+	}
+
+	IndexReader reader(index);
+	ExhaustiveTopHitsCollector expected(1);
+	reader.search(query, 11, &expected);
+	uint64_t skippedBlocks = index->skippedBlockCount();
+	PruningTopHitsCollector collector(1);
+	reader.search(query, 11, &collector);
+
+	// Only the best document can still make it once term 1000 is searched,
+	// the blocks with the other documents are not even read.
+	ASSERT_LT(skippedBlocks + 10, index->skippedBlockCount());
+	auto results = collector.topResults();
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(10000, results[0].id());
+	ASSERT_EQ(11, results[0].score());
+	ASSERT_EQ(expected.topResults()[0].score(), results[0].score());
+}
+
+TEST(IndexReaderTest, SearchTopHitsWithResultCache)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+	index->setResultCacheSize(1024 * 1024);
+
+	uint32_t fp[] = { 7, 9, 12 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp, 3);
+		writer->commit();
+	}
+
+	{
+		IndexReader reader(index);
+		auto results = reader.searchTopHits(fp, 3, 10);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(0, index->resultCache()->hitCount());
+		results = reader.searchTopHits(fp, 3, 10);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(1, index->resultCache()->hitCount());
+		// Bypassing the cache runs the search again.
+		results = reader.searchTopHits(fp, 3, 10, 0, 0, false);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(1, index->resultCache()->hitCount());
+	}
+
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(2, fp, 3);
+		writer->commit();
+	}
+
+	// The new revision doesn't see results cached for the old one.
+	{
+		IndexReader reader(index);
+		auto results = reader.searchTopHits(fp, 3, 10);
+		ASSERT_EQ(2, results.size());
+		ASSERT_EQ(1, index->resultCache()->hitCount());
+	}
+}
+
+TEST(IndexReaderTest, SearchTopHitsWithoutSingleFlight)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp[] = { 7, 9, 12 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp, 3);
+		writer->commit();
+	}
+
+	// An identical search is in progress and never finishes.
+	IndexReader reader(index);
+	SearchSingleFlight::CallSharedPtr leader;
+	ASSERT_TRUE(index->singleFlight()->start(SearchResultCacheKey(fp, 3, 10, 0, reader.info().revision()), &leader));
+	ASSERT_THROW(reader.searchTopHits(fp, 3, 10, 0, 10), TimeoutExceeded);
+
+	// The uncached overload doesn't wait for it.
+	ASSERT_EQ(1, reader.search(fp, 3, 10).size());
+
+	// Neither do any searches once collapsing is disabled.
+	index->setSingleFlightEnabled(false);
+	auto results = reader.searchTopHits(fp, 3, 10, 0, 10);
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(0, index->singleFlight()->sharedCount());
+	index->singleFlight()->finish(leader, nullptr);
+}
+
+TEST(IndexReaderTest, SearchApproximate)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	// Term 1 is in every document, its postings span many blocks.
+	std::vector<uint32_t> fp;
+	for (uint32_t i = 1; i <= 100; i++) {
+		fp.push_back(i);
+	}
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 5000; id++) {
+			writer->addDocument(id, fp.data(), 1);
+		}
+		writer->addDocument(10000, fp.data(), fp.size());
+		writer->commit();
+	}
+
+	{
+		IndexReader reader(index);
+		ASSERT_LT(1000, reader.estimatePostings(fp.data(), fp.size()));
+		ASSERT_GT(1000, reader.estimatePostings(fp.data() + 1, fp.size() - 1));
+		auto results = reader.searchTopHits(fp.data(), fp.size(), 1);
+		ASSERT_FALSE(reader.isApproximate());
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(10000, results[0].id());
+		ASSERT_EQ(100, results[0].score());
+	}
+
+	index->setApproximateSearchThreshold(1000);
+	index->setApproximateSearchError(0.01);
+	{
+		IndexReader reader(index);
+		// Only 100 documents are tracked, but the one matching all terms stays with its exact score.
+		auto results = reader.searchTopHits(fp.data(), fp.size(), 1);
+		ASSERT_TRUE(reader.isApproximate());
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(10000, results[0].id());
+		ASSERT_EQ(100, results[0].score());
+		ASSERT_EQ(1, index->approximateSearchCount());
+
+		// Searches of rare terms stay exact.
+		results = reader.searchTopHits(fp.data() + 1, fp.size() - 1, 1);
+		ASSERT_FALSE(reader.isApproximate());
+		ASSERT_EQ(99, results[0].score());
+		ASSERT_EQ(1, index->approximateSearchCount());
+
+		// So do filtered searches, the filter might leave only a few of the postings.
+		reader.setDocumentFilter(DocumentFilterSharedPtr::create(9000, 11000));
+		results = reader.searchTopHits(fp.data(), fp.size(), 1);
+		ASSERT_FALSE(reader.isApproximate());
+		ASSERT_EQ(10000, results[0].id());
+		ASSERT_EQ(100, results[0].score());
+		ASSERT_EQ(1, index->approximateSearchCount());
+		reader.setDocumentFilter(DocumentFilterSharedPtr());
+	}
+
+	// Cached results are still reported as approximate.
+	index->setResultCacheSize(1024 * 1024);
+	{
+		IndexReader reader(index);
+		reader.searchTopHits(fp.data(), fp.size(), 1);
+		ASSERT_TRUE(reader.isApproximate());
+		reader.searchTopHits(fp.data() + 1, fp.size() - 1, 1);
+		ASSERT_FALSE(reader.isApproximate());
+		auto results = reader.searchTopHits(fp.data(), fp.size(), 1);
+		ASSERT_EQ(1, index->resultCache()->hitCount());
+		ASSERT_TRUE(reader.isApproximate());
+		ASSERT_EQ(10000, results[0].id());
+	}
+}
+
+TEST(IndexReaderTest, SearchApproximateParallel)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	// Term 1 is in every document, spread over a few segments.
+	std::vector<uint32_t> fp;
+	for (uint32_t i = 1; i <= 100; i++) {
+		fp.push_back(i);
+	}
+	{
+		auto writer = index->openWriter();
+		writer->segmentMergePolicy()->setMaxSegmentsPerTier(10);
+		writer->segmentMergePolicy()->setFloorSegmentBlocks(0);
+		for (uint32_t id = 1; id <= 6000; id++) {
+			writer->addDocument(id, fp.data(), 1);
+			if (id % 2000 == 0) {
+				writer->commit();
+			}
+		}
+		writer->addDocument(10000, fp.data(), fp.size());
+		writer->commit();
+	}
+	ASSERT_LE(2, index->info().segmentCount());
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(2);
+	index->setThreadPool(&pool);
+	index->setSearchThreads(2);
+	index->setApproximateSearchThreshold(1000);
+	index->setApproximateSearchError(0.01);
+
+	// Every thread tracks only 100 documents, the merged counts still find the best one.
+	IndexReader reader(index);
+	auto results = reader.searchTopHits(fp.data(), fp.size(), 1);
+	ASSERT_TRUE(reader.isApproximate());
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(10000, results[0].id());
+	ASSERT_EQ(100, results[0].score());
+}
+
+TEST(IndexReaderTest, SearchWithFrequentTerms)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp[] = { 1, 10, 11, 12 };
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 1000; id++) {
+			writer->addDocument(id, fp, 1);
+		}
+		writer->addDocument(2000, fp, 4);
+		writer->addDocument(2001, fp + 1, 2);
+		writer->commit();
+	}
+
+	{
+		IndexReader reader(index);
+		ASSERT_EQ(1001, reader.termFrequency(1));
+		ASSERT_EQ(0, reader.termFrequency(10));
+		auto results = reader.searchTopHits(fp, 4, 10);
+		ASSERT_EQ(10, results.size());
+		ASSERT_EQ(2000, results[0].id());
+		ASSERT_EQ(4, results[0].score());
+	}
+
+	// The statistics are stored with the segment.
+	index.reset(new Index(dir, false));
+	index->setFrequentTermCutoff(500);
+	{
+		IndexReader reader(index);
+		ASSERT_EQ(1001, reader.termFrequency(1));
+
+		// The frequent term only adds to the scores of documents found by the rare ones,
+		// its blocks without any of them are not read.
+		uint64_t skippedBlocks = index->skippedBlockCount();
+		auto results = reader.searchTopHits(fp, 4, 10);
+		ASSERT_LT(skippedBlocks, index->skippedBlockCount());
+		ASSERT_EQ(2, results.size());
+		ASSERT_EQ(2000, results[0].id());
+		ASSERT_EQ(4, results[0].score());
+		ASSERT_EQ(2001, results[1].id());
+		ASSERT_EQ(2, results[1].score());
+		ASSERT_EQ(1, index->frequentTermCount());
+
+		// A fingerprint of only frequent terms is searched as usual.
+		results = reader.searchTopHits(fp, 1, 10);
+		ASSERT_EQ(10, results.size());
+		ASSERT_EQ(1, index->frequentTermCount());
+	}
+
+	index->setFrequentTermMode(SKIP_FREQUENT_TERMS);
+	{
+		IndexReader reader(index);
+		auto results = reader.searchTopHits(fp, 4, 10);
+		ASSERT_EQ(2, results.size());
+		ASSERT_EQ(2000, results[0].id());
+		ASSERT_EQ(3, results[0].score());
+		ASSERT_EQ(2001, results[1].id());
+		ASSERT_EQ(2, results[1].score());
+	}
+}
+
+TEST(IndexReaderTest, SearchWithStopKeys)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp[] = { 1, 2, 3 };
+	{
+		auto writer = index->openWriter();
+		writer->setAttribute(IndexWriter::MAX_KEY_POSTINGS_ATTRIBUTE, "10");
+		for (uint32_t id = 1; id <= 20; id++) {
+			writer->addDocument(id, fp, 2);
+		}
+		writer->addDocument(100, fp, 3);
+		writer->commit();
+	}
+
+	{
+		IndexReader reader(index);
+		auto stats = reader.info().segment(0).termStats();
+		ASSERT_TRUE(stats);
+		ASSERT_EQ(10, stats->maxKeyPostings());
+		ASSERT_EQ(std::vector<uint32_t>({ 1, 2 }), stats->stopKeys());
+
+		// The stop keys don't match anything.
+		auto results = reader.searchTopHits(fp, 3, 10);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(100, results[0].id());
+		ASSERT_EQ(1, results[0].score());
+	}
+
+	// Without the cap, a new segment has all postings of key 1, but it stays
+	// stopped in the older segment, in the index and after merging the two.
+	{
+		auto writer = index->openWriter();
+		writer->setAttribute(IndexWriter::MAX_KEY_POSTINGS_ATTRIBUTE, "0");
+		writer->segmentMergePolicy()->setFloorSegmentBlocks(0);
+		writer->addDocument(200, fp, 1);
+		writer->commit();
+		ASSERT_EQ(2, writer->info().segmentCount());
+		auto results = writer->searchTopHits(fp, 3, 10);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(100, results[0].id());
+
+		// Batch searches skip the stop keys too.
+		std::vector<std::vector<uint32_t>> queries = { { 1, 2, 3 }, { 1 } };
+		TopHitsCollector c1(10), c2(10), c3(10), c4(10);
+		std::vector<Collector *> collectors = { &c1, &c2 };
+		writer->searchBatch(queries, collectors);
+		ASSERT_EQ(1, c1.topResults().size());
+		ASSERT_EQ(100, c1.topResults()[0].id());
+		ASSERT_EQ(1, c1.topResults()[0].score());
+		ASSERT_EQ(0, c2.topResults().size());
+		collectors = { &c3, &c4 };
+		writer->searchInterleaved(queries, collectors);
+		ASSERT_EQ(1, c3.topResults().size());
+		ASSERT_EQ(100, c3.topResults()[0].id());
+		ASSERT_EQ(0, c4.topResults().size());
+
+		// So do the variants of expanded searches.
+		results = writer->searchExpanded(fp, 3, 10, 0, 0);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(100, results[0].id());
+
+		writer->optimize();
+		writer->commit();
+		ASSERT_EQ(1, writer->info().segmentCount());
+		auto stats = writer->info().segment(0).termStats();
+		ASSERT_TRUE(stats);
+		ASSERT_EQ(std::vector<uint32_t>({ 1, 2 }), stats->stopKeys());
+	}
+
+	index.reset(new Index(dir, false));
+	{
+		IndexReader reader(index);
+		ASSERT_EQ(std::vector<uint32_t>({ 1, 2 }), reader.info().segment(0).termStats()->stopKeys());
+		auto results = reader.searchTopHits(fp, 3, 10);
+		ASSERT_EQ(1, results.size());
+		ASSERT_EQ(100, results[0].id());
+	}
+}
+
+namespace {
+
+// Makes every hit take a while, so that searches run out of time.
+class SlowTopHitsCollector : public TopHitsCollector
+{
+public:
+	SlowTopHitsCollector(size_t numHits) : TopHitsCollector(numHits) {}
+	void collect(uint32_t id) override { QThread::msleep(5); TopHitsCollector::collect(id); }
+	void collectMany(const uint32_t *ids, size_t count) override { QThread::msleep(5 * count); TopHitsCollector::collectMany(ids, count); }
+};
+
+}
+
+TEST(IndexReaderTest, SearchWithPartialResults)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp[] = { 7, 9, 12 };
+	{
+		auto writer = index->openWriter();
+		writer->segmentMergePolicy()->setMaxSegmentsPerTier(10);
+		writer->segmentMergePolicy()->setFloorSegmentBlocks(0);
+		for (uint32_t i = 0; i < 5; i++) {
+			writer->addDocument(i + 1, fp, 3);
+			writer->commit();
+		}
+	}
+
+	{
+		IndexReader reader(index);
+		SlowTopHitsCollector collector(10);
+		ASSERT_THROW(reader.search(fp, 3, &collector, 10), TimeoutExceeded);
+	}
+
+	{
+		IndexReader reader(index);
+		reader.setAllowPartialResults(true);
+		SlowTopHitsCollector collector(10);
+		reader.search(fp, 3, &collector, 10);
+		ASSERT_TRUE(reader.isPartial());
+		auto results = collector.topResults();
+		ASSERT_LT(0, results.size());
+		ASSERT_GT(5, results.size());
+	}
+
+	{
+		IndexReader reader(index);
+		reader.setAllowPartialResults(true);
+		TopHitsCollector collector(10);
+		reader.search(fp, 3, &collector);
+		ASSERT_FALSE(reader.isPartial());
+		ASSERT_EQ(5, collector.topResults().size());
+	}
+}
+
+TEST(IndexReaderTest, SearchCancelled)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp[] = { 7, 9, 12 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp, 3);
+		writer->commit();
+	}
+
+	auto cancellation = CancellationTokenSharedPtr::create();
+	{
+		IndexReader reader(index);
+		reader.setCancellationToken(cancellation);
+		TopHitsCollector collector(10);
+		reader.search(fp, 3, &collector);
+		ASSERT_EQ(1, collector.topResults().size());
+	}
+
+	cancellation->cancel();
+	{
+		IndexReader reader(index);
+		reader.setCancellationToken(cancellation);
+		TopHitsCollector collector(10);
+		ASSERT_THROW(reader.search(fp, 3, &collector), SearchCancelled);
+		ASSERT_EQ(1, index->cancelledSearchCount());
+	}
+
+	// Tokens can also poll an external source.
+	bool clientGone = true;
+	{
+		IndexReader reader(index);
+		reader.setCancellationToken(CancellationTokenSharedPtr::create([&clientGone]() { return clientGone; }));
+		TopHitsCollector collector(10);
+		ASSERT_THROW(reader.search(fp, 3, &collector), SearchCancelled);
+		ASSERT_EQ(2, index->cancelledSearchCount());
+	}
+}
+
+TEST(IndexReaderTest, SearchSampled)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	std::vector<uint32_t> fp1, fp2;
+	for (uint32_t i = 0; i < 100; i++) {
+		fp1.push_back(i);
+		fp2.push_back(i < 50 ? i : i + 1000);
+	}
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1.data(), fp1.size());
+		writer->addDocument(2, fp2.data(), fp2.size());
+		writer->commit();
+	}
+
+	IndexReader reader(index);
+
+	// The candidates are rescored with all items, so the scores are the same as with the exact search.
+	auto results = reader.searchSampled(fp1.data(), fp1.size(), 10, 0, 4, 10);
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(100, results[0].score());
+	ASSERT_EQ(2, results[1].id());
+	ASSERT_EQ(50, results[1].score());
+
+	// Only the best candidate is rescored.
+	results = reader.searchSampled(fp1.data(), fp1.size(), 10, 0, 4, 1);
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(100, results[0].score());
+
+	// Automatic stride and candidate count.
+	results = reader.searchSampled(fp1.data(), fp1.size(), 10);
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(100, results[0].score());
+}
+
+TEST(IndexReaderTest, SearchSampledRescoresOnlyCandidates)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t query[] = { 10, 1000, 20, 30 };
+	{
+		auto writer = index->openWriter();
+		// Term 1000 is in every document, its postings span many blocks.
+		for (uint32_t id = 1; id <= 5000; id++) {
+			writer->addDocument(id, query + 1, 1);
+		}
+		writer->addDocument(10000, query, 4);
+		writer->addDocument(10001, query, 2);
+		writer->commit();
+	}
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(2);
+	index->setThreadPool(&pool);
+	index->setSearchThreads(2);
+
+	// Term 1000 is only in the rest, the candidates from the sample are rescored
+	// on this thread and the blocks without them are not read.
+	IndexReader reader(index);
+	uint64_t skippedBlocks = index->skippedBlockCount();
+	auto results = reader.searchSampled(query, 4, 10, 0, 2, 10);
+	ASSERT_LT(skippedBlocks + 10, index->skippedBlockCount());
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(10000, results[0].id());
+	ASSERT_EQ(4, results[0].score());
+	ASSERT_EQ(10001, results[1].id());
+	ASSERT_EQ(2, results[1].score());
+}
+
+TEST(IndexReaderTest, SearchExpanded)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+
+	uint32_t fp1[] = { 0x10, 0x20, 0x30, 0x40 };
+	// Two variants of the same item, 0x11 and 0x13 are both one bit away from 0x10 or 0x12.
+	uint32_t fp2[] = { 0x11, 0x13 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp1, 4);
+		writer->addDocument(2, fp2, 2);
+		writer->commit();
+	}
+
+	IndexReader reader(index);
+
+	// The first item has a bit error in bit 3.
+	uint32_t query[] = { 0x18, 0x20, 0x30, 0x40 };
+	auto results = reader.searchExpanded(query, 4, 10, 0, 0);
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(3, results[0].score());
+
+	results = reader.searchExpanded(query, 4, 10, 0, 1);
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(4, results[0].score());
+
+	// Bit 3 is not in the mask, so the error is not corrected.
+	results = reader.searchExpanded(query, 4, 10, 0, 1, ~uint32_t(0x08));
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(3, results[0].score());
+
+	// A zero mask means all bits.
+	results = reader.searchExpanded(query, 4, 10, 0, 1, 0);
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(4, results[0].score());
+
+	// A document matching several variants of one item is counted once.
+	uint32_t query2[] = { 0x12 };
+	results = reader.searchExpanded(query2, 1, 10, 0, 1);
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(1, results[0].score());
+	ASSERT_EQ(1, results[1].score());
+
+	// Each item of the query counts separately. Document 2 matches 0x10 with 0x11 and 0x13 with
+	// either of its items, document 1 only matches 0x10.
+	uint32_t query3[] = { 0x10, 0x13 };
+	results = reader.searchExpanded(query3, 2, 10, 0, 1);
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(2, results[0].id());
+	ASSERT_EQ(2, results[0].score());
+	ASSERT_EQ(1, results[1].id());
+	ASSERT_EQ(1, results[1].score());
+
+	// A repeated item counts once, the same as in a plain search.
+	uint32_t query4[] = { 0x20, 0x30, 0x20 };
+	auto expected = reader.searchTopHits(query4, 3, 10);
+	results = reader.searchExpanded(query4, 3, 10, 0, 1);
+	ASSERT_EQ(1, expected.size());
+	ASSERT_EQ(2, expected[0].score());
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(2, results[0].score());
+}
+
+TEST(IndexReaderTest, SearchWithDocumentFilter)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+	index->setResultCacheSize(1024 * 1024);
+
+	uint32_t fp[] = { 1, 2, 3, 4 };
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 10; id++) {
+			writer->addDocument(id, fp, 1 + id % 4);
+		}
+		writer->commit();
+	}
+
+	IndexReader reader(index);
+	auto results = reader.searchTopHits(fp, 4, 3);
+	ASSERT_EQ(3, results.size());
+	ASSERT_EQ(3, results[0].id());
+	ASSERT_EQ(7, results[1].id());
+	ASSERT_EQ(2, results[2].id());
+
+	// Documents 4, 5, 6 and 8, the bitmap leaves out 7 and the ones after 8.
+	reader.setDocumentFilter(DocumentFilterSharedPtr::create(4, 10, QByteArray("\x17", 1)));
+	results = reader.searchTopHits(fp, 4, 3);
+	ASSERT_EQ(3, results.size());
+	ASSERT_EQ(6, results[0].id());
+	ASSERT_EQ(3, results[0].score());
+	ASSERT_EQ(5, results[1].id());
+	ASSERT_EQ(2, results[1].score());
+	ASSERT_EQ(4, results[2].id());
+	ASSERT_EQ(1, results[2].score());
+
+	// The filter also applies to searches that run a batch of queries.
+	results = reader.searchExpanded(fp, 4, 10, 0, 1);
+	ASSERT_EQ(4, results.size());
+	for (const auto &result : results) {
+		ASSERT_TRUE(result.id() != 7 && result.id() >= 4 && result.id() <= 8) << result.id();
+	}
+
+	// A filter that matches all documents is ignored.
+	reader.setDocumentFilter(DocumentFilterSharedPtr::create());
+	ASSERT_FALSE(reader.documentFilter());
+	results = reader.searchTopHits(fp, 4, 3);
+	ASSERT_EQ(3, results.size());
+	ASSERT_EQ(3, results[0].id());
+}
+
+TEST(IndexReaderTest, SearchWithPrefetch)
+{
+	// Prefetching only does anything with memory mapped files.
+	std::unique_ptr<FSDirectory> tmpDir(FSDirectory::openTemporary(true));
+	DirectorySharedPtr dir(new FSDirectory(tmpDir->path(), true));
+	IndexSharedPtr index(new Index(dir, true));
+
+	{
+		auto writer = index->openWriter();
+		for (uint32_t id = 1; id <= 500; id++) {
+			std::vector<uint32_t> fp;
+			for (uint32_t i = 0; i < 20; i++) {
+				fp.push_back((id * 7 + i * 13) % 1000);
+			}
+			writer->addDocument(id, fp.data(), fp.size());
+			if (id % 250 == 0) {
+				writer->commit();
+			}
+		}
+	}
+
+	std::vector<uint32_t> query;
+	for (uint32_t i = 0; i < 10; i++) {
+		query.push_back((31 + i * 13) % 1000);
+	}
+
+	IndexReader reader(index);
+	TopHitsCollector expected(10);
+	reader.search(query.data(), query.size(), &expected);
+
+	reader.setPrefetchBlocks(true);
+	TopHitsCollector collector(10);
+	reader.search(query.data(), query.size(), &collector);
+
+	auto expectedResults = expected.topResults();
+	auto results = collector.topResults();
+	ASSERT_EQ(10, results.size());
+	ASSERT_EQ(expectedResults.size(), results.size());
+	for (int i = 0; i < results.size(); i++) {
+		ASSERT_EQ(expectedResults.at(i).id(), results.at(i).id());
+		ASSERT_EQ(expectedResults.at(i).score(), results.at(i).score());
+	}
+}
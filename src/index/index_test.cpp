@@ -41,3 +41,32 @@ TEST(IndexTest, DeleteUnusedFiled)
 	ASSERT_TRUE(index->directory()->fileExists("info_1"));
 	ASSERT_FALSE(index->directory()->fileExists("info_0"));
 }
+
+TEST(IndexTest, SegmentIndexLayout)
+{
+	DirectorySharedPtr dir(new RAMDirectory());
+	IndexSharedPtr index(new Index(dir, true));
+	uint32_t fp[] = { 1, 2, 3 };
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(1, fp, 3);
+		writer->commit();
+	}
+
+	index->setSegmentIndexLayout(STREE_INDEX_LAYOUT);
+	ASSERT_EQ(1, index->info().segmentCount());
+	ASSERT_EQ(STREE_INDEX_LAYOUT, index->info().segment(0).index()->layout());
+
+	{
+		auto writer = index->openWriter();
+		writer->addDocument(2, fp, 3);
+		writer->commit();
+	}
+	IndexInfo info = index->info();
+	for (const auto &segment : info.segments()) {
+		ASSERT_EQ(STREE_INDEX_LAYOUT, segment.index()->layout());
+	}
+
+	auto results = index->search(std::vector<uint32_t>(fp, fp + 3));
+	ASSERT_EQ(2, results.size());
+}
@@ -79,7 +79,32 @@ SegmentDataWriter* IndexWriter::segmentDataWriter(const SegmentInfo& segment)
 	OutputStream* indexOutput = m_dir->createFile(segment.indexFileName());
 	OutputStream* dataOutput = m_dir->createFile(segment.dataFileName());
 	SegmentIndexWriter* indexWriter = new SegmentIndexWriter(indexOutput);
-	return new SegmentDataWriter(dataOutput, indexWriter, BLOCK_SIZE);
+	SegmentDataWriter* writer = new SegmentDataWriter(dataOutput, indexWriter, BLOCK_SIZE);
+	writer->setBuildFilter(true);
+	writer->setBuildTermStats(true);
+	writer->setMaxKeyPostings(m_info.getAttribute(MAX_KEY_POSTINGS_ATTRIBUTE).toUInt());
+	writer->setBlockFilterOutput(m_dir->createFile(segment.blockFilterFileName()));
+	return writer;
+}
+
+void IndexWriter::writeSegmentFilter(SegmentInfo& segment, SegmentFilterSharedPtr filter)
+{
+	if (!filter) {
+		return;
+	}
+	std::unique_ptr<OutputStream> output(m_dir->createFile(segment.filterFileName()));
+	filter->save(output.get());
+	segment.setFilter(filter);
+}
+
+void IndexWriter::writeSegmentTermStats(SegmentInfo& segment, SegmentTermStatsSharedPtr termStats)
+{
+	if (!termStats || termStats->isEmpty()) {
+		return;
+	}
+	std::unique_ptr<OutputStream> output(m_dir->createFile(segment.termStatsFileName()));
+	termStats->save(output.get());
+	segment.setTermStats(termStats);
 }
 
 void IndexWriter::merge(const QList<int>& merge)
@@ -94,18 +119,31 @@ void IndexWriter::merge(const QList<int>& merge)
 	SegmentInfo segment(info.incLastSegmentId());
 	{
 		SegmentMerger merger(segmentDataWriter(segment));
+		std::vector<uint32_t> stopKeys;
 		for (size_t i = 0; i < merge.size(); i++) {
 			int j = merge.at(i);
 			const SegmentInfo& s = segments.at(j);
 			expectedChecksum ^= s.checksum();
 			qDebug() << "Merging segment" << s.id() << "with checksum" << s.checksum() << "into segment" << segment.id();
 			merger.addSource(new SegmentEnum(s.index(), segmentDataReader(s)));
+			if (s.termStats()) {
+				const auto &keys = s.termStats()->stopKeys();
+				stopKeys.insert(stopKeys.end(), keys.begin(), keys.end());
+			}
 		}
+		std::sort(stopKeys.begin(), stopKeys.end());
+		stopKeys.erase(std::unique(stopKeys.begin(), stopKeys.end()), stopKeys.end());
+		merger.writer()->setStopKeys(stopKeys);
 		merger.merge();
+		// Postings dropped by the cap are not in the new segment's checksum.
+		expectedChecksum ^= merger.writer()->droppedChecksum();
 		segment.setBlockCount(merger.writer()->blockCount());
+		segment.setFirstKey(merger.writer()->firstKey());
 		segment.setLastKey(merger.writer()->lastKey());
 		segment.setChecksum(merger.writer()->checksum());
 		segment.setIndex(merger.writer()->index());
+		writeSegmentFilter(segment, merger.writer()->filter());
+		writeSegmentTermStats(segment, merger.writer()->termStats());
 	}
 
 	qDebug() << "New segment" << segment.id() << "with checksum" << segment.checksum() << "(merge)";
@@ -113,6 +151,8 @@ void IndexWriter::merge(const QList<int>& merge)
 	if (segment.checksum() != expectedChecksum) {
 		throw CorruptIndexException("checksum mismatch after merge");
 	}
+	segment.setDataReader(SegmentDataReaderSharedPtr(segmentDataReader(segment)));
+	segment.setBlockFilter(SegmentBlockFilterSharedPtr::create(m_dir->openFile(segment.blockFilterFileName()), segment.blockCount()));
 
 	QSet<int> merged = merge.toSet();
 	info.clearSegments();
@@ -158,11 +198,17 @@ void IndexWriter::flush()
 		}
 		writer->close();
 		segment.setBlockCount(writer->blockCount());
+		segment.setFirstKey(writer->firstKey());
 		segment.setLastKey(writer->lastKey());
 		segment.setChecksum(writer->checksum());
 		segment.setIndex(writer->index());
+		writeSegmentFilter(segment, writer->filter());
+		writeSegmentTermStats(segment, writer->termStats());
 	}
 
+	segment.setDataReader(SegmentDataReaderSharedPtr(segmentDataReader(segment)));
+	segment.setBlockFilter(SegmentBlockFilterSharedPtr::create(m_dir->openFile(segment.blockFilterFileName()), segment.blockCount()));
+
 	qDebug() << "New segment" << segment.id() << "with checksum" << segment.checksum();
 	info.addSegment(segment);
 	if (info.getAttribute("max_document_id").toInt() < m_maxDocumentId) {
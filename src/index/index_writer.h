@@ -36,6 +36,10 @@ public:
 		return m_mergePolicy.get();
 	}
 
+	// Index attribute with the maximum number of postings kept per key in new segments.
+	// Keys with more postings are stored as stop keys and don't match anything.
+	static constexpr const char *MAX_KEY_POSTINGS_ATTRIBUTE = "max_key_postings";
+
 	void addDocument(uint32_t id, const uint32_t *terms, size_t length);
 	void setAttribute(const QString &name, const QString &value);
 	void commit();
@@ -49,6 +53,8 @@ private:
 	void merge(const QList<int>& merge);
 
 	SegmentDataWriter *segmentDataWriter(const SegmentInfo& info);
+	void writeSegmentFilter(SegmentInfo& segment, SegmentFilterSharedPtr filter);
+	void writeSegmentTermStats(SegmentInfo& segment, SegmentTermStatsSharedPtr termStats);
 
 	uint32_t m_maxDocumentId;
 	size_t m_maxSegmentBufferSize;
@@ -28,6 +28,8 @@ TEST(IndexWriterTest, AddDocument)
 	ASSERT_TRUE(index->directory()->fileExists("info_1"));
 	ASSERT_TRUE(index->directory()->fileExists("segment_0.fii"));
 	ASSERT_TRUE(index->directory()->fileExists("segment_0.fid"));
+	ASSERT_TRUE(index->directory()->fileExists("segment_0.fif"));
+	ASSERT_TRUE(index->directory()->fileExists("segment_0.fib"));
 	ASSERT_EQ(1, writer->info().revision());
 	ASSERT_EQ(1, writer->info().segmentCount());
 	ASSERT_EQ("1", writer->info().getAttribute("max_document_id"));
@@ -73,7 +75,7 @@ TEST(IndexWriterTest, Merge)
 	ASSERT_EQ(1, writer->info().segment(0).blockCount());
     writer.clear();
 	writer = index->openWriter();
-	ASSERT_EQ(3, index->directory()->listFiles().size());
+	ASSERT_EQ(5, index->directory()->listFiles().size());
 	qDebug() << index->directory()->listFiles();
 	writer->segmentMergePolicy()->setMaxMergeAtOnce(2);
 	writer->segmentMergePolicy()->setMaxSegmentsPerTier(2);
@@ -85,7 +87,7 @@ TEST(IndexWriterTest, Merge)
 	ASSERT_EQ(1, writer->info().segment(1).blockCount());
     writer.clear();
 	writer = index->openWriter();
-	ASSERT_EQ(5, index->directory()->listFiles().size());
+	ASSERT_EQ(9, index->directory()->listFiles().size());
 	qDebug() << index->directory()->listFiles();
 	writer->segmentMergePolicy()->setMaxMergeAtOnce(2);
 	writer->segmentMergePolicy()->setMaxSegmentsPerTier(2);
@@ -98,7 +100,7 @@ TEST(IndexWriterTest, Merge)
 	ASSERT_EQ(1, writer->info().segment(1).blockCount());
     writer.clear();
 	writer = index->openWriter();
-	ASSERT_EQ(5, index->directory()->listFiles().size());
+	ASSERT_EQ(9, index->directory()->listFiles().size());
 	qDebug() << index->directory()->listFiles();
 	writer->segmentMergePolicy()->setMaxMergeAtOnce(2);
 	writer->segmentMergePolicy()->setMaxSegmentsPerTier(2);
@@ -110,7 +112,7 @@ TEST(IndexWriterTest, Merge)
 	ASSERT_EQ(1, writer->info().segment(1).blockCount());
     writer.clear();
 	writer = index->openWriter();
-	ASSERT_EQ(5, index->directory()->listFiles().size());
+	ASSERT_EQ(9, index->directory()->listFiles().size());
 	qDebug() << index->directory()->listFiles();
 	writer->segmentMergePolicy()->setMaxMergeAtOnce(3);
 	writer->segmentMergePolicy()->setMaxSegmentsPerTier(1);
@@ -120,7 +122,7 @@ TEST(IndexWriterTest, Merge)
 	ASSERT_EQ(1, writer->info().segmentCount());
 	ASSERT_EQ(1, writer->info().segment(0).blockCount());
 	writer.clear();
-	ASSERT_EQ(3, index->directory()->listFiles().size());
+	ASSERT_EQ(5, index->directory()->listFiles().size());
 	qDebug() << index->directory()->listFiles();
 }
 
@@ -21,12 +21,113 @@ void MultiIndex::close() {
 QThreadPool *MultiIndex::threadPool() const { return m_threadPool; }
 
 void MultiIndex::setThreadPool(QThreadPool *threadPool) {
+    QMutexLocker locker(&m_mutex);
     for (auto &index : m_indexes) {
         index->setThreadPool(threadPool);
     }
     m_threadPool = threadPool;
 }
 
+int MultiIndex::searchThreads() const { return m_searchThreads; }
+
+void MultiIndex::setSearchThreads(int numThreads) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setSearchThreads(numThreads);
+    }
+    m_searchThreads = numThreads;
+}
+
+bool MultiIndex::prefetchBlocks() const { return m_prefetchBlocks; }
+
+void MultiIndex::setPrefetchBlocks(bool prefetch) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setPrefetchBlocks(prefetch);
+    }
+    m_prefetchBlocks = prefetch;
+}
+
+size_t MultiIndex::approximateSearchThreshold() const { return m_approximateSearchThreshold; }
+
+void MultiIndex::setApproximateSearchThreshold(size_t threshold) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setApproximateSearchThreshold(threshold);
+    }
+    m_approximateSearchThreshold = threshold;
+}
+
+double MultiIndex::approximateSearchError() const { return m_approximateSearchError; }
+
+void MultiIndex::setApproximateSearchError(double maxError) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setApproximateSearchError(maxError);
+    }
+    m_approximateSearchError = maxError;
+}
+
+size_t MultiIndex::frequentTermCutoff() const { return m_frequentTermCutoff; }
+
+void MultiIndex::setFrequentTermCutoff(size_t cutoff) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setFrequentTermCutoff(cutoff);
+    }
+    m_frequentTermCutoff = cutoff;
+}
+
+FrequentTermMode MultiIndex::frequentTermMode() const { return m_frequentTermMode; }
+
+void MultiIndex::setFrequentTermMode(FrequentTermMode mode) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setFrequentTermMode(mode);
+    }
+    m_frequentTermMode = mode;
+}
+
+size_t MultiIndex::blockCacheSize() const { return m_blockCacheSize; }
+
+void MultiIndex::setBlockCacheSize(size_t maxSize) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setBlockCacheSize(maxSize);
+    }
+    m_blockCacheSize = maxSize;
+}
+
+size_t MultiIndex::resultCacheSize() const { return m_resultCacheSize; }
+
+void MultiIndex::setResultCacheSize(size_t maxSize) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setResultCacheSize(maxSize);
+    }
+    m_resultCacheSize = maxSize;
+}
+
+bool MultiIndex::singleFlightEnabled() const { return m_singleFlightEnabled; }
+
+void MultiIndex::setSingleFlightEnabled(bool enabled) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setSingleFlightEnabled(enabled);
+    }
+    m_singleFlightEnabled = enabled;
+}
+
+SegmentIndexLayout MultiIndex::segmentIndexLayout() const { return m_segmentIndexLayout; }
+
+void MultiIndex::setSegmentIndexLayout(SegmentIndexLayout layout) {
+    QMutexLocker locker(&m_mutex);
+    for (auto &index : m_indexes) {
+        index->setSegmentIndexLayout(layout);
+    }
+    m_segmentIndexLayout = layout;
+}
+
 bool MultiIndex::indexExists(const QString &name) {
     QMutexLocker locker(&m_mutex);
     if (m_indexes.contains(name)) {
@@ -47,6 +148,17 @@ QSharedPointer<Index> MultiIndex::getIndex(const QString &name, bool create) {
     }
     if (name == ROOT_INDEX_NAME) {
         index = QSharedPointer<Index>::create(m_dir, create);
+        index->setThreadPool(m_threadPool);
+        index->setSearchThreads(m_searchThreads);
+        index->setPrefetchBlocks(m_prefetchBlocks);
+        index->setApproximateSearchThreshold(m_approximateSearchThreshold);
+        index->setApproximateSearchError(m_approximateSearchError);
+        index->setFrequentTermCutoff(m_frequentTermCutoff);
+        index->setFrequentTermMode(m_frequentTermMode);
+        index->setBlockCacheSize(m_blockCacheSize);
+        index->setResultCacheSize(m_resultCacheSize);
+        index->setSingleFlightEnabled(m_singleFlightEnabled);
+        index->setSegmentIndexLayout(m_segmentIndexLayout);
         m_indexes[name] = index;
         return index;
     }
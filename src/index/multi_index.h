@@ -24,6 +24,36 @@ class MultiIndex {
     QThreadPool *threadPool() const;
     void setThreadPool(QThreadPool *pool);
 
+    int searchThreads() const;
+    void setSearchThreads(int numThreads);
+
+    bool prefetchBlocks() const;
+    void setPrefetchBlocks(bool prefetch);
+
+    size_t approximateSearchThreshold() const;
+    void setApproximateSearchThreshold(size_t threshold);
+
+    double approximateSearchError() const;
+    void setApproximateSearchError(double maxError);
+
+    size_t frequentTermCutoff() const;
+    void setFrequentTermCutoff(size_t cutoff);
+
+    FrequentTermMode frequentTermMode() const;
+    void setFrequentTermMode(FrequentTermMode mode);
+
+    size_t blockCacheSize() const;
+    void setBlockCacheSize(size_t maxSize);
+
+    size_t resultCacheSize() const;
+    void setResultCacheSize(size_t maxSize);
+
+    bool singleFlightEnabled() const;
+    void setSingleFlightEnabled(bool enabled);
+
+    SegmentIndexLayout segmentIndexLayout() const;
+    void setSegmentIndexLayout(SegmentIndexLayout layout);
+
     QSharedPointer<Directory> dir() const { return m_dir; }
 
     bool indexExists(const QString &name);
@@ -39,6 +69,16 @@ class MultiIndex {
     QSharedPointer<Directory> m_dir;
     QMap<QString, QSharedPointer<Index>> m_indexes;
     QPointer<QThreadPool> m_threadPool;
+    int m_searchThreads = 1;
+    bool m_prefetchBlocks = false;
+    size_t m_approximateSearchThreshold = 0;
+    double m_approximateSearchError = HeavyHittersCollector::DEFAULT_MAX_ERROR;
+    size_t m_frequentTermCutoff = 0;
+    FrequentTermMode m_frequentTermMode = DEMOTE_FREQUENT_TERMS;
+    size_t m_blockCacheSize = 0;
+    size_t m_resultCacheSize = 0;
+    bool m_singleFlightEnabled = true;
+    SegmentIndexLayout m_segmentIndexLayout = SORTED_INDEX_LAYOUT;
 };
 
 }  // namespace Acoustid
@@ -0,0 +1,113 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "search_result_cache.h"
+
+#include <algorithm>
+
+namespace Acoustid {
+
+static inline uint64_t hashMix(uint64_t hash, uint64_t value) {
+    hash ^= value + UINT64_C(0x9E3779B97F4A7C15) + (hash << 6) + (hash >> 2);
+    return hash * UINT64_C(0xFF51AFD7ED558CCD);
+}
+
+SearchResultCacheKey::SearchResultCacheKey(const uint32_t *terms, size_t length, size_t maxResults,
+                                           int topScorePercent, int revision)
+    : m_terms(terms, terms + length),
+      m_maxResults(maxResults),
+      m_topScorePercent(topScorePercent),
+      m_revision(revision) {
+    std::sort(m_terms.begin(), m_terms.end());
+    uint64_t hash = hashMix(0, m_terms.size());
+    for (auto term : m_terms) {
+        hash = hashMix(hash, term);
+    }
+    hash = hashMix(hash, m_maxResults);
+    hash = hashMix(hash, uint32_t(m_topScorePercent));
+    m_hash = hashMix(hash, uint32_t(m_revision));
+}
+
+bool SearchResultCacheKey::operator==(const SearchResultCacheKey &other) const {
+    return m_hash == other.m_hash && m_revision == other.m_revision && m_maxResults == other.m_maxResults &&
+           m_topScorePercent == other.m_topScorePercent && m_terms == other.m_terms;
+}
+
+// Rough memory used by one cache entry, including the list node and hash table slot.
+static size_t entrySize(const SearchResultCacheKey &key, const QList<Result> &results) {
+    return 128 + key.terms().size() * sizeof(uint32_t) + results.size() * (sizeof(Result) + sizeof(void *));
+}
+
+SearchResultCache::SearchResultCache(size_t maxSize) : m_size(0), m_maxSize(maxSize) {}
+
+SearchResultCache::~SearchResultCache() {}
+
+size_t SearchResultCache::maxSize() const { return m_maxSize.load(); }
+
+void SearchResultCache::setMaxSize(size_t maxSize) {
+    QMutexLocker locker(&m_mutex);
+    m_maxSize.store(maxSize);
+    evict(maxSize);
+}
+
+size_t SearchResultCache::size() const {
+    QMutexLocker locker(&m_mutex);
+    return m_size;
+}
+
+bool SearchResultCache::get(const SearchResultCacheKey &key, QList<Result> *results, bool *approximate) {
+    QMutexLocker locker(&m_mutex);
+    auto it = m_index.constFind(key.hash());
+    if (it == m_index.constEnd() || !(it.value()->key == key)) {
+        m_missCount.fetchAndAddRelaxed(1);
+        return false;
+    }
+    auto entry = it.value();
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    m_hitCount.fetchAndAddRelaxed(1);
+    *results = entry->results;
+    if (approximate) {
+        *approximate = entry->approximate;
+    }
+    return true;
+}
+
+void SearchResultCache::insert(const SearchResultCacheKey &key, const QList<Result> &results, bool approximate) {
+    auto maxSize = this->maxSize();
+    auto size = entrySize(key, results);
+    if (size > maxSize) {
+        return;
+    }
+    QMutexLocker locker(&m_mutex);
+    auto it = m_index.find(key.hash());
+    if (it != m_index.end()) {
+        // Either the same search finished twice at the same time, or a hash
+        // collision. In both cases the newer results replace the old ones.
+        m_size -= it.value()->size;
+        m_entries.erase(it.value());
+        m_index.erase(it);
+    }
+    evict(maxSize - size);
+    m_entries.push_front(Entry{key, results, approximate, size});
+    m_index.insert(key.hash(), m_entries.begin());
+    m_size += size;
+}
+
+void SearchResultCache::evict(size_t maxSize) {
+    while (m_size > maxSize && !m_entries.empty()) {
+        const auto &entry = m_entries.back();
+        m_size -= entry.size;
+        m_index.remove(entry.key.hash());
+        m_entries.pop_back();
+        m_evictionCount.fetchAndAddRelaxed(1);
+    }
+}
+
+void SearchResultCache::clear() {
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_size = 0;
+}
+
+}  // namespace Acoustid
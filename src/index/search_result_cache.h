@@ -0,0 +1,100 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_SEARCH_RESULT_CACHE_H_
+#define ACOUSTID_INDEX_SEARCH_RESULT_CACHE_H_
+
+#include <QAtomicInteger>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSharedPointer>
+#include <list>
+#include <vector>
+
+#include "common.h"
+#include "top_hits_collector.h"
+
+namespace Acoustid {
+
+// Identifies one search: the sorted query terms, the collector parameters
+// and the index revision that was searched.
+class SearchResultCacheKey {
+ public:
+    SearchResultCacheKey(const uint32_t *terms, size_t length, size_t maxResults, int topScorePercent, int revision);
+
+    const std::vector<uint32_t> &terms() const { return m_terms; }
+    size_t maxResults() const { return m_maxResults; }
+    int topScorePercent() const { return m_topScorePercent; }
+    int revision() const { return m_revision; }
+
+    uint64_t hash() const { return m_hash; }
+
+    bool operator==(const SearchResultCacheKey &other) const;
+
+ private:
+    std::vector<uint32_t> m_terms;
+    size_t m_maxResults;
+    int m_topScorePercent;
+    int m_revision;
+    uint64_t m_hash;
+};
+
+// Cache of top hits for recently searched fingerprints, shared by all searches on one index.
+//
+// The index revision is part of the key, so results from older revisions are
+// never returned after a commit, they just age out of the LRU list. The memory
+// budget is in bytes, a cache with zero size is disabled.
+class SearchResultCache {
+ public:
+    SearchResultCache(size_t maxSize = 0);
+    ~SearchResultCache();
+
+    bool isEnabled() const { return maxSize() > 0; }
+
+    // Memory budget in bytes.
+    size_t maxSize() const;
+    void setMaxSize(size_t maxSize);
+
+    // Memory currently used by cached results, in bytes.
+    size_t size() const;
+
+    // The approximate flag is stored with the results, so that a cache hit
+    // reports the same kind of results as the search that produced them.
+    bool get(const SearchResultCacheKey &key, QList<Result> *results, bool *approximate = nullptr);
+    void insert(const SearchResultCacheKey &key, const QList<Result> &results, bool approximate = false);
+
+    void clear();
+
+    uint64_t hitCount() const { return m_hitCount.load(); }
+    uint64_t missCount() const { return m_missCount.load(); }
+    uint64_t evictionCount() const { return m_evictionCount.load(); }
+
+ private:
+    ACOUSTID_DISABLE_COPY(SearchResultCache)
+
+    struct Entry {
+        SearchResultCacheKey key;
+        QList<Result> results;
+        bool approximate;
+        size_t size;
+    };
+
+    void evict(size_t maxSize);
+
+    mutable QMutex m_mutex;
+    // Most recently used entries are at the front.
+    std::list<Entry> m_entries;
+    QHash<quint64, std::list<Entry>::iterator> m_index;
+    size_t m_size;
+    QAtomicInteger<quint64> m_maxSize;
+    QAtomicInteger<quint64> m_hitCount;
+    QAtomicInteger<quint64> m_missCount;
+    QAtomicInteger<quint64> m_evictionCount;
+};
+
+typedef QSharedPointer<SearchResultCache> SearchResultCacheSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_SEARCH_RESULT_CACHE_H_
@@ -0,0 +1,78 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "search_result_cache.h"
+
+using namespace Acoustid;
+
+TEST(SearchResultCacheTest, Disabled) {
+    SearchResultCache cache;
+    ASSERT_FALSE(cache.isEnabled());
+    uint32_t terms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+    cache.insert(key, QList<Result>{Result(1, 3)});
+    QList<Result> results;
+    ASSERT_FALSE(cache.get(key, &results));
+    ASSERT_EQ(0, cache.size());
+}
+
+TEST(SearchResultCacheTest, GetAndInsert) {
+    SearchResultCache cache(1024 * 1024);
+    uint32_t terms[] = {3, 1, 2};
+    uint32_t sortedTerms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+    QList<Result> results;
+    ASSERT_FALSE(cache.get(key, &results));
+    ASSERT_EQ(1, cache.missCount());
+
+    cache.insert(key, QList<Result>{Result(1, 3), Result(2, 1)});
+    ASSERT_LT(0, cache.size());
+
+    // The order of the terms doesn't matter.
+    ASSERT_TRUE(cache.get(SearchResultCacheKey(sortedTerms, 3, 10, 0, 1), &results));
+    ASSERT_EQ(1, cache.hitCount());
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(1, results[0].id());
+    ASSERT_EQ(3, results[0].score());
+
+    // Different parameters or revision are different searches.
+    ASSERT_FALSE(cache.get(SearchResultCacheKey(terms, 3, 20, 0, 1), &results));
+    ASSERT_FALSE(cache.get(SearchResultCacheKey(terms, 3, 10, 10, 1), &results));
+    ASSERT_FALSE(cache.get(SearchResultCacheKey(terms, 3, 10, 0, 2), &results));
+    ASSERT_FALSE(cache.get(SearchResultCacheKey(terms, 2, 10, 0, 1), &results));
+    ASSERT_EQ(4, cache.missCount() - 1);
+
+    // The approximate flag is kept with the results.
+    bool approximate = true;
+    ASSERT_TRUE(cache.get(key, &results, &approximate));
+    ASSERT_FALSE(approximate);
+    cache.insert(key, QList<Result>{Result(1, 3)}, true);
+    ASSERT_TRUE(cache.get(key, &results, &approximate));
+    ASSERT_TRUE(approximate);
+    ASSERT_EQ(1, results.size());
+
+    cache.clear();
+    ASSERT_EQ(0, cache.size());
+    ASSERT_FALSE(cache.get(key, &results));
+}
+
+TEST(SearchResultCacheTest, Eviction) {
+    uint32_t terms[] = {1, 2, 3};
+    QList<Result> results{Result(1, 3)};
+    SearchResultCache cache(1024 * 1024);
+    cache.insert(SearchResultCacheKey(terms, 3, 10, 0, 1), results);
+    size_t entrySize = cache.size();
+
+    cache.setMaxSize(entrySize * 2);
+    cache.insert(SearchResultCacheKey(terms, 3, 10, 0, 2), results);
+    cache.insert(SearchResultCacheKey(terms, 3, 10, 0, 3), results);
+    ASSERT_EQ(entrySize * 2, cache.size());
+    ASSERT_EQ(1, cache.evictionCount());
+
+    QList<Result> cachedResults;
+    ASSERT_FALSE(cache.get(SearchResultCacheKey(terms, 3, 10, 0, 1), &cachedResults));
+    ASSERT_TRUE(cache.get(SearchResultCacheKey(terms, 3, 10, 0, 2), &cachedResults));
+    ASSERT_TRUE(cache.get(SearchResultCacheKey(terms, 3, 10, 0, 3), &cachedResults));
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "search_single_flight.h"
+
+namespace Acoustid {
+
+SearchSingleFlight::SearchSingleFlight() : m_enabled(1), m_sharedCount(0) {}
+
+SearchSingleFlight::~SearchSingleFlight() {}
+
+bool SearchSingleFlight::start(const SearchResultCacheKey &key, CallSharedPtr *call) {
+    QMutexLocker locker(&m_mutex);
+    auto existing = m_calls.value(key.hash());
+    if (existing && existing->key() == key) {
+        *call = existing;
+        return false;
+    }
+    *call = CallSharedPtr::create(key);
+    // On a hash collision, the search still runs, it just can't be joined.
+    if (!existing) {
+        m_calls.insert(key.hash(), *call);
+    }
+    return true;
+}
+
+void SearchSingleFlight::finish(const CallSharedPtr &call, const QList<Result> *results, bool approximate) {
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_calls.find(call->key().hash());
+        if (it != m_calls.end() && it.value() == call) {
+            m_calls.erase(it);
+        }
+    }
+    QMutexLocker locker(&call->m_mutex);
+    call->m_done = true;
+    call->m_failed = results == nullptr;
+    if (results) {
+        call->m_results = *results;
+        call->m_approximate = approximate;
+    }
+    call->m_finished.wakeAll();
+}
+
+bool SearchSingleFlight::wait(const CallSharedPtr &call, const QDeadlineTimer &deadline,
+                              const CancellationTokenSharedPtr &cancellation, QList<Result> *results,
+                              bool *approximate) {
+    QMutexLocker locker(&call->m_mutex);
+    while (!call->m_done) {
+        if (cancellation && cancellation->isCancelled()) {
+            throw SearchCancelled();
+        }
+        if (deadline.hasExpired()) {
+            throw TimeoutExceeded();
+        }
+        QDeadlineTimer next = deadline;
+        if (cancellation) {
+            QDeadlineTimer check(CANCELLATION_CHECK_INTERVAL);
+            if (check < next) {
+                next = check;
+            }
+        }
+        call->m_finished.wait(&call->m_mutex, next);
+    }
+    if (call->m_failed) {
+        return false;
+    }
+    *results = call->m_results;
+    if (approximate) {
+        *approximate = call->m_approximate;
+    }
+    m_sharedCount.fetchAndAddRelaxed(1);
+    return true;
+}
+
+}  // namespace Acoustid
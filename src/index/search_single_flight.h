@@ -0,0 +1,91 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_SEARCH_SINGLE_FLIGHT_H_
+#define ACOUSTID_INDEX_SEARCH_SINGLE_FLIGHT_H_
+
+#include <QAtomicInteger>
+#include <QDeadlineTimer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QWaitCondition>
+
+#include "common.h"
+#include "search_result_cache.h"
+#include "top_hits_collector.h"
+#include "util/cancellation_token.h"
+
+namespace Acoustid {
+
+// Collapses identical concurrent searches into one execution.
+//
+// The first search for a key becomes the leader and runs the search, the ones
+// that start while it's running wait for its results instead of scanning the
+// index again. The key includes the index revision, so only searches that
+// would return the same results are collapsed.
+class SearchSingleFlight {
+ public:
+    // One search in progress, shared by everybody who joined it.
+    class Call {
+     public:
+        explicit Call(const SearchResultCacheKey &key) : m_key(key) {}
+
+        const SearchResultCacheKey &key() const { return m_key; }
+
+     private:
+        friend class SearchSingleFlight;
+
+        SearchResultCacheKey m_key;
+        QMutex m_mutex;
+        QWaitCondition m_finished;
+        bool m_done = false;
+        bool m_failed = false;
+        bool m_approximate = false;
+        QList<Result> m_results;
+    };
+
+    typedef QSharedPointer<Call> CallSharedPtr;
+
+    SearchSingleFlight();
+    ~SearchSingleFlight();
+
+    bool isEnabled() const { return m_enabled.load(); }
+    void setEnabled(bool enabled) { m_enabled.store(enabled); }
+
+    // Returns true if the caller is the leader and has to run the search and call finish(),
+    // or false if there already is an identical search in progress and the caller should wait().
+    bool start(const SearchResultCacheKey &key, CallSharedPtr *call);
+
+    // Publish the leader's results to the waiters. Without results (the search failed or its
+    // results are partial), the waiters run the search on their own. The approximate flag
+    // is passed on to the waiters together with the results.
+    void finish(const CallSharedPtr &call, const QList<Result> *results, bool approximate = false);
+
+    // Wait for the leader's results. Returns false if the leader failed to produce them.
+    // Throws TimeoutExceeded once the deadline expires and SearchCancelled once the token
+    // is cancelled, no matter how long the leader is allowed to run.
+    bool wait(const CallSharedPtr &call, const QDeadlineTimer &deadline, const CancellationTokenSharedPtr &cancellation,
+              QList<Result> *results, bool *approximate = nullptr);
+
+    // Number of searches that were answered with the results of an identical one.
+    uint64_t sharedCount() const { return m_sharedCount.load(); }
+
+    // How often a waiter checks its cancellation token, in milliseconds.
+    static const int CANCELLATION_CHECK_INTERVAL = 10;
+
+ private:
+    ACOUSTID_DISABLE_COPY(SearchSingleFlight)
+
+    QMutex m_mutex;
+    QHash<quint64, CallSharedPtr> m_calls;
+    QAtomicInteger<int> m_enabled;
+    QAtomicInteger<quint64> m_sharedCount;
+};
+
+typedef QSharedPointer<SearchSingleFlight> SearchSingleFlightSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_SEARCH_SINGLE_FLIGHT_H_
@@ -0,0 +1,103 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include <QThread>
+#include <thread>
+
+#include "search_single_flight.h"
+
+using namespace Acoustid;
+
+TEST(SearchSingleFlightTest, ShareResults) {
+    SearchSingleFlight singleFlight;
+    uint32_t terms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+
+    SearchSingleFlight::CallSharedPtr leader, waiter;
+    ASSERT_TRUE(singleFlight.start(key, &leader));
+    ASSERT_FALSE(singleFlight.start(key, &waiter));
+    ASSERT_EQ(leader, waiter);
+
+    // A different revision is a different search.
+    SearchSingleFlight::CallSharedPtr other;
+    ASSERT_TRUE(singleFlight.start(SearchResultCacheKey(terms, 3, 10, 0, 2), &other));
+    singleFlight.finish(other, nullptr);
+
+    QList<Result> results;
+    bool shared = false;
+    std::thread thread([&]() {
+        shared = singleFlight.wait(waiter, QDeadlineTimer(10000), CancellationTokenSharedPtr(), &results);
+    });
+    QThread::msleep(20);
+    QList<Result> leaderResults{Result(1, 3), Result(2, 1)};
+    singleFlight.finish(leader, &leaderResults);
+    thread.join();
+
+    ASSERT_TRUE(shared);
+    ASSERT_EQ(2, results.size());
+    ASSERT_EQ(1, results[0].id());
+    ASSERT_EQ(1, singleFlight.sharedCount());
+
+    // Once finished, the next search for the same key runs again.
+    SearchSingleFlight::CallSharedPtr next;
+    ASSERT_TRUE(singleFlight.start(key, &next));
+    ASSERT_FALSE(singleFlight.start(key, &waiter));
+    // The approximate flag is shared together with the results.
+    singleFlight.finish(next, &leaderResults, true);
+    bool approximate = false;
+    ASSERT_TRUE(singleFlight.wait(waiter, QDeadlineTimer(10000), CancellationTokenSharedPtr(), &results, &approximate));
+    ASSERT_TRUE(approximate);
+    ASSERT_EQ(2, singleFlight.sharedCount());
+}
+
+TEST(SearchSingleFlightTest, LeaderFailed) {
+    SearchSingleFlight singleFlight;
+    uint32_t terms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+
+    SearchSingleFlight::CallSharedPtr leader, waiter;
+    ASSERT_TRUE(singleFlight.start(key, &leader));
+    ASSERT_FALSE(singleFlight.start(key, &waiter));
+    singleFlight.finish(leader, nullptr);
+
+    QList<Result> results;
+    ASSERT_FALSE(singleFlight.wait(waiter, QDeadlineTimer(10000), CancellationTokenSharedPtr(), &results));
+    ASSERT_EQ(0, singleFlight.sharedCount());
+}
+
+TEST(SearchSingleFlightTest, WaiterTimeout) {
+    SearchSingleFlight singleFlight;
+    uint32_t terms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+
+    SearchSingleFlight::CallSharedPtr leader, waiter;
+    ASSERT_TRUE(singleFlight.start(key, &leader));
+    ASSERT_FALSE(singleFlight.start(key, &waiter));
+
+    // The waiter gives up on its own deadline, even if the leader is still running.
+    QList<Result> results;
+    ASSERT_THROW(singleFlight.wait(waiter, QDeadlineTimer(20), CancellationTokenSharedPtr(), &results), TimeoutExceeded);
+    singleFlight.finish(leader, nullptr);
+}
+
+TEST(SearchSingleFlightTest, WaiterCancelled) {
+    SearchSingleFlight singleFlight;
+    uint32_t terms[] = {1, 2, 3};
+    SearchResultCacheKey key(terms, 3, 10, 0, 1);
+
+    SearchSingleFlight::CallSharedPtr leader, waiter;
+    ASSERT_TRUE(singleFlight.start(key, &leader));
+    ASSERT_FALSE(singleFlight.start(key, &waiter));
+
+    auto cancellation = CancellationTokenSharedPtr::create();
+    std::thread thread([&]() {
+        QThread::msleep(20);
+        cancellation->cancel();
+    });
+    QList<Result> results;
+    ASSERT_THROW(singleFlight.wait(waiter, QDeadlineTimer(10000), cancellation, &results), SearchCancelled);
+    thread.join();
+    singleFlight.finish(leader, nullptr);
+}
@@ -0,0 +1,28 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "segment_block_filter.h"
+
+#include "store/memory_input_stream.h"
+
+namespace Acoustid {
+
+SegmentBlockFilter::SegmentBlockFilter(InputStream *input, size_t blockCount)
+    : m_input(input), m_data(nullptr), m_blockCount(blockCount) {
+    size_t size = blockCount * SUMMARY_SIZE;
+    auto memoryInput = dynamic_cast<MemoryInputStream *>(input);
+    if (memoryInput) {
+        if (memoryInput->length() < size) {
+            throw CorruptIndexException("block filter is too short");
+        }
+        m_data = memoryInput->data();
+    } else {
+        m_buffer.resize(size);
+        m_input->readBytes(m_buffer.data(), size);
+        m_data = m_buffer.data();
+    }
+}
+
+SegmentBlockFilter::~SegmentBlockFilter() {}
+
+}  // namespace Acoustid
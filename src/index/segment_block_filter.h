@@ -0,0 +1,57 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_SEGMENT_BLOCK_FILTER_H_
+#define ACOUSTID_INDEX_SEGMENT_BLOCK_FILTER_H_
+
+#include <QSharedPointer>
+#include <vector>
+
+#include "common.h"
+
+namespace Acoustid {
+
+class InputStream;
+
+// Summaries of the keys in each data block of a segment.
+//
+// Every block has a 256-bit set of key hashes, stored one after another in a
+// side file. If none of the searched keys has its bit set, the block can be
+// skipped without decoding it. The summaries add 32 bytes per block.
+class SegmentBlockFilter {
+ public:
+    static const size_t SUMMARY_SIZE = 32;
+
+    // Add the key to a block summary of SUMMARY_SIZE bytes.
+    static void add(uint8_t *summary, uint32_t key) {
+        uint32_t bit = bitFor(key);
+        summary[bit >> 3] |= 1 << (bit & 7);
+    }
+
+    // Open the summaries for the given number of blocks. The data is used
+    // directly if the input is in memory (e.g. mmap'ed), otherwise it's read.
+    SegmentBlockFilter(InputStream *input, size_t blockCount);
+    ~SegmentBlockFilter();
+
+    size_t blockCount() const { return m_blockCount; }
+
+    // Returns false if the key is definitely not in the block.
+    bool mightContain(size_t block, uint32_t key) const {
+        uint32_t bit = bitFor(key);
+        return m_data[block * SUMMARY_SIZE + (bit >> 3)] & (1 << (bit & 7));
+    }
+
+ private:
+    static uint32_t bitFor(uint32_t key) { return (key * 0x85EBCA6Bu) >> 24; }
+
+    std::unique_ptr<InputStream> m_input;
+    std::vector<uint8_t> m_buffer;
+    const uint8_t *m_data;
+    size_t m_blockCount;
+};
+
+typedef QSharedPointer<SegmentBlockFilter> SegmentBlockFilterSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_SEGMENT_BLOCK_FILTER_H_
@@ -0,0 +1,73 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "segment_block_filter.h"
+#include "segment_data_writer.h"
+#include "segment_index_writer.h"
+#include "segment_searcher.h"
+#include "store/ram_directory.h"
+#include "store/input_stream.h"
+#include "store/output_stream.h"
+#include "top_hits_collector.h"
+
+using namespace Acoustid;
+
+TEST(SegmentBlockFilterTest, Search) {
+    RAMDirectory dir;
+    const size_t blockSize = 64;
+    SegmentIndexSharedPtr index;
+    size_t blockCount;
+    {
+        auto indexWriter = new SegmentIndexWriter(dir.createFile("segment_0.fii"));
+        SegmentDataWriter writer(dir.createFile("segment_0.fid"), indexWriter, blockSize);
+        writer.setBlockFilterOutput(dir.createFile("segment_0.fib"));
+        for (uint32_t i = 1; i <= 1000; i++) {
+            writer.addItem(i * 10, i);
+        }
+        writer.close();
+        index = writer.index();
+        blockCount = writer.blockCount();
+    }
+    ASSERT_GT(blockCount, 10);
+
+    auto blockFilter = SegmentBlockFilterSharedPtr::create(dir.openFile("segment_0.fib"), blockCount);
+    for (size_t block = 0; block < blockCount; block++) {
+        uint32_t lastKey = block + 1 < blockCount ? index->key(block + 1) : 10000;
+        for (uint32_t key = index->key(block); key < lastKey; key += 10) {
+            ASSERT_TRUE(blockFilter->mightContain(block, key)) << block << " " << key;
+        }
+    }
+
+    auto dataReader = SegmentDataReaderSharedPtr::create(dir.openFile("segment_0.fid"), blockSize);
+
+    std::vector<uint32_t> missing;
+    for (uint32_t i = 1; i <= 1000; i += 3) {
+        missing.push_back(i * 10 + 5);
+    }
+    {
+        TopHitsCollector collector(100);
+        SegmentSearcher searcher(index, dataReader, 10000);
+        searcher.setBlockFilter(blockFilter);
+        searcher.search(missing.data(), missing.size(), &collector);
+        ASSERT_EQ(0, collector.topResults().size());
+        ASSERT_GT(searcher.skippedBlockCount(), 0);
+    }
+
+    std::vector<uint32_t> fingerprint;
+    for (uint32_t i = 1; i <= 1000; i++) {
+        fingerprint.push_back(i * 10 + (i % 7 == 0 ? 0 : 5));
+    }
+    {
+        TopHitsCollector collector(1000);
+        SegmentSearcher searcher(index, dataReader, 10000);
+        searcher.setBlockFilter(blockFilter);
+        searcher.search(fingerprint.data(), fingerprint.size(), &collector);
+        ASSERT_EQ(1000 / 7, collector.topResults().size());
+        for (const auto &result : collector.topResults()) {
+            ASSERT_EQ(0, result.id() % 7);
+            ASSERT_EQ(1, result.score());
+        }
+    }
+}
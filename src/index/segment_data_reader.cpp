@@ -1,14 +1,20 @@
 // Copyright (C) 2011  Lukas Lalinsky
 // Distributed under the MIT license, see the LICENSE file for details.
 
-#include "store/output_stream.h"
+#include "store/memory_input_stream.h"
+#include "util/vint_decoder.h"
 #include "segment_data_reader.h"
 
 using namespace Acoustid;
 
 SegmentDataReader::SegmentDataReader(InputStream *input, size_t blockSize)
-	: m_input(input), m_blockSize(blockSize)
+	: m_input(input), m_mmapInput(dynamic_cast<MMapInputStream *>(input)), m_data(nullptr), m_dataLength(0), m_blockSize(blockSize)
 {
+	MemoryInputStream *memoryInput = dynamic_cast<MemoryInputStream *>(input);
+	if (memoryInput) {
+		m_data = memoryInput->data();
+		m_dataLength = memoryInput->length();
+	}
 }
 
 SegmentDataReader::~SegmentDataReader()
@@ -20,9 +26,115 @@ void SegmentDataReader::setBlockSize(size_t blockSize)
 	m_blockSize = blockSize;
 }
 
-BlockDataIterator *SegmentDataReader::readBlock(size_t n, uint32_t key)
+void SegmentDataReader::readBlock(size_t n, uint32_t key, BlockData *block)
 {
-	m_input->seek(m_blockSize * n);
-	size_t length = m_input->readInt16();
-	return new BlockDataIterator(m_input.get(), length, key);
+	static thread_local std::vector<uint8_t> buffer;
+	static thread_local std::vector<uint32_t> items;
+	size_t dataSize = m_blockSize - 2;
+	size_t offset = m_blockSize * n;
+	size_t length;
+	const uint8_t *data;
+	if (m_data) {
+		if (offset + m_blockSize > m_dataLength) {
+			throw IOException("reading past the end of data");
+		}
+		length = (m_data[offset] << 8) | m_data[offset + 1];
+		data = m_data + offset + 2;
+		if (offset + m_blockSize + kVInt32DecoderPadding > m_dataLength) {
+			// The decoder could read past the end of the file, use a padded copy.
+			buffer.assign(dataSize + kVInt32DecoderPadding, 0);
+			memcpy(buffer.data(), data, dataSize);
+			data = buffer.data();
+		}
+	}
+	else {
+		buffer.assign(dataSize + kVInt32DecoderPadding, 0);
+		QMutexLocker locker(&m_mutex);
+		m_input->seek(offset);
+		length = m_input->readInt16();
+		m_input->readBytes(buffer.data(), dataSize);
+		data = buffer.data();
+	}
+	// The first item only has a value, all the others have a key delta and a value.
+	size_t itemCount = length ? length * 2 - 1 : 0;
+	if (items.size() < itemCount) {
+		items.resize(itemCount);
+	}
+	if (decodeVInt32Array(data, dataSize, items.data(), itemCount) < 0) {
+		throw CorruptIndexException("invalid data block");
+	}
+	block->assign(items.data(), length, key);
+}
+
+uint32_t SegmentDataReader::readFirstValue(size_t n)
+{
+	size_t offset = m_blockSize * n;
+	uint32_t value;
+	if (m_data) {
+		if (offset + m_blockSize > m_dataLength) {
+			throw IOException("reading past the end of data");
+		}
+		if (decodeVInt32ArrayScalar(m_data + offset + 2, m_blockSize - 2, &value, 1) < 0) {
+			throw CorruptIndexException("invalid data block");
+		}
+		return value;
+	}
+	QMutexLocker locker(&m_mutex);
+	m_input->seek(offset + 2);
+	return m_input->readVInt32();
+}
+
+void SegmentDataReader::prefetchBlock(size_t n) const
+{
+	size_t offset = m_blockSize * n;
+	if (!m_data || offset + m_blockSize > m_dataLength) {
+		return;
+	}
+	for (size_t i = 0; i < m_blockSize; i += 64) {
+		__builtin_prefetch(m_data + offset + i);
+	}
+}
+
+void SegmentDataReader::willNeedBlocks(const std::vector<size_t> &blocks)
+{
+	if (!m_mmapInput) {
+		return;
+	}
+	size_t i = 0;
+	while (i < blocks.size()) {
+		size_t first = blocks[i], last = first;
+		while (++i < blocks.size() && blocks[i] <= last + 1) {
+			last = blocks[i];
+		}
+		m_mmapInput->willNeed(first * m_blockSize, (last - first + 1) * m_blockSize);
+	}
+}
+
+void BlockData::assign(const uint32_t *items, size_t length, uint32_t firstKey)
+{
+	if (m_keys.size() < length) {
+		m_keys.resize(length);
+		m_values.resize(length);
+	}
+	m_size = length;
+	if (!length) {
+		return;
+	}
+	uint32_t key = firstKey;
+	uint32_t value = items[0];
+	m_keys[0] = key;
+	m_values[0] = value;
+	for (size_t i = 1; i < length; i++) {
+		uint32_t keyDelta = items[i * 2 - 1];
+		uint32_t valueDelta = items[i * 2];
+		if (keyDelta) {
+			key += keyDelta;
+			value = valueDelta;
+		}
+		else {
+			value += valueDelta;
+		}
+		m_keys[i] = key;
+		m_values[i] = value;
+	}
 }
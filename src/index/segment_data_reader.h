@@ -4,51 +4,50 @@
 #ifndef ACOUSTID_INDEX_SEGMENT_DATA_READER_H_
 #define ACOUSTID_INDEX_SEGMENT_DATA_READER_H_
 
+#include <vector>
+#include <QMutex>
 #include "common.h"
 #include "store/input_stream.h"
+#include "store/mmap_input_stream.h"
 
 namespace Acoustid {
 
-class BlockDataIterator
+// Decoded contents of one data block.
+class BlockData
 {
 public:
-	BlockDataIterator(InputStream *input, size_t length, uint32_t firstKey)
-		: m_input(input), m_length(length), m_position(0), m_key(firstKey)
-	{
-	}
+	BlockData() : m_size(0) {}
+
+	size_t size() const { return m_size; }
+
+	const uint32_t *keys() const { return m_keys.data(); }
+	const uint32_t *values() const { return m_values.data(); }
 
-	bool next()
+	uint32_t key(size_t i) const { return m_keys[i]; }
+	uint32_t value(size_t i) const { return m_values[i]; }
+
+	// Fill the block from raw decoded varints, as they are stored on disk.
+	void assign(const uint32_t *items, size_t length, uint32_t firstKey);
+
+	// Approximate number of bytes used by the block.
+	size_t memoryUsage() const
 	{
-		if (m_position++ >= m_length) {
-			return false;
-		}
-
-		if (m_position == 1) {
-			// first item, read only the value
-			m_value = m_input->readVInt32();
-		}
-		else {
-			// read both key and value
-			uint32_t keyDelta = m_input->readVInt32(); 
-			if (keyDelta) {
-				m_value = 0;
-			}
-			m_key += keyDelta;
-			m_value += m_input->readVInt32();
-		}
-		return true;
+		return sizeof(BlockData) + (m_keys.capacity() + m_values.capacity()) * sizeof(uint32_t);
 	}
 
-	uint32_t key() { return m_key; }
-	uint32_t value() { return m_value; }
-
 private:
-	InputStream *m_input;
-	size_t m_position;
-	size_t m_length;
-	uint32_t m_key, m_value;
+	size_t m_size;
+	std::vector<uint32_t> m_keys;
+	std::vector<uint32_t> m_values;
 };
 
+typedef QSharedPointer<const BlockData> BlockDataSharedPtr;
+
+// Reads data blocks from a segment data file.
+//
+// Reading is thread-safe, one instance can be shared by all searches on the
+// segment. If the underlying input is in memory (e.g. mmap'ed), the blocks are
+// decoded straight from it, otherwise the reads are serialized.
 class SegmentDataReader
 {
 public:
@@ -58,13 +57,32 @@ public:
 	size_t blockSize() { return m_blockSize; }
 	void setBlockSize(size_t blockSize);
 
-	BlockDataIterator *readBlock(size_t n, uint32_t key);
+	// Read and decode the n-th block, reusing the memory in `block`.
+	void readBlock(size_t n, uint32_t key, BlockData *block);
+
+	// Read only the value of the first item in the n-th block, without decoding the rest.
+	uint32_t readFirstValue(size_t n);
+
+	// Hint the CPU to start loading the n-th block, if the data is in memory.
+	void prefetchBlock(size_t n) const;
+
+	// Ask the OS to start reading the blocks from disk, if the data is memory mapped.
+	// The block numbers must be sorted, consecutive blocks are requested together.
+	void willNeedBlocks(const std::vector<size_t> &blocks);
 
 private:
+	ACOUSTID_DISABLE_COPY(SegmentDataReader)
+
+	QMutex m_mutex;
 	std::unique_ptr<InputStream> m_input;
+	MMapInputStream *m_mmapInput;
+	const uint8_t *m_data;
+	size_t m_dataLength;
 	size_t m_blockSize;
 };
 
+typedef QSharedPointer<SegmentDataReader> SegmentDataReaderSharedPtr;
+
 }
 
 #endif
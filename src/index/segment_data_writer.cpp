@@ -1,6 +1,7 @@
 // Copyright (C) 2011  Lukas Lalinsky
 // Distributed under the MIT license, see the LICENSE file for details.
 
+#include <algorithm>
 #include "store/output_stream.h"
 #include "util/vint.h"
 #include "segment_data_writer.h"
@@ -8,11 +9,17 @@
 
 using namespace Acoustid;
 
+// Maximum number of distinct keys in a segment with a filter.
+static const size_t MAX_FILTER_KEYS = 1 << 24;
+
 SegmentDataWriter::SegmentDataWriter(OutputStream *output, SegmentIndexWriter *indexWriter, size_t blockSize)
-	: m_output(output), m_indexWriter(indexWriter), m_blockSize(blockSize),
-	  m_buffer(0), m_ptr(0), m_itemCount(0), m_lastKey(0), m_lastValue(0),
-	  m_blockCount(0), m_checksum(0)
+	: m_output(output), m_indexWriter(indexWriter), m_buildFilter(false),
+	  m_runKey(0), m_runLength(0), m_maxKeyPostings(0),
+	  m_hasPendingKey(false), m_pendingKeyStopped(false), m_pendingKey(0), m_droppedChecksum(0),
+	  m_firstKey(0), m_blockSize(blockSize), m_lastKey(0), m_lastValue(0), m_checksum(0),
+	  m_itemCount(0), m_blockCount(0), m_ptr(0), m_buffer(0)
 {
+	memset(m_blockSummary, 0, sizeof(m_blockSummary));
 }
 
 SegmentDataWriter::~SegmentDataWriter()
@@ -20,6 +27,24 @@ SegmentDataWriter::~SegmentDataWriter()
 	close();
 }
 
+void SegmentDataWriter::setBlockFilterOutput(OutputStream *output)
+{
+	m_blockFilterOutput.reset(output);
+}
+
+void SegmentDataWriter::setBuildTermStats(bool buildTermStats)
+{
+	m_termStats = buildTermStats ? SegmentTermStatsSharedPtr::create() : SegmentTermStatsSharedPtr();
+}
+
+void SegmentDataWriter::finishKeyRun()
+{
+	if (m_runLength >= SegmentTermStats::MIN_POSTINGS) {
+		m_termStats->add(m_runKey, m_runLength);
+	}
+	m_runLength = 0;
+}
+
 void SegmentDataWriter::setBlockSize(size_t blockSize)
 {
 	m_buffer.reset();
@@ -31,6 +56,10 @@ void SegmentDataWriter::writeBlock()
 	assert(m_itemCount < (1 << 16));
 	m_output->writeInt16(m_itemCount);
 	m_output->writeBytes(m_buffer.get(), m_blockSize - 2);
+	if (m_blockFilterOutput) {
+		m_blockFilterOutput->writeBytes(m_blockSummary, sizeof(m_blockSummary));
+		memset(m_blockSummary, 0, sizeof(m_blockSummary));
+	}
 	m_ptr = m_buffer.get();
 	m_itemCount = 0;
 	m_blockCount++;
@@ -38,10 +67,69 @@ void SegmentDataWriter::writeBlock()
 }
 
 void SegmentDataWriter::addItem(uint32_t key, uint32_t value)
+{
+	if (m_maxKeyPostings == 0 && m_inputStopKeys.empty()) {
+		writeItem(key, value);
+		return;
+	}
+	if (m_hasPendingKey && key != m_pendingKey) {
+		flushPendingKey();
+	}
+	if (!m_hasPendingKey) {
+		m_hasPendingKey = true;
+		m_pendingKey = key;
+		m_pendingKeyStopped = std::binary_search(m_inputStopKeys.begin(), m_inputStopKeys.end(), key);
+	}
+	if (m_pendingKeyStopped) {
+		m_droppedChecksum ^= key ^ value;
+		return;
+	}
+	m_pendingValues.push_back(value);
+	if (m_maxKeyPostings && m_pendingValues.size() > m_maxKeyPostings) {
+		for (uint32_t pendingValue : m_pendingValues) {
+			m_droppedChecksum ^= key ^ pendingValue;
+		}
+		m_pendingValues.clear();
+		m_pendingKeyStopped = true;
+	}
+}
+
+void SegmentDataWriter::flushPendingKey()
+{
+	if (m_pendingKeyStopped) {
+		m_stopKeys.push_back(m_pendingKey);
+	}
+	for (uint32_t value : m_pendingValues) {
+		writeItem(m_pendingKey, value);
+	}
+	m_pendingValues.clear();
+	m_hasPendingKey = false;
+	m_pendingKeyStopped = false;
+}
+
+void SegmentDataWriter::writeItem(uint32_t key, uint32_t value)
 {
 	assert(key >= m_lastKey);
 	assert(key == m_lastKey ? value >= m_lastValue : 1);
 
+	if (m_buildFilter && (m_filterKeys.empty() || m_filterKeys.back() != key)) {
+		if (m_filterKeys.size() < MAX_FILTER_KEYS) {
+			m_filterKeys.push_back(key);
+		}
+		else {
+			m_buildFilter = false;
+			m_filterKeys = std::vector<uint32_t>();
+		}
+	}
+
+	if (m_termStats) {
+		if (m_runLength && key != m_runKey) {
+			finishKeyRun();
+		}
+		m_runKey = key;
+		m_runLength++;
+	}
+
 	//qDebug() << "Adding" << key << "to checksum =" << m_checksum;
 	m_checksum ^= key;
 	m_checksum ^= value;
@@ -70,12 +158,18 @@ void SegmentDataWriter::addItem(uint32_t key, uint32_t value)
 		m_ptr += writeVInt32ToArray(m_ptr, keyDelta);
 	}
 	else {
+		if (m_indexData.empty() && !m_blockCount) {
+			m_firstKey = key;
+		}
 		m_indexData.push_back(key);
 		if (m_indexWriter) {
 			m_indexWriter->addItem(key);
 		}
 	}
 	m_ptr += writeVInt32ToArray(m_ptr, valueDelta);
+	if (m_blockFilterOutput) {
+		SegmentBlockFilter::add(m_blockSummary, key);
+	}
 
 	m_lastKey = key;
 	m_lastValue = value;
@@ -88,13 +182,41 @@ void SegmentDataWriter::addItem(uint32_t key, uint32_t value)
 
 void SegmentDataWriter::close()
 {
+	if (m_hasPendingKey) {
+		flushPendingKey();
+	}
 	if (m_itemCount) {
 		writeBlock();
 	}
 	m_index = SegmentIndexSharedPtr(new SegmentIndex(m_blockCount));
 	std::copy(m_indexData.begin(), m_indexData.end(), m_index->keys());
+	m_index->buildDirectory();
 	m_indexData.clear();
+	if (m_buildFilter) {
+		m_filter = SegmentFilterSharedPtr::create(m_filterKeys.size());
+		for (uint32_t key : m_filterKeys) {
+			m_filter->add(key);
+		}
+		m_buildFilter = false;
+		m_filterKeys = std::vector<uint32_t>();
+	}
+	if (m_termStats) {
+		finishKeyRun();
+	}
+	if (m_maxKeyPostings || !m_stopKeys.empty() || !m_inputStopKeys.empty()) {
+		if (!m_termStats) {
+			m_termStats = SegmentTermStatsSharedPtr::create();
+		}
+		// Stop keys of the merged segments stay stopped, even if there was nothing left to drop.
+		std::vector<uint32_t> stopKeys;
+		std::set_union(m_stopKeys.begin(), m_stopKeys.end(), m_inputStopKeys.begin(), m_inputStopKeys.end(), std::back_inserter(stopKeys));
+		m_termStats->setMaxKeyPostings(m_maxKeyPostings);
+		m_termStats->setStopKeys(stopKeys);
+	}
 	m_output->flush();
+	if (m_blockFilterOutput) {
+		m_blockFilterOutput->flush();
+	}
 	m_indexWriter->close();
 }
 
@@ -6,6 +6,9 @@
 
 #include "common.h"
 #include "segment_index.h"
+#include "segment_filter.h"
+#include "segment_block_filter.h"
+#include "segment_term_stats.h"
 
 namespace Acoustid {
 
@@ -23,6 +26,9 @@ public:
 	// Number of blocks written into the file.
 	size_t blockCount() const { return m_blockCount; }
 
+	// First key written into the file.
+	uint32_t firstKey() const { return m_firstKey; }
+
 	// Last key written into the file.
 	uint32_t lastKey() const { return m_lastKey; }
 
@@ -30,6 +36,33 @@ public:
 
 	SegmentIndexSharedPtr index() const { return m_index; }
 
+	// Build a membership filter of the keys on close. Segments with too many
+	// distinct keys don't get a filter, it would not skip much in them.
+	void setBuildFilter(bool buildFilter) { m_buildFilter = buildFilter; }
+
+	// The filter built on close, if any.
+	SegmentFilterSharedPtr filter() const { return m_filter; }
+
+	// Count the postings of each key and keep the statistics of the frequent ones, see SegmentTermStats.
+	void setBuildTermStats(bool buildTermStats);
+
+	// The term statistics built on close, if any.
+	SegmentTermStatsSharedPtr termStats() const { return m_termStats; }
+
+	// Keep at most this many postings per key, keys with more are written as stop keys
+	// without any postings. Zero, the default, means no cap.
+	void setMaxKeyPostings(uint32_t maxKeyPostings) { m_maxKeyPostings = maxKeyPostings; }
+
+	// Drop all postings of these sorted keys and keep them as stop keys, used to carry
+	// the stop keys of merged segments over.
+	void setStopKeys(const std::vector<uint32_t> &keys) { m_inputStopKeys = keys; }
+
+	// XOR of the keys and values of the dropped postings, they are not part of checksum().
+	uint32_t droppedChecksum() const { return m_droppedChecksum; }
+
+	// Write a summary of the keys in each block into `output`, see SegmentBlockFilter.
+	void setBlockFilterOutput(OutputStream *output);
+
 	size_t blockSize() { return m_blockSize; }
 	void setBlockSize(size_t blockSize);
 
@@ -38,11 +71,32 @@ public:
 
 private:
 	void writeBlock();
+	void writeItem(uint32_t key, uint32_t value);
+	void finishKeyRun();
+	void flushPendingKey();
 
 	std::unique_ptr<OutputStream> m_output;
 	std::unique_ptr<SegmentIndexWriter> m_indexWriter;
 	SegmentIndexSharedPtr m_index;
 	std::vector<uint32_t> m_indexData;
+	bool m_buildFilter;
+	std::unique_ptr<OutputStream> m_blockFilterOutput;
+	uint8_t m_blockSummary[SegmentBlockFilter::SUMMARY_SIZE];
+	std::vector<uint32_t> m_filterKeys;
+	SegmentFilterSharedPtr m_filter;
+	SegmentTermStatsSharedPtr m_termStats;
+	uint32_t m_runKey;
+	uint32_t m_runLength;
+	uint32_t m_maxKeyPostings;
+	std::vector<uint32_t> m_inputStopKeys;
+	std::vector<uint32_t> m_stopKeys;
+	// Postings of the current key, held back until it's known whether the key has too many.
+	bool m_hasPendingKey;
+	bool m_pendingKeyStopped;
+	uint32_t m_pendingKey;
+	std::vector<uint32_t> m_pendingValues;
+	uint32_t m_droppedChecksum;
+	uint32_t m_firstKey;
 	size_t m_blockSize;
 	uint32_t m_lastKey;
 	uint32_t m_lastValue;
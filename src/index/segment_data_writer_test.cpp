@@ -50,3 +50,56 @@ TEST_F(SegmentDataWriterTest, Write)
 	ASSERT_EQ(303, input->readVInt32());
 }
 
+
+TEST_F(SegmentDataWriterTest, TermStats)
+{
+	SegmentIndexWriter *indexWriter = new SegmentIndexWriter(indexStream);
+
+	SegmentDataWriter writer(stream, indexWriter, BLOCK_SIZE);
+	writer.setBuildTermStats(true);
+	for (uint32_t i = 0; i < SegmentTermStats::MIN_POSTINGS; i++) {
+		writer.addItem(5, i);
+	}
+	writer.addItem(6, 1);
+	for (uint32_t i = 0; i < SegmentTermStats::MIN_POSTINGS + 10; i++) {
+		writer.addItem(7, i);
+	}
+	writer.close();
+
+	// Only the keys with enough postings to fill a block are recorded.
+	auto stats = writer.termStats();
+	ASSERT_TRUE(stats);
+	ASSERT_EQ(2, stats->size());
+	ASSERT_EQ(SegmentTermStats::MIN_POSTINGS, stats->postingCount(5));
+	ASSERT_EQ(0, stats->postingCount(6));
+	ASSERT_EQ(SegmentTermStats::MIN_POSTINGS + 10, stats->postingCount(7));
+}
+
+TEST_F(SegmentDataWriterTest, MaxKeyPostings)
+{
+	SegmentIndexWriter *indexWriter = new SegmentIndexWriter(indexStream);
+
+	SegmentDataWriter writer(stream, indexWriter, BLOCK_SIZE);
+	writer.setMaxKeyPostings(3);
+	writer.setStopKeys({ 7, 9 });
+	for (uint32_t i = 0; i < 4; i++) {
+		writer.addItem(5, i);
+	}
+	for (uint32_t i = 0; i < 3; i++) {
+		writer.addItem(6, i);
+	}
+	writer.addItem(7, 1);
+	writer.addItem(8, 1);
+	writer.close();
+
+	// Key 5 has too many postings and key 7 was already stopped, key 9 stays stopped.
+	ASSERT_EQ(1, writer.blockCount());
+	ASSERT_EQ(6, writer.firstKey());
+	ASSERT_EQ(8, writer.lastKey());
+	ASSERT_EQ((6 ^ 0) ^ (6 ^ 1) ^ (6 ^ 2) ^ (8 ^ 1), writer.checksum());
+	ASSERT_EQ((5 ^ 0) ^ (5 ^ 1) ^ (5 ^ 2) ^ (5 ^ 3) ^ (7 ^ 1), writer.droppedChecksum());
+	auto stats = writer.termStats();
+	ASSERT_TRUE(stats);
+	ASSERT_EQ(3, stats->maxKeyPostings());
+	ASSERT_EQ(std::vector<uint32_t>({ 5, 7, 9 }), stats->stopKeys());
+}
@@ -14,19 +14,19 @@ class SegmentEnum
 {
 public:
 	SegmentEnum(SegmentIndexSharedPtr index, SegmentDataReader *dataReader)
-		: m_index(index), m_dataReader(dataReader), m_block(0),
-		  m_currentBlock(nullptr)
+		: m_index(index), m_dataReader(dataReader), m_block(0), m_position(0)
 	{}
 
 	bool next()
 	{
-		if (!m_currentBlock.get() || !m_currentBlock->next()) {
+		m_position++;
+		while (m_position >= m_blockData.size()) {
 			if (m_block >= m_index->blockCount()) {
 				return false;
 			}
 			uint32_t firstKey = m_index->key(m_block);
-			m_currentBlock.reset(m_dataReader->readBlock(m_block, firstKey));
-			m_currentBlock->next();
+			m_dataReader->readBlock(m_block, firstKey, &m_blockData);
+			m_position = 0;
 			m_block++;
 		}
 		return true;
@@ -34,19 +34,20 @@ public:
 
 	uint32_t key()
 	{
-		return m_currentBlock->key();
+		return m_blockData.key(m_position);
 	}
 
 	uint32_t value()
 	{
-		return m_currentBlock->value();
+		return m_blockData.value(m_position);
 	}
 
 private:
-	size_t m_block;
 	SegmentIndexSharedPtr m_index;
 	std::unique_ptr<SegmentDataReader> m_dataReader;
-	std::unique_ptr<BlockDataIterator> m_currentBlock;
+	size_t m_block;
+	size_t m_position;
+	BlockData m_blockData;
 };
 
 }
@@ -0,0 +1,37 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "segment_filter.h"
+
+#include "store/input_stream.h"
+#include "store/output_stream.h"
+
+namespace Acoustid {
+
+SegmentFilter::SegmentFilter(size_t expectedKeyCount)
+    : m_blockCount(std::max<size_t>(1, (expectedKeyCount * BITS_PER_KEY + BLOCK_WORDS * 32 - 1) / (BLOCK_WORDS * 32))),
+      m_words(m_blockCount * BLOCK_WORDS) {}
+
+void SegmentFilter::save(OutputStream *output) const {
+    output->writeVInt32(m_blockCount);
+    for (auto word : m_words) {
+        output->writeInt32(word);
+    }
+    output->flush();
+}
+
+SegmentFilterSharedPtr SegmentFilter::load(InputStream *input) {
+    size_t blockCount = input->readVInt32();
+    if (blockCount == 0) {
+        throw CorruptIndexException("invalid segment filter");
+    }
+    auto filter = SegmentFilterSharedPtr::create(0);
+    filter->m_blockCount = blockCount;
+    filter->m_words.resize(blockCount * BLOCK_WORDS);
+    for (auto &word : filter->m_words) {
+        word = input->readInt32();
+    }
+    return filter;
+}
+
+}  // namespace Acoustid
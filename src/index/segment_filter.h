@@ -0,0 +1,78 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_SEGMENT_FILTER_H_
+#define ACOUSTID_INDEX_SEGMENT_FILTER_H_
+
+#include <QSharedPointer>
+#include <vector>
+
+#include "common.h"
+
+namespace Acoustid {
+
+class InputStream;
+class OutputStream;
+
+// Membership filter for the keys in one segment.
+//
+// This is a split block Bloom filter. Each key maps to one 256-bit block and
+// sets one bit in each of its eight words, so checking a key touches a single
+// cache line. With 10 bits per key, about 1% of the keys not in the segment
+// pass the filter.
+class SegmentFilter {
+ public:
+    static const size_t BLOCK_WORDS = 8;
+    static const size_t BITS_PER_KEY = 10;
+
+    // Create an empty filter sized for the given number of keys.
+    SegmentFilter(size_t expectedKeyCount);
+
+    size_t blockCount() const { return m_blockCount; }
+
+    void add(uint32_t key) {
+        uint32_t *block = &m_words[blockOffset(key)];
+        for (size_t i = 0; i < BLOCK_WORDS; i++) {
+            block[i] |= bitFor(key, i);
+        }
+    }
+
+    // Returns false if the key is definitely not in the segment.
+    bool mightContain(uint32_t key) const {
+        const uint32_t *block = &m_words[blockOffset(key)];
+        for (size_t i = 0; i < BLOCK_WORDS; i++) {
+            if (!(block[i] & bitFor(key, i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Approximate number of bytes used by the filter.
+    size_t memoryUsage() const { return sizeof(SegmentFilter) + m_words.capacity() * sizeof(uint32_t); }
+
+    void save(OutputStream *output) const;
+    static QSharedPointer<SegmentFilter> load(InputStream *input);
+
+ private:
+    // Position of the first word of the key's block.
+    size_t blockOffset(uint32_t key) const {
+        uint64_t hash = uint64_t(key) * 0x9E3779B97F4A7C15ull;
+        return ((hash >> 32) * m_blockCount >> 32) * BLOCK_WORDS;
+    }
+
+    static uint32_t bitFor(uint32_t key, size_t i) {
+        static const uint32_t salts[BLOCK_WORDS] = {0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+                                                    0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31};
+        return 1u << ((key * salts[i]) >> 27);
+    }
+
+    size_t m_blockCount;
+    std::vector<uint32_t> m_words;
+};
+
+typedef QSharedPointer<SegmentFilter> SegmentFilterSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_INDEX_SEGMENT_FILTER_H_
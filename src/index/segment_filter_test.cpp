@@ -0,0 +1,46 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include "segment_filter.h"
+#include "store/ram_directory.h"
+#include "store/input_stream.h"
+#include "store/output_stream.h"
+
+using namespace Acoustid;
+
+TEST(SegmentFilterTest, MightContain) {
+    SegmentFilter filter(10000);
+    for (uint32_t i = 0; i < 10000; i++) {
+        filter.add(i * 7919);
+    }
+    for (uint32_t i = 0; i < 10000; i++) {
+        ASSERT_TRUE(filter.mightContain(i * 7919)) << i;
+    }
+    size_t falsePositives = 0;
+    for (uint32_t i = 0; i < 100000; i++) {
+        if (filter.mightContain(0x80000000 + i * 7)) {
+            falsePositives++;
+        }
+    }
+    ASSERT_LT(falsePositives, 3000);
+}
+
+TEST(SegmentFilterTest, SaveAndLoad) {
+    RAMDirectory dir;
+    SegmentFilter filter(100);
+    for (uint32_t i = 0; i < 100; i++) {
+        filter.add(i * 12345);
+    }
+    {
+        std::unique_ptr<OutputStream> output(dir.createFile("filter"));
+        filter.save(output.get());
+    }
+    std::unique_ptr<InputStream> input(dir.openFile("filter"));
+    auto loaded = SegmentFilter::load(input.get());
+    ASSERT_EQ(filter.blockCount(), loaded->blockCount());
+    for (uint32_t i = 0; i < 100000; i++) {
+        ASSERT_EQ(filter.mightContain(i), loaded->mightContain(i)) << i;
+    }
+}
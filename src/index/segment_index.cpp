@@ -2,15 +2,54 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <math.h>
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "store/output_stream.h"
 #include "util/search_utils.h"
 #include "segment_index.h"
 
 using namespace Acoustid;
 
+// Number of keys in one S-tree node, they fill one cache line.
+static const size_t NODE_KEYS = 16;
+
+// Count the keys in the node that are smaller than `key`.
+static inline size_t countSmaller(const uint32_t *node, uint32_t key)
+{
+#ifdef __SSE2__
+	// SSE2 only has signed comparisons, flip the sign bits to compare unsigned values.
+	const __m128i sign = _mm_set1_epi32(0x80000000);
+	const __m128i value = _mm_xor_si128(_mm_set1_epi32(key), sign);
+	const __m128i *data = reinterpret_cast<const __m128i *>(node);
+	int mask = 0;
+	for (int i = 0; i < 4; i++) {
+		__m128i lt = _mm_cmpgt_epi32(value, _mm_xor_si128(_mm_load_si128(data + i), sign));
+		mask |= _mm_movemask_ps(_mm_castsi128_ps(lt)) << (i * 4);
+	}
+	return __builtin_popcount(mask);
+#else
+	size_t count = 0;
+	for (size_t i = 0; i < NODE_KEYS; i++) {
+		count += node[i] < key;
+	}
+	return count;
+#endif
+}
+
+// Indexes with fewer blocks don't get a directory.
+static const size_t MIN_DIRECTORY_BLOCKS = 1 << 16;
+
+// Bounds for the number of directory bits.
+static const int MIN_DIRECTORY_BITS = 16;
+static const int MAX_DIRECTORY_BITS = 20;
+
 SegmentIndex::SegmentIndex(size_t blockCount)
 	: m_blockCount(blockCount),
-	  m_keys(new uint32_t[blockCount])
+	  m_keys(new uint32_t[blockCount]),
+	  m_layout(SORTED_INDEX_LAYOUT),
+	  m_directoryShift(32)
 {
 }
 
@@ -18,9 +57,118 @@ SegmentIndex::~SegmentIndex()
 {
 }
 
+void SegmentIndex::setLayout(SegmentIndexLayout layout)
+{
+	m_layout = layout;
+	m_treeData.clear();
+	m_treeData.shrink_to_fit();
+	m_levels.clear();
+	m_levelSizes.clear();
+	if (layout != STREE_INDEX_LAYOUT || !m_blockCount) {
+		return;
+	}
+	// Each level has one key per node of the level below, the largest key in that node.
+	// The levels are padded to whole nodes with keys that never compare smaller.
+	std::vector<size_t> offsets;
+	size_t totalSize = 0;
+	size_t levelSize = m_blockCount;
+	while (true) {
+		offsets.push_back(totalSize);
+		m_levelSizes.push_back(levelSize);
+		totalSize += (levelSize + NODE_KEYS - 1) / NODE_KEYS * NODE_KEYS;
+		if (levelSize <= NODE_KEYS) {
+			break;
+		}
+		levelSize = (levelSize + NODE_KEYS - 1) / NODE_KEYS;
+	}
+	// Align the nodes to cache lines.
+	m_treeData.assign(totalSize + NODE_KEYS, UINT32_MAX);
+	uint32_t *tree = m_treeData.data();
+	size_t misalignment = (reinterpret_cast<uintptr_t>(tree) % 64) / sizeof(uint32_t);
+	if (misalignment) {
+		tree += NODE_KEYS - misalignment;
+	}
+	for (size_t level = 0; level < offsets.size(); level++) {
+		m_levels.push_back(tree + offsets[level]);
+	}
+	std::copy(m_keys.get(), m_keys.get() + m_blockCount, m_levels[0]);
+	for (size_t level = 1; level < m_levels.size(); level++) {
+		const uint32_t *below = m_levels[level - 1];
+		size_t belowSize = m_levelSizes[level - 1];
+		for (size_t i = 0; i < m_levelSizes[level]; i++) {
+			m_levels[level][i] = below[std::min(i * NODE_KEYS + NODE_KEYS - 1, belowSize - 1)];
+		}
+	}
+}
+
+QSharedPointer<SegmentIndex> SegmentIndex::withLayout(SegmentIndexLayout layout)
+{
+	QSharedPointer<SegmentIndex> index(new SegmentIndex(m_blockCount));
+	std::copy(m_keys.get(), m_keys.get() + m_blockCount, index->keys());
+	index->setLayout(layout);
+	if (hasDirectory()) {
+		index->buildDirectory();
+	}
+	return index;
+}
+
+void SegmentIndex::buildDirectory()
+{
+	m_directory.clear();
+	m_directory.shrink_to_fit();
+	m_directoryShift = 32;
+	if (m_blockCount < MIN_DIRECTORY_BLOCKS) {
+		return;
+	}
+	// Aim for about one block per entry, so the table is not larger than the keys.
+	int bits = MIN_DIRECTORY_BITS;
+	while (bits < MAX_DIRECTORY_BITS && (size_t(1) << (bits + 1)) <= m_blockCount) {
+		bits++;
+	}
+	size_t size = size_t(1) << bits;
+	m_directoryShift = 32 - bits;
+	// Entry i holds the first block whose key has the top bits >= i, the extra
+	// entry at the end marks the end of the last range.
+	m_directory.resize(size + 1);
+	size_t block = 0;
+	for (size_t i = 0; i < size; i++) {
+		while (block < m_blockCount && (m_keys[block] >> m_directoryShift) < i) {
+			block++;
+		}
+		m_directory[i] = block;
+	}
+	m_directory[size] = m_blockCount;
+}
+
+size_t SegmentIndex::memoryUsage() const
+{
+	return sizeof(SegmentIndex) + (m_blockCount + m_treeData.capacity() + m_directory.capacity()) * sizeof(uint32_t);
+}
+
+size_t SegmentIndex::lowerBound(uint32_t key)
+{
+	if (!m_directory.empty()) {
+		// Only the blocks starting with the same top bits need to be searched.
+		size_t i = key >> m_directoryShift;
+		const uint32_t *keys = m_keys.get();
+		return std::lower_bound(keys + m_directory[i], keys + m_directory[i + 1], key) - keys;
+	}
+	if (m_levels.empty()) {
+		return std::lower_bound(m_keys.get(), m_keys.get() + m_blockCount, key) - m_keys.get();
+	}
+	size_t pos = 0;
+	for (size_t level = m_levels.size() - 1; level > 0; level--) {
+		pos = pos * NODE_KEYS + countSmaller(m_levels[level] + pos * NODE_KEYS, key);
+		if (pos >= m_levelSizes[level]) {
+			return m_blockCount;
+		}
+	}
+	return pos * NODE_KEYS + countSmaller(m_levels[0] + pos * NODE_KEYS, key);
+}
+
 bool SegmentIndex::search(uint32_t key, size_t *firstBlock, size_t *lastBlock)
 {
-	ssize_t pos = searchFirstSmaller(m_keys.get(), 0, m_blockCount, key);
+	ssize_t pos = ssize_t(lowerBound(key)) - 1;
 	if (pos == -1) {
 		if (m_keys[0] > key) {
 			return false;
@@ -28,7 +176,8 @@ bool SegmentIndex::search(uint32_t key, size_t *firstBlock, size_t *lastBlock)
 		pos = 0;
 	}
 	*firstBlock = pos;
-	*lastBlock = scanFirstGreater(m_keys.get(), *firstBlock, m_blockCount, key) - 1;
+	uint32_t *keys = m_levels.empty() ? m_keys.get() : m_levels[0];
+	*lastBlock = scanFirstGreater(keys, *firstBlock, m_blockCount, key) - 1;
 	return true;
 }
 
@@ -4,11 +4,22 @@
 #ifndef ACOUSTID_INDEX_SEGMENT_INDEX_H_
 #define ACOUSTID_INDEX_SEGMENT_INDEX_H_
 
+#include <vector>
 #include <QSharedPointer>
 #include "common.h"
 
 namespace Acoustid {
 
+// In-memory layout of the block keys used by SegmentIndex::search.
+enum SegmentIndexLayout {
+	// Binary search over the sorted keys.
+	SORTED_INDEX_LAYOUT,
+	// Static B+ tree with 16 keys per node (S-tree). Each node is one cache
+	// line and is searched with SIMD comparisons, without branches. Uses a
+	// copy of the keys as the leaf level.
+	STREE_INDEX_LAYOUT,
+};
+
 class SegmentIndex
 {
 public:
@@ -17,6 +28,26 @@ public:
 
 	size_t blockCount() { return m_blockCount; }
 
+	SegmentIndexLayout layout() const { return m_layout; }
+
+	// Build the search structures for the given layout. Must be called after
+	// the keys are filled and before the index is shared with other threads.
+	void setLayout(SegmentIndexLayout layout);
+
+	// Returns a copy of the index with the given layout.
+	QSharedPointer<SegmentIndex> withLayout(SegmentIndexLayout layout);
+
+	// Build a table mapping the top bits of a key to the range of blocks that
+	// can contain it, so that a search only needs to look at a few keys. Only
+	// large indexes get one, for small ones the table would not pay off.
+	// Must be called after the keys are filled, like setLayout.
+	void buildDirectory();
+
+	bool hasDirectory() const { return !m_directory.empty(); }
+
+	// Approximate number of bytes used by the index.
+	size_t memoryUsage() const;
+
 	uint32_t *keys() { return m_keys.get(); }
 
 	uint32_t key(size_t block)
@@ -28,8 +59,17 @@ public:
 
 
 private:
+	size_t lowerBound(uint32_t key);
+
 	size_t m_blockCount;
 	std::unique_ptr<uint32_t[]> m_keys;
+	SegmentIndexLayout m_layout;
+	std::vector<uint32_t> m_treeData;
+	// Tree levels, the leaves first.
+	std::vector<uint32_t *> m_levels;
+	std::vector<size_t> m_levelSizes;
+	std::vector<uint32_t> m_directory;
+	int m_directoryShift;
 };
 
 typedef QWeakPointer<SegmentIndex> SegmentIndexWeakPtr;
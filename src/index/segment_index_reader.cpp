@@ -23,6 +23,7 @@ SegmentIndexSharedPtr SegmentIndexReader::read()
 	for (size_t i = 0; i < m_blockCount; i++) {
 		*keys++ = m_input->readInt32();
 	}
+	index->buildDirectory();
 	return index;
 }
 
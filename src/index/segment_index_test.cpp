@@ -1,6 +1,7 @@
 // Copyright (C) 2011  Lukas Lalinsky
 // Distributed under the MIT license, see the LICENSE file for details.
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <QFile>
 #include "util/test_utils.h"
@@ -88,3 +89,71 @@ TEST(SegmentIndexTest, Search)
 	EXPECT_EQ(7, lastBlock);
 }
 
+
+TEST(SegmentIndexTest, SearchSTree)
+{
+	for (size_t blockCount = 1; blockCount < 300; blockCount++) {
+		SegmentIndex index(blockCount);
+		uint32_t *data = index.keys();
+		for (size_t i = 0; i < blockCount; i++) {
+			// Sorted keys with gaps and duplicates.
+			data[i] = 1 + i / 3 * 2 + (i % 3 == 2 ? 1 : 0);
+		}
+		auto stree = index.withLayout(STREE_INDEX_LAYOUT);
+		ASSERT_EQ(STREE_INDEX_LAYOUT, stree->layout());
+		ASSERT_EQ(blockCount, stree->blockCount());
+		for (uint32_t key = 0; key <= data[blockCount - 1] + 1; key++) {
+			size_t firstBlock = 0, lastBlock = 0, expectedFirstBlock = 0, expectedLastBlock = 0;
+			bool found = stree->search(key, &firstBlock, &lastBlock);
+			ASSERT_EQ(index.search(key, &expectedFirstBlock, &expectedLastBlock), found) << blockCount << " " << key;
+			if (found) {
+				ASSERT_EQ(expectedFirstBlock, firstBlock) << blockCount << " " << key;
+				ASSERT_EQ(expectedLastBlock, lastBlock) << blockCount << " " << key;
+			}
+		}
+	}
+}
+
+TEST(SegmentIndexTest, SearchDirectory)
+{
+	SegmentIndex small(1000);
+	for (size_t i = 0; i < small.blockCount(); i++) {
+		small.keys()[i] = i;
+	}
+	small.buildDirectory();
+	EXPECT_FALSE(small.hasDirectory());
+
+	const size_t blockCount = 100000;
+	SegmentIndex index(blockCount);
+	uint32_t *data = index.keys();
+	uint32_t seed = 1;
+	for (size_t i = 0; i < blockCount; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed;
+	}
+	std::sort(data, data + blockCount);
+	data[blockCount / 2 + 1] = data[blockCount / 2];
+	data[blockCount - 1] = UINT32_MAX;
+
+	auto withDirectory = index.withLayout(SORTED_INDEX_LAYOUT);
+	withDirectory->buildDirectory();
+	ASSERT_TRUE(withDirectory->hasDirectory());
+	ASSERT_GT(withDirectory->memoryUsage(), index.memoryUsage());
+
+	std::vector<uint32_t> keys = { 0, 1, UINT32_MAX - 1, UINT32_MAX, data[0], data[0] - 1, data[blockCount / 2] };
+	for (size_t i = 0; i < 10000; i++) {
+		keys.push_back(data[i * 7 % blockCount]);
+		keys.push_back(data[i * 7 % blockCount] + 1);
+		seed = seed * 1103515245 + 12345;
+		keys.push_back(seed);
+	}
+	for (uint32_t key : keys) {
+		size_t firstBlock = 0, lastBlock = 0, expectedFirstBlock = 0, expectedLastBlock = 0;
+		bool found = withDirectory->search(key, &firstBlock, &lastBlock);
+		ASSERT_EQ(index.search(key, &expectedFirstBlock, &expectedLastBlock), found) << key;
+		if (found) {
+			ASSERT_EQ(expectedFirstBlock, firstBlock) << key;
+			ASSERT_EQ(expectedLastBlock, lastBlock) << key;
+		}
+	}
+}
@@ -10,5 +10,14 @@ QList<QString> SegmentInfo::files() const
 	QList<QString> files;
 	files.append(indexFileName());
 	files.append(dataFileName());
+	if (filter()) {
+		files.append(filterFileName());
+	}
+	if (blockFilter()) {
+		files.append(blockFilterFileName());
+	}
+	if (termStats()) {
+		files.append(termStatsFileName());
+	}
 	return files;
 }
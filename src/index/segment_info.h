@@ -7,6 +7,10 @@
 #include <QSharedData>
 #include <QSharedDataPointer>
 #include "segment_index.h"
+#include "segment_data_reader.h"
+#include "segment_filter.h"
+#include "segment_block_filter.h"
+#include "segment_term_stats.h"
 #include "common.h"
 
 namespace Acoustid {
@@ -20,6 +24,7 @@ public:
 		blockCount(blockCount),
 		lastKey(lastKey),
 		checksum(checksum),
+		firstKey(0),
 		index(index) { }
 	SegmentInfoData(const SegmentInfoData& other) :
 		QSharedData(other),
@@ -27,14 +32,24 @@ public:
 		blockCount(other.blockCount),
 		lastKey(other.lastKey),
 		checksum(other.checksum),
-		index(other.index) { }
+		firstKey(other.firstKey),
+		index(other.index),
+		dataReader(other.dataReader),
+		filter(other.filter),
+		blockFilter(other.blockFilter),
+		termStats(other.termStats) { }
 	~SegmentInfoData() { }
 
 	int id;
 	size_t blockCount;
 	uint32_t lastKey;
 	uint32_t checksum;
+	uint32_t firstKey;
 	SegmentIndexSharedPtr index;
+	SegmentDataReaderSharedPtr dataReader;
+	SegmentFilterSharedPtr filter;
+	SegmentBlockFilterSharedPtr blockFilter;
+	SegmentTermStatsSharedPtr termStats;
 };
 
 class SegmentInfo
@@ -58,6 +73,21 @@ public:
 		return name() + ".fid";
 	}
 
+	QString filterFileName() const
+	{
+		return name() + ".fif";
+	}
+
+	QString blockFilterFileName() const
+	{
+		return name() + ".fib";
+	}
+
+	QString termStatsFileName() const
+	{
+		return name() + ".fis";
+	}
+
 	void setId(int id)
 	{
 		d->id = id;
@@ -68,6 +98,18 @@ public:
 		return d->id;
 	}
 
+	// First key in the segment, it's not stored in the index info, but
+	// taken from the segment index when it's loaded.
+	uint32_t firstKey() const
+	{
+		return d->firstKey;
+	}
+
+	void setFirstKey(uint32_t firstKey)
+	{
+		d->firstKey = firstKey;
+	}
+
 	uint32_t lastKey() const
 	{
 		return d->lastKey;
@@ -108,6 +150,49 @@ public:
 		d->index = index;
 	}
 
+	SegmentDataReaderSharedPtr dataReader() const
+	{
+		return d->dataReader;
+	}
+
+	void setDataReader(SegmentDataReaderSharedPtr dataReader)
+	{
+		d->dataReader = dataReader;
+	}
+
+	// Membership filter of the segment keys, older segments don't have one.
+	SegmentFilterSharedPtr filter() const
+	{
+		return d->filter;
+	}
+
+	void setFilter(SegmentFilterSharedPtr filter)
+	{
+		d->filter = filter;
+	}
+
+	// Summaries of the keys in each block, older segments don't have them.
+	SegmentBlockFilterSharedPtr blockFilter() const
+	{
+		return d->blockFilter;
+	}
+
+	void setBlockFilter(SegmentBlockFilterSharedPtr blockFilter)
+	{
+		d->blockFilter = blockFilter;
+	}
+
+	// Posting counts of the frequent keys, segments without any or older ones don't have them.
+	SegmentTermStatsSharedPtr termStats() const
+	{
+		return d->termStats;
+	}
+
+	void setTermStats(SegmentTermStatsSharedPtr termStats)
+	{
+		d->termStats = termStats;
+	}
+
 	QList<QString> files() const;
 
 private:
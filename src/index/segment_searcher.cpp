@@ -2,14 +2,17 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <algorithm>
+#include "util/intersect.h"
 #include "collector.h"
 #include "segment_data_reader.h"
 #include "segment_searcher.h"
 
 using namespace Acoustid;
 
-SegmentSearcher::SegmentSearcher(SegmentIndexSharedPtr index, SegmentDataReader *dataReader, uint32_t lastKey)
-	: m_index(index), m_dataReader(dataReader), m_lastKey(lastKey)
+SegmentSearcher::SegmentSearcher(SegmentIndexSharedPtr index, SegmentDataReaderSharedPtr dataReader, uint32_t lastKey)
+	: m_index(index), m_dataReader(dataReader), m_lastKey(lastKey), m_skippedBlockCount(0),
+	  m_deadline(QDeadlineTimer::Forever), m_blocksUntilInterruptCheck(INTERRUPT_CHECK_INTERVAL), m_segmentId(-1),
+	  m_firstValueBlock(SIZE_MAX), m_firstValue(0)
 {
 }
 
@@ -17,15 +20,289 @@ SegmentSearcher::~SegmentSearcher()
 {
 }
 
+void SegmentSearcher::setBlockCache(BlockCacheSharedPtr cache, int segmentId)
+{
+	m_blockCache = cache;
+	m_segmentId = segmentId;
+}
+
+const BlockData *SegmentSearcher::readBlock(size_t block, uint32_t firstKey)
+{
+	if (!m_blockCache || !m_blockCache->isEnabled()) {
+		m_dataReader->readBlock(block, firstKey, &m_blockData);
+		return &m_blockData;
+	}
+	m_cachedBlock = m_blockCache->get(m_segmentId, block);
+	if (!m_cachedBlock) {
+		auto blockData = QSharedPointer<BlockData>::create();
+		m_dataReader->readBlock(block, firstKey, blockData.data());
+		m_blockCache->insert(m_segmentId, block, blockData);
+		m_cachedBlock = blockData;
+	}
+	return m_cachedBlock.data();
+}
+
+bool SegmentSearcher::blockMightMatch(size_t block, const uint32_t *fingerprint, const uint32_t *end, uint32_t maxKey) const
+{
+	for (; fingerprint < end && *fingerprint <= maxKey; fingerprint++) {
+		if (m_blockFilter->mightContain(block, *fingerprint)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void SegmentSearcher::checkInterrupted()
+{
+	if (--m_blocksUntilInterruptCheck == 0) {
+		m_blocksUntilInterruptCheck = INTERRUPT_CHECK_INTERVAL;
+		if (m_cancellation && m_cancellation->isCancelled()) {
+			throw SearchCancelled();
+		}
+		if (m_deadline.hasExpired()) {
+			throw TimeoutExceeded();
+		}
+	}
+}
+
 void SegmentSearcher::search(uint32_t *fingerprint, size_t length, Collector *collector)
 {
-	size_t i = 0, block = 0, lastBlock = SIZE_MAX;
+	searchImpl(fingerprint, length, [collector](size_t i, const uint32_t *values, size_t count) {
+		collector->collectMany(values, count);
+	});
+}
+
+void SegmentSearcher::searchWithPruning(uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter)
+{
+	searchPruned(fingerprint, length, collector, maxScoreAfter, false);
+}
+
+void SegmentSearcher::searchExisting(uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter)
+{
+	searchPruned(fingerprint, length, collector, maxScoreAfter, true);
+}
+
+void SegmentSearcher::searchPruned(const uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter, bool pruned)
+{
+	// Items after this one can't match anything in this segment.
+	size_t end = std::upper_bound(fingerprint, fingerprint + length, m_lastKey) - fingerprint;
+
+	// Documents that can still reach the minimum competitive score with the items from i on, sorted.
+	// Hits of the other documents don't matter, they can't get into the results.
+	// Without a score to prune by, that is every document the collector has.
+	std::vector<uint32_t> candidates;
+	bool haveCandidates = false;
+	auto findCandidates = [&](size_t i) {
+		unsigned int minScore = collector->minCompetitiveScore();
+		unsigned int maxScoreLeft = end - i + maxScoreAfter;
+		haveCandidates = collector->competitiveDocuments(minScore > maxScoreLeft ? minScore - maxScoreLeft : 0, &candidates);
+		std::sort(candidates.begin(), candidates.end());
+	};
+	if (pruned) {
+		findCandidates(0);
+		if (haveCandidates && candidates.empty()) {
+			return;
+		}
+	}
+
+	size_t checkedItem = SIZE_MAX;
+	auto collect = [&](size_t i, const uint32_t *values, size_t count) {
+		if (!pruned && i != checkedItem) {
+			// A document first seen at item i can match at most the remaining items.
+			// Once that is not enough, it stays so for all the following items.
+			checkedItem = i;
+			pruned = end - i + maxScoreAfter < collector->minCompetitiveScore();
+			if (pruned) {
+				findCandidates(i);
+			}
+		}
+		if (!pruned) {
+			collector->collectMany(values, count);
+		}
+		else if (!haveCandidates) {
+			for (size_t j = 0; j < count; j++) {
+				collector->collectExisting(values[j]);
+			}
+		}
+		else {
+			// The documents of one item are sorted, so are the candidates.
+			auto candidate = candidates.cbegin();
+			for (size_t j = 0; j < count; j++) {
+				candidate = std::lower_bound(candidate, candidates.cend(), values[j]);
+				if (candidate == candidates.cend()) {
+					break;
+				}
+				if (*candidate == values[j]) {
+					collector->collectExisting(values[j]);
+				}
+			}
+		}
+	};
+
+	Cursor cursor(fingerprint, length);
+	while (nextBlock(cursor)) {
+		if (haveCandidates && blockMissesCandidates(cursor, candidates)) {
+			m_skippedBlockCount++;
+			cursor.block++;
+			continue;
+		}
+		searchBlock(cursor, collect);
+	}
+}
+
+bool SegmentSearcher::blockMissesCandidates(const Cursor &cursor, const std::vector<uint32_t> &candidates)
+{
+	size_t block = cursor.block;
+	uint32_t key = cursor.fingerprint[cursor.item];
+	if (block + 1 >= m_index->blockCount() || m_index->key(block) != key || m_index->key(block + 1) != key) {
+		return false;
+	}
+	uint32_t minId = firstValue(block);
+	uint32_t maxId = firstValue(block + 1);
+	auto candidate = std::lower_bound(candidates.begin(), candidates.end(), minId);
+	return candidate == candidates.end() || *candidate > maxId;
+}
+
+uint32_t SegmentSearcher::firstValue(size_t block)
+{
+	if (block != m_firstValueBlock) {
+		m_firstValue = m_dataReader->readFirstValue(block);
+		m_firstValueBlock = block;
+	}
+	return m_firstValue;
+}
+
+void SegmentSearcher::searchBatch(const uint32_t *terms, size_t length, const uint32_t *offsets, const uint32_t *queries, Collector *const *collectors)
+{
+	searchImpl(terms, length, [=](size_t i, const uint32_t *values, size_t count) {
+		for (uint32_t j = offsets[i]; j < offsets[i + 1]; j++) {
+			collectors[queries[j]]->collectMany(values, count);
+		}
+	});
+}
+
+void SegmentSearcher::searchInterleaved(const std::vector<std::vector<uint32_t>> &fingerprints, Collector *const *collectors, size_t width)
+{
+	width = std::max<size_t>(1, width);
+	std::vector<Cursor> cursors;
+	std::vector<size_t> cursorQueries;
+	cursors.reserve(width);
+	cursorQueries.reserve(width);
+	size_t nextQuery = 0;
+
+	// Start searching the next fingerprint that has anything to read in this segment.
+	auto startQuery = [&](Cursor &cursor, size_t &query) {
+		while (nextQuery < fingerprints.size()) {
+			query = nextQuery++;
+			cursor = Cursor(fingerprints[query].data(), fingerprints[query].size());
+			if (nextBlock(cursor)) {
+				m_dataReader->prefetchBlock(cursor.block);
+				return true;
+			}
+		}
+		return false;
+	};
+
+	while (cursors.size() < width) {
+		Cursor cursor(nullptr, 0);
+		size_t query;
+		if (!startQuery(cursor, query)) {
+			break;
+		}
+		cursors.push_back(cursor);
+		cursorQueries.push_back(query);
+	}
+
+	// Process one block of each cursor in turn. The next block of a cursor is prefetched
+	// right away, but it's only read after all the other cursors had their turn.
+	while (!cursors.empty()) {
+		for (size_t k = 0; k < cursors.size();) {
+			Collector *collector = collectors[cursorQueries[k]];
+			searchBlock(cursors[k], [collector](size_t i, const uint32_t *values, size_t count) {
+				collector->collectMany(values, count);
+			});
+			if (nextBlock(cursors[k])) {
+				m_dataReader->prefetchBlock(cursors[k].block);
+				k++;
+			}
+			else if (startQuery(cursors[k], cursorQueries[k])) {
+				k++;
+			}
+			else {
+				cursors[k] = cursors.back();
+				cursors.pop_back();
+				cursorQueries[k] = cursorQueries.back();
+				cursorQueries.pop_back();
+			}
+		}
+	}
+}
+
+std::vector<size_t> SegmentSearcher::partition(const uint32_t *fingerprint, size_t length, size_t numPartitions) const
+{
+	std::vector<size_t> bounds = { 0 };
+	size_t blockCount = m_index->blockCount();
+	for (size_t k = 1; k < numPartitions; k++) {
+		uint32_t key = m_index->key(k * blockCount / numPartitions);
+		size_t bound = std::lower_bound(fingerprint + bounds.back(), fingerprint + length, key) - fingerprint;
+		if (bound > bounds.back() && bound < length) {
+			bounds.push_back(bound);
+		}
+	}
+	bounds.push_back(length);
+	return bounds;
+}
+
+void SegmentSearcher::prefetch(const uint32_t *fingerprint, size_t length)
+{
+	std::vector<size_t> blocks;
+	Cursor cursor(fingerprint, length);
+	// Without reading the blocks, this visits all blocks that might contain the items,
+	// which can be a few more than the search will actually read.
+	size_t skippedBlockCount = m_skippedBlockCount;
+	while (nextBlock(cursor)) {
+		blocks.push_back(cursor.block++);
+	}
+	m_skippedBlockCount = skippedBlockCount;
+	m_dataReader->willNeedBlocks(blocks);
+}
+
+size_t SegmentSearcher::estimatePostings(const uint32_t *fingerprint, size_t length) const
+{
+	size_t postings = 0;
+	for (size_t i = 0; i < length && fingerprint[i] <= m_lastKey; i++) {
+		if (i > 0 && fingerprint[i] == fingerprint[i - 1]) {
+			continue;
+		}
+		if (m_filter && !m_filter->mightContain(fingerprint[i])) {
+			continue;
+		}
+		size_t firstBlock, lastBlock;
+		if (m_index->search(fingerprint[i], &firstBlock, &lastBlock)) {
+			// Blocks between the first and the last one contain nothing but the key,
+			// the first and the last one together are counted as one.
+			postings += (lastBlock - firstBlock) * ESTIMATED_BLOCK_POSTINGS + 1;
+		}
+	}
+	return postings;
+}
+
+bool SegmentSearcher::nextBlock(Cursor &cursor)
+{
+	const uint32_t *fingerprint = cursor.fingerprint;
+	size_t length = cursor.length;
+	size_t &i = cursor.item, &block = cursor.block, &lastBlock = cursor.lastBlock;
 	while (i < length) {
 		if (block > lastBlock || lastBlock == SIZE_MAX) {
 			size_t localFirstBlock, localLastBlock;
 			if (fingerprint[i] > m_lastKey) {
 				// All following items are larger than the last segment's key.
-				return;
+				return false;
+			}
+			if (m_filter && !m_filter->mightContain(fingerprint[i])) {
+				// The fingerprint item is definitely not in this segment.
+				i++;
+				continue;
 			}
 			if (m_index->search(fingerprint[i], &localFirstBlock, &localLastBlock)) {
 				if (block > localLastBlock) {
@@ -43,29 +320,61 @@ void SegmentSearcher::search(uint32_t *fingerprint, size_t length, Collector *co
 				continue;
 			}
 		}
-		uint32_t firstKey = m_index->key(block);
-		uint32_t lastKey = block + 1 < m_index->blockCount() ? m_index->key(block + 1) : m_lastKey + 1;
-		std::unique_ptr<BlockDataIterator> blockData(m_dataReader->readBlock(block, firstKey));
-		while (blockData->next()) {
-			uint32_t key = blockData->key();
-			if (key >= fingerprint[i]) {
-				while (key > fingerprint[i]) {
+		if (m_blockFilter) {
+			uint32_t maxKey = block + 1 < m_index->blockCount() ? m_index->key(block + 1) : m_lastKey;
+			if (!blockMightMatch(block, fingerprint + i, fingerprint + length, maxKey)) {
+				// Items smaller than the next block's first key can't be in any other block.
+				while (i < length && fingerprint[i] < maxKey) {
 					i++;
-					if (i >= length) {
-						return;
-					}
-					else if (lastKey < fingerprint[i]) {
-						// There are no longer any items in this block that we could match.
-						goto nextBlock;
-					}
-				}
-				if (key == fingerprint[i]) {
-					collector->collect(blockData->value());
 				}
+				m_skippedBlockCount++;
+				block++;
+				continue;
 			}
 		}
-	nextBlock:
+		return true;
+	}
+	return false;
+}
+
+template <typename CollectFunc>
+void SegmentSearcher::searchBlock(Cursor &cursor, CollectFunc collect)
+{
+	const uint32_t *fingerprint = cursor.fingerprint;
+	size_t length = cursor.length;
+	size_t &i = cursor.item, &block = cursor.block;
+	checkInterrupted();
+	const BlockData *blockData = readBlock(block, m_index->key(block));
+	size_t blockSize = blockData->size();
+	if (blockSize == 0) {
 		block++;
+		return;
 	}
+	const uint32_t *keys = blockData->keys();
+	const uint32_t *values = blockData->values();
+	// Only items up to the next block's first key can be in this block.
+	size_t end = length;
+	if (block + 1 < m_index->blockCount()) {
+		end = std::upper_bound(fingerprint + i, fingerprint + length, m_index->key(block + 1)) - fingerprint;
+	}
+	if (m_matches.size() < end - i) {
+		m_matches.resize(end - i);
+	}
+	size_t numMatches = intersectSorted(keys, blockSize, fingerprint + i, end - i, m_matches.data());
+	for (size_t j = 0; j < numMatches; j++) {
+		const IntersectMatch &match = m_matches[j];
+		collect(i + match.term, values + match.begin, match.end - match.begin);
+	}
+	// Items smaller than the block's last key can't be in any of the following blocks.
+	i = std::lower_bound(fingerprint + i, fingerprint + end, keys[blockSize - 1]) - fingerprint;
+	block++;
 }
 
+template <typename CollectFunc>
+void SegmentSearcher::searchImpl(const uint32_t *fingerprint, size_t length, CollectFunc collect)
+{
+	Cursor cursor(fingerprint, length);
+	while (nextBlock(cursor)) {
+		searchBlock(cursor, collect);
+	}
+}
@@ -4,20 +4,46 @@
 #ifndef ACOUSTID_INDEX_SEGMENT_SEARCHER_H_
 #define ACOUSTID_INDEX_SEGMENT_SEARCHER_H_
 
+#include <QDeadlineTimer>
+#include <vector>
 #include "common.h"
+#include "util/cancellation_token.h"
+#include "util/intersect.h"
 #include "segment_index.h"
+#include "segment_data_reader.h"
+#include "block_cache.h"
+#include "segment_filter.h"
+#include "segment_block_filter.h"
 
 namespace Acoustid {
 
-class SegmentDataReader;
 class Collector;
 
 class SegmentSearcher
 {
 public:
-	SegmentSearcher(SegmentIndexSharedPtr index, SegmentDataReader *dataReader, uint32_t lastKey = UINT32_MAX);
+	SegmentSearcher(SegmentIndexSharedPtr index, SegmentDataReaderSharedPtr dataReader, uint32_t lastKey = UINT32_MAX);
 	virtual ~SegmentSearcher();
 
+	// Use a shared cache for the decoded blocks, `segmentId` identifies the segment in it.
+	void setBlockCache(BlockCacheSharedPtr cache, int segmentId);
+
+	// Skip fingerprint items that are not in the filter, without looking up their blocks.
+	void setFilter(SegmentFilterSharedPtr filter) { m_filter = filter; }
+
+	// Skip blocks whose key summary doesn't match any of the fingerprint items.
+	void setBlockFilter(SegmentBlockFilterSharedPtr blockFilter) { m_blockFilter = blockFilter; }
+
+	// Throw TimeoutExceeded once the deadline expires. It's checked every few
+	// blocks, so a large segment can't overrun it by much.
+	void setDeadline(const QDeadlineTimer &deadline) { m_deadline = deadline; }
+
+	// Throw SearchCancelled once the token is cancelled, checked together with the deadline.
+	void setCancellationToken(CancellationTokenSharedPtr cancellation) { m_cancellation = cancellation; }
+
+	// Number of blocks skipped thanks to the block filter or pruning.
+	size_t skippedBlockCount() const { return m_skippedBlockCount; }
+
 	/**
 	 * Search for the fingerprint in one segment.
 	 *
@@ -25,10 +51,127 @@ public:
 	 */
 	void search(uint32_t *fingerprint, size_t length, Collector *collector);
 
+	/**
+	 * Search for the fingerprint in one segment, but stop collecting new
+	 * documents once they can't reach the collector's minimum competitive score.
+	 * From then on, only the documents that can still reach it are counted, and
+	 * blocks full of one key that can't contain any of them are not read at all.
+	 *
+	 * `maxScoreAfter` is the highest score a document can still get from the
+	 * segments searched after this one.
+	 */
+	void searchWithPruning(uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter);
+
+	/**
+	 * Search for the fingerprint in one segment, but only count hits of the documents
+	 * the collector already has, pruned the same way as by searchWithPruning().
+	 */
+	void searchExisting(uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter);
+
+	/**
+	 * Search for many fingerprints at once.
+	 *
+	 * The terms are the sorted unique items of all the fingerprints. Documents
+	 * matching terms[i] are passed to collectors[queries[j]] for each j in
+	 * [offsets[i], offsets[i + 1]).
+	 */
+	void searchBatch(const uint32_t *terms, size_t length, const uint32_t *offsets, const uint32_t *queries, Collector *const *collectors);
+
+	/**
+	 * Search for many fingerprints, each with its own collector.
+	 *
+	 * Up to `width` fingerprints are searched at the same time, one block at
+	 * a time. The next block of each of them is prefetched and only read once
+	 * the others had their turn, so the memory loads overlap. The fingerprints
+	 * must be sorted.
+	 */
+	void searchInterleaved(const std::vector<std::vector<uint32_t>> &fingerprints, Collector *const *collectors, size_t width = INTERLEAVED_SEARCH_WIDTH);
+
+	/**
+	 * Split the sorted fingerprint into up to `numPartitions` slices, each covering
+	 * a key range with about the same number of the segment's blocks. Returns the
+	 * slice boundaries, slice k is [bounds[k], bounds[k + 1]). Empty slices are left
+	 * out and equal items always end up in the same slice, so the slices can be
+	 * searched independently.
+	 */
+	std::vector<size_t> partition(const uint32_t *fingerprint, size_t length, size_t numPartitions) const;
+
+	/**
+	 * Ask the OS to start reading all the data blocks that a search for the
+	 * fingerprint will need, so that their page faults overlap. The fingerprint
+	 * must be sorted.
+	 */
+	void prefetch(const uint32_t *fingerprint, size_t length);
+
+	/**
+	 * Estimate the number of postings a search for the fingerprint would read,
+	 * only from the block ranges of its items, without reading any blocks.
+	 * The fingerprint must be sorted.
+	 */
+	size_t estimatePostings(const uint32_t *fingerprint, size_t length) const;
+
+	// Default number of fingerprints searched at the same time by searchInterleaved().
+	static const size_t INTERLEAVED_SEARCH_WIDTH = 16;
+
+	// Rough number of postings in a block full of one key, each takes two or three bytes.
+	static const size_t ESTIMATED_BLOCK_POSTINGS = BLOCK_SIZE / 3;
+
 private:
+	// Position of one fingerprint's search within the segment.
+	struct Cursor
+	{
+		Cursor(const uint32_t *fingerprint, size_t length)
+			: fingerprint(fingerprint), length(length), item(0), block(0), lastBlock(SIZE_MAX) {}
+
+		const uint32_t *fingerprint;
+		size_t length;
+		size_t item;
+		size_t block;
+		size_t lastBlock;
+	};
+
+	// Move the cursor to the next block that needs to be read, returns false if there is none.
+	bool nextBlock(Cursor &cursor);
+
+	// Read the cursor's current block and collect the matching documents.
+	template <typename CollectFunc>
+	void searchBlock(Cursor &cursor, CollectFunc collect);
+
+	template <typename CollectFunc>
+	void searchImpl(const uint32_t *fingerprint, size_t length, CollectFunc collect);
+
+	void searchPruned(const uint32_t *fingerprint, size_t length, Collector *collector, unsigned int maxScoreAfter, bool pruned);
+
+	// Returns true if the cursor's block only has postings of its current item and none of them
+	// can be one of the sorted candidates. The range of documents in such a block is known from
+	// the first values of the block and the next one.
+	bool blockMissesCandidates(const Cursor &cursor, const std::vector<uint32_t> &candidates);
+	uint32_t firstValue(size_t block);
+
+	const BlockData *readBlock(size_t block, uint32_t firstKey);
+	bool blockMightMatch(size_t block, const uint32_t *fingerprint, const uint32_t *end, uint32_t maxKey) const;
+	void checkInterrupted();
+
+	// Number of blocks between two deadline and cancellation checks.
+	static const size_t INTERRUPT_CHECK_INTERVAL = 16;
+
 	SegmentIndexSharedPtr m_index;
-	std::unique_ptr<SegmentDataReader> m_dataReader;
+	SegmentDataReaderSharedPtr m_dataReader;
 	uint32_t m_lastKey;
+	BlockCacheSharedPtr m_blockCache;
+	SegmentFilterSharedPtr m_filter;
+	SegmentBlockFilterSharedPtr m_blockFilter;
+	size_t m_skippedBlockCount;
+	QDeadlineTimer m_deadline;
+	CancellationTokenSharedPtr m_cancellation;
+	size_t m_blocksUntilInterruptCheck;
+	int m_segmentId;
+	BlockDataSharedPtr m_cachedBlock;
+	// The last block whose first value was read, consecutive blocks of one key need it twice.
+	size_t m_firstValueBlock;
+	uint32_t m_firstValue;
+	BlockData m_blockData;
+	std::vector<IntersectMatch> m_matches;
 };
 
 }
@@ -0,0 +1,78 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <algorithm>
+#include "store/input_stream.h"
+#include "store/output_stream.h"
+#include "segment_term_stats.h"
+
+using namespace Acoustid;
+
+// Version of the file format, to be able to add more statistics later.
+// Version 2 added the postings cap and the stop keys.
+static const uint32_t TERM_STATS_FORMAT = 2;
+
+void SegmentTermStats::add(uint32_t key, uint32_t postingCount)
+{
+	assert(m_keys.empty() || key > m_keys.back());
+	m_keys.push_back(key);
+	m_postingCounts.push_back(postingCount);
+}
+
+uint32_t SegmentTermStats::postingCount(uint32_t key) const
+{
+	auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+	if (it == m_keys.end() || *it != key) {
+		return 0;
+	}
+	return m_postingCounts[it - m_keys.begin()];
+}
+
+void SegmentTermStats::save(OutputStream *output) const
+{
+	output->writeVInt32(TERM_STATS_FORMAT);
+	output->writeVInt32(m_keys.size());
+	uint32_t lastKey = 0;
+	for (size_t i = 0; i < m_keys.size(); i++) {
+		output->writeVInt32(m_keys[i] - lastKey);
+		output->writeVInt32(m_postingCounts[i]);
+		lastKey = m_keys[i];
+	}
+	output->writeVInt32(m_maxKeyPostings);
+	output->writeVInt32(m_stopKeys.size());
+	lastKey = 0;
+	for (uint32_t key : m_stopKeys) {
+		output->writeVInt32(key - lastKey);
+		lastKey = key;
+	}
+	output->flush();
+}
+
+SegmentTermStatsSharedPtr SegmentTermStats::load(InputStream *input)
+{
+	uint32_t format = input->readVInt32();
+	if (format < 1 || format > TERM_STATS_FORMAT) {
+		throw CorruptIndexException("unsupported segment term statistics format");
+	}
+	size_t size = input->readVInt32();
+	auto stats = SegmentTermStatsSharedPtr::create();
+	stats->m_keys.reserve(size);
+	stats->m_postingCounts.reserve(size);
+	uint32_t key = 0;
+	for (size_t i = 0; i < size; i++) {
+		key += input->readVInt32();
+		stats->m_keys.push_back(key);
+		stats->m_postingCounts.push_back(input->readVInt32());
+	}
+	if (format >= 2) {
+		stats->m_maxKeyPostings = input->readVInt32();
+		size_t stopKeyCount = input->readVInt32();
+		stats->m_stopKeys.reserve(stopKeyCount);
+		key = 0;
+		for (size_t i = 0; i < stopKeyCount; i++) {
+			key += input->readVInt32();
+			stats->m_stopKeys.push_back(key);
+		}
+	}
+	return stats;
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_INDEX_SEGMENT_TERM_STATS_H_
+#define ACOUSTID_INDEX_SEGMENT_TERM_STATS_H_
+
+#include <algorithm>
+#include <vector>
+#include <QSharedPointer>
+#include "common.h"
+
+namespace Acoustid {
+
+class InputStream;
+class OutputStream;
+
+// What searches do with terms whose document frequency is above the cutoff.
+enum FrequentTermMode {
+	// Frequent terms are left out of the search.
+	SKIP_FREQUENT_TERMS,
+	// Frequent terms are searched after all the other terms and only add to the
+	// scores of documents that the other terms found.
+	DEMOTE_FREQUENT_TERMS,
+};
+
+// Posting counts of the most frequent keys in one segment.
+//
+// Only keys with at least MIN_POSTINGS postings are recorded, those fill at
+// least a whole data block. The other keys are too rare to matter and have
+// no statistics.
+//
+// If the segment was written with a cap on the postings per key, this also
+// holds the cap and the stop keys, whose postings were dropped because there
+// were more of them than the cap.
+class SegmentTermStats
+{
+public:
+	// About as many postings of one key as fit into a data block.
+	static constexpr uint32_t MIN_POSTINGS = BLOCK_SIZE / 2;
+
+	SegmentTermStats() {}
+
+	// Number of recorded keys.
+	size_t size() const { return m_keys.size(); }
+
+	// Returns true if there are no recorded keys, no stop keys and no cap.
+	bool isEmpty() const { return m_keys.empty() && m_stopKeys.empty() && m_maxKeyPostings == 0; }
+
+	// Record the posting count of a key, the keys must be added in increasing order.
+	void add(uint32_t key, uint32_t postingCount);
+
+	// Number of postings of the key, or zero if it has less than MIN_POSTINGS.
+	uint32_t postingCount(uint32_t key) const;
+
+	// Maximum number of postings kept per key when the segment was written, zero if there was no cap.
+	uint32_t maxKeyPostings() const { return m_maxKeyPostings; }
+	void setMaxKeyPostings(uint32_t maxKeyPostings) { m_maxKeyPostings = maxKeyPostings; }
+
+	// Sorted keys that have no postings in the segment, because they had too many.
+	const std::vector<uint32_t> &stopKeys() const { return m_stopKeys; }
+	void setStopKeys(const std::vector<uint32_t> &keys) { m_stopKeys = keys; }
+	bool isStopKey(uint32_t key) const { return std::binary_search(m_stopKeys.begin(), m_stopKeys.end(), key); }
+
+	// Approximate number of bytes used by the statistics.
+	size_t memoryUsage() const
+	{
+		return sizeof(SegmentTermStats) +
+			(m_keys.capacity() + m_postingCounts.capacity() + m_stopKeys.capacity()) * sizeof(uint32_t);
+	}
+
+	void save(OutputStream *output) const;
+	static QSharedPointer<SegmentTermStats> load(InputStream *input);
+
+private:
+	std::vector<uint32_t> m_keys;
+	std::vector<uint32_t> m_postingCounts;
+	uint32_t m_maxKeyPostings = 0;
+	std::vector<uint32_t> m_stopKeys;
+};
+
+typedef QSharedPointer<SegmentTermStats> SegmentTermStatsSharedPtr;
+
+}
+
+#endif
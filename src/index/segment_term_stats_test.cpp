@@ -0,0 +1,53 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+#include "store/ram_directory.h"
+#include "store/input_stream.h"
+#include "store/output_stream.h"
+#include "segment_term_stats.h"
+
+using namespace Acoustid;
+
+TEST(SegmentTermStatsTest, PostingCount)
+{
+	SegmentTermStats stats;
+	ASSERT_TRUE(stats.isEmpty());
+	stats.add(10, 1000);
+	ASSERT_FALSE(stats.isEmpty());
+	stats.add(20, 300);
+	stats.add(1u << 31, 5000);
+	ASSERT_EQ(3, stats.size());
+	ASSERT_EQ(1000, stats.postingCount(10));
+	ASSERT_EQ(300, stats.postingCount(20));
+	ASSERT_EQ(5000, stats.postingCount(1u << 31));
+	ASSERT_EQ(0, stats.postingCount(0));
+	ASSERT_EQ(0, stats.postingCount(15));
+	ASSERT_EQ(0, stats.postingCount(UINT32_MAX));
+}
+
+TEST(SegmentTermStatsTest, SaveAndLoad)
+{
+	RAMDirectory dir;
+	SegmentTermStats stats;
+	for (uint32_t i = 0; i < 100; i++) {
+		stats.add(i * 12345, 1000 + i);
+	}
+	stats.setMaxKeyPostings(5000);
+	stats.setStopKeys({7, 100, 1u << 31});
+	{
+		std::unique_ptr<OutputStream> output(dir.createFile("stats"));
+		stats.save(output.get());
+	}
+	std::unique_ptr<InputStream> input(dir.openFile("stats"));
+	auto loaded = SegmentTermStats::load(input.get());
+	ASSERT_EQ(100, loaded->size());
+	for (uint32_t i = 0; i < 100; i++) {
+		ASSERT_EQ(1000 + i, loaded->postingCount(i * 12345)) << i;
+		ASSERT_EQ(0, loaded->postingCount(i * 12345 + 1)) << i;
+	}
+	ASSERT_EQ(5000, loaded->maxKeyPostings());
+	ASSERT_EQ(std::vector<uint32_t>({7, 100, 1u << 31}), loaded->stopKeys());
+	ASSERT_TRUE(loaded->isStopKey(100));
+	ASSERT_FALSE(loaded->isStopKey(101));
+}
@@ -2,6 +2,7 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <algorithm>
+#include <climits>
 #include "top_hits_collector.h"
 
 using namespace Acoustid;
@@ -17,36 +18,127 @@ TopHitsCollector::~TopHitsCollector()
 
 void TopHitsCollector::collect(uint32_t id)
 {
-	m_counts[id] = m_counts[id] + 1;
+	unsigned int count = m_counts.add(id);
+	updateHistogram(count - 1, count);
 }
 
-struct CompareByCount
+void TopHitsCollector::collectMany(const uint32_t *ids, size_t count)
 {
-	CompareByCount(const QHash<uint32_t, unsigned int> &counts) : m_counts(counts) {}
-	bool operator()(uint32_t a, uint32_t b)
-	{
-		return m_counts[a] > m_counts[b];
+	for (size_t i = 0; i < count; i++) {
+		unsigned int newCount = m_counts.add(ids[i]);
+		updateHistogram(newCount - 1, newCount);
 	}
-	const QHash<uint32_t, unsigned int> &m_counts;
-};
+}
+
+void TopHitsCollector::collectCount(uint32_t id, unsigned int count)
+{
+	if (count > 0) {
+		unsigned int newCount = m_counts.add(id, count);
+		updateHistogram(newCount - count, newCount);
+	}
+}
+
+void TopHitsCollector::collectExisting(uint32_t id)
+{
+	unsigned int count = m_counts.addIfPresent(id);
+	if (count > 0) {
+		updateHistogram(count - 1, count);
+	}
+}
+
+void TopHitsCollector::updateHistogram(unsigned int oldCount, unsigned int newCount)
+{
+	if (newCount >= m_histogram.size()) {
+		m_histogram.resize(std::max<size_t>(newCount + 1, m_histogram.size() * 2));
+	}
+	if (oldCount > 0) {
+		m_histogram[oldCount]--;
+	}
+	m_histogram[newCount]++;
+}
+
+unsigned int TopHitsCollector::minCompetitiveScore()
+{
+	if (m_numHits == 0) {
+		return UINT_MAX;
+	}
+	unsigned int topScore = m_histogram.size();
+	while (topScore > 0 && m_histogram[topScore - 1] == 0) {
+		topScore--;
+	}
+	if (topScore == 0) {
+		return 0;
+	}
+	topScore--;
+	unsigned int minScore = (50 + topScore * m_topScorePercent) / 100;
+	if (m_counts.size() >= m_numHits) {
+		size_t numDocs = 0;
+		for (unsigned int count = topScore; count > minScore; count--) {
+			numDocs += m_histogram[count];
+			if (numDocs >= m_numHits) {
+				return count;
+			}
+		}
+	}
+	return minScore;
+}
+
+bool TopHitsCollector::competitiveDocuments(unsigned int minScore, std::vector<uint32_t> *ids)
+{
+	m_counts.forEach([minScore, ids](const HitCounter::Entry &entry) {
+		if (entry.count >= minScore) {
+			ids->push_back(entry.id);
+		}
+	});
+	return true;
+}
+
+void TopHitsCollector::reserve(size_t length)
+{
+	// Most terms only match a few documents, this is just a rough starting point.
+	m_counts.reserve(length * 4);
+}
+
+void TopHitsCollector::clear()
+{
+	m_counts.clear();
+	m_histogram.clear();
+}
+
+void TopHitsCollector::mergeInto(Collector *collector) const
+{
+	m_counts.forEach([collector](const HitCounter::Entry &entry) {
+		collector->collectCount(entry.id, entry.count);
+	});
+}
 
 QList<Result> TopHitsCollector::topResults()
 {
-	QList<uint32_t> ids = m_counts.keys();
 	QList<Result> results;
-	if (ids.isEmpty()) {
+	if (m_counts.isEmpty() || m_numHits == 0) {
 		return results;
 	}
-	std::sort(ids.begin(), ids.end(), CompareByCount(m_counts));
-	unsigned int minScore = (50 + m_counts[ids.first()] * m_topScorePercent) / 100;
-	for (int i = 0; i < std::min(m_numHits, size_t(ids.size())); i++) {
-		uint32_t id = ids.at(i);
-		unsigned int score = m_counts[id];
-		if (score < minScore) {
+	std::vector<HitCounter::Entry> entries;
+	entries.reserve(m_counts.size());
+	m_counts.forEach([&entries](const HitCounter::Entry &entry) {
+		entries.push_back(entry);
+	});
+	// Only the best hits need to be sorted, the rest can stay in any order.
+	size_t numHits = std::min(m_numHits, entries.size());
+	std::partial_sort(entries.begin(), entries.begin() + numHits, entries.end(),
+		[](const HitCounter::Entry &a, const HitCounter::Entry &b) {
+			if (a.count != b.count) {
+				return a.count > b.count;
+			}
+			return a.id < b.id;
+		});
+	unsigned int minScore = (50 + entries.front().count * m_topScorePercent) / 100;
+	for (size_t i = 0; i < numHits; i++) {
+		const HitCounter::Entry &entry = entries[i];
+		if (entry.count < minScore) {
 			break;
 		}
-		results.append(Result(id, score));
+		results.append(Result(entry.id, entry.count));
 	}
 	return results;
 }
-
@@ -5,9 +5,10 @@
 #define ACOUSTID_INDEX_TOP_HITS_COLLECTOR_H_
 
 #include <QList>
-#include <QHash>
+#include <vector>
 #include "common.h"
 #include "collector.h"
+#include "hit_counter.h"
 
 namespace Acoustid {
 
@@ -31,11 +32,33 @@ public:
 	TopHitsCollector(size_t numHits, int topScorePercent = 0);
 	~TopHitsCollector();
 	void collect(uint32_t id);
+	void collectMany(const uint32_t *ids, size_t count);
+	void collectCount(uint32_t id, unsigned int count);
+	void collectExisting(uint32_t id);
+
+	// Score of the numHits-th best hit so far, or the top score percent
+	// cutoff if that is higher. Both can only grow as more hits are collected.
+	unsigned int minCompetitiveScore();
+
+	bool competitiveDocuments(unsigned int minScore, std::vector<uint32_t> *ids);
+
+	// Pre-allocate memory for searching a fingerprint of the given length.
+	void reserve(size_t length);
+
+	// Forget all collected hits, but keep the memory for the next search.
+	void clear();
+
+	// Pass all collected counts to another collector.
+	void mergeInto(Collector *collector) const;
 
 	QList<Result> topResults();
 
 private:
-	QHash<uint32_t, unsigned int> m_counts;
+	void updateHistogram(unsigned int oldCount, unsigned int newCount);
+
+	HitCounter m_counts;
+	// Number of documents with each count.
+	std::vector<uint32_t> m_histogram;
 	size_t m_numHits;
 	int m_topScorePercent;
 };
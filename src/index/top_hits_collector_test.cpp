@@ -2,6 +2,7 @@
 // Distributed under the MIT license, see the LICENSE file for details.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include "util/test_utils.h"
 #include "top_hits_collector.h"
 
@@ -61,3 +62,94 @@ TEST(TopHitsCollectorTest, NumHitsTopScorePercent2)
 	ASSERT_EQ(1, results.size());
 }
 
+
+TEST(TopHitsCollectorTest, MergeInto)
+{
+	TopHitsCollector partial1(0);
+	partial1.collect(1);
+	partial1.collect(2);
+	partial1.collect(2);
+
+	TopHitsCollector partial2(0);
+	partial2.collect(2);
+	partial2.collectCount(3, 5);
+
+	TopHitsCollector collector(10);
+	partial1.mergeInto(&collector);
+	partial2.mergeInto(&collector);
+
+	QList<Result> results = collector.topResults();
+	ASSERT_EQ(3, results.size());
+	ASSERT_EQ(3, results.at(0).id());
+	ASSERT_EQ(5, results.at(0).score());
+	ASSERT_EQ(2, results.at(1).id());
+	ASSERT_EQ(3, results.at(1).score());
+	ASSERT_EQ(1, results.at(2).id());
+	ASSERT_EQ(1, results.at(2).score());
+}
+
+TEST(TopHitsCollectorTest, Clear)
+{
+	TopHitsCollector collector(10);
+	collector.reserve(100);
+	collector.collect(1);
+	collector.collect(1);
+	ASSERT_EQ(1, collector.topResults().size());
+
+	collector.clear();
+	ASSERT_EQ(0, collector.topResults().size());
+
+	collector.collect(2);
+	QList<Result> results = collector.topResults();
+	ASSERT_EQ(1, results.size());
+	ASSERT_EQ(2, results.at(0).id());
+	ASSERT_EQ(1, results.at(0).score());
+}
+
+TEST(TopHitsCollectorTest, MinCompetitiveScore)
+{
+	TopHitsCollector collector(2);
+	ASSERT_EQ(0, collector.minCompetitiveScore());
+	collector.collect(1);
+	collector.collect(1);
+	collector.collect(1);
+	ASSERT_EQ(0, collector.minCompetitiveScore());
+	collector.collect(2);
+	ASSERT_EQ(1, collector.minCompetitiveScore());
+	collector.collect(2);
+	collector.collect(3);
+	ASSERT_EQ(2, collector.minCompetitiveScore());
+
+	// Only documents that were already collected are counted.
+	collector.collectExisting(3);
+	collector.collectExisting(4);
+	QList<Result> results = collector.topResults();
+	ASSERT_EQ(2, results.size());
+	ASSERT_EQ(1, results[0].id());
+	ASSERT_EQ(2, results[1].id());
+
+	collector.clear();
+	ASSERT_EQ(0, collector.minCompetitiveScore());
+}
+
+TEST(TopHitsCollectorTest, MinCompetitiveScoreTopScorePercent)
+{
+	TopHitsCollector collector(10, 50);
+	for (int i = 0; i < 10; i++) {
+		collector.collect(1);
+	}
+	collector.collect(2);
+	ASSERT_EQ(5, collector.minCompetitiveScore());
+}
+
+TEST(TopHitsCollectorTest, CompetitiveDocuments)
+{
+	TopHitsCollector collector(2);
+	collector.collectCount(1, 3);
+	collector.collectCount(2, 2);
+	collector.collectCount(3, 1);
+	std::vector<uint32_t> ids;
+	ASSERT_TRUE(collector.competitiveDocuments(2, &ids));
+	std::sort(ids.begin(), ids.end());
+	ASSERT_EQ(std::vector<uint32_t>({ 1, 2 }), ids);
+}
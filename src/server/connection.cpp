@@ -28,6 +28,9 @@ Connection::Connection(IndexSharedPtr index, QTcpSocket *socket, QObject *parent
     connect(m_socket, &QTcpSocket::readyRead, this, &Connection::readIncomingData);
     connect(m_socket, &QTcpSocket::disconnected, this, &Connection::disconnected);
 
+    // Nobody will read the results once the client is gone.
+    connect(m_socket, &QTcpSocket::disconnected, this, [this]() { m_session->cancel(); });
+
     connect(m_handler, &QFutureWatcher<QPair<QSharedPointer<Request>, QString>>::finished, [this]() {
         if (!m_handler->isCanceled()) {
             auto result = m_handler->result();
@@ -64,6 +67,7 @@ void Connection::close()
 {
     if (!m_handler->isFinished()) {
         m_handler->cancel();
+        m_session->cancel();
     }
     m_socket->disconnectFromHost();
 }
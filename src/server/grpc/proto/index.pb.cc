@@ -5,685 +5,685 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace protobuf_index_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_DeleteDocumentOp;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_InsertOrUpdateDocumentOp;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SearchResult;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SetAttributeOp;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto ::google::protobuf::internal::SCCInfo<3> scc_info_Operation;
-}  // namespace protobuf_index_2eproto
 namespace Acoustid {
 namespace Server {
 namespace PB {
-class GetDocumentRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GetDocumentRequest>
-      _instance;
-} _GetDocumentRequest_default_instance_;
-class GetDocumentResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GetDocumentResponse>
-      _instance;
-} _GetDocumentResponse_default_instance_;
-class GetAttributeRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GetAttributeRequest>
-      _instance;
-} _GetAttributeRequest_default_instance_;
-class GetAttributeResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GetAttributeResponse>
-      _instance;
-} _GetAttributeResponse_default_instance_;
-class InsertOrUpdateDocumentOpDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<InsertOrUpdateDocumentOp>
-      _instance;
-} _InsertOrUpdateDocumentOp_default_instance_;
-class DeleteDocumentOpDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<DeleteDocumentOp>
-      _instance;
-} _DeleteDocumentOp_default_instance_;
-class SetAttributeOpDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SetAttributeOp>
-      _instance;
-} _SetAttributeOp_default_instance_;
-class OperationDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Operation>
-      _instance;
-  const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document_;
-  const ::Acoustid::Server::PB::DeleteDocumentOp* delete_document_;
-  const ::Acoustid::Server::PB::SetAttributeOp* set_attribute_;
-} _Operation_default_instance_;
-class UpdateRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<UpdateRequest>
-      _instance;
-} _UpdateRequest_default_instance_;
-class UpdateResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<UpdateResponse>
-      _instance;
-} _UpdateResponse_default_instance_;
-class SearchResultDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SearchResult>
-      _instance;
-} _SearchResult_default_instance_;
-class SearchRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SearchRequest>
-      _instance;
-} _SearchRequest_default_instance_;
-class SearchResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SearchResponse>
-      _instance;
-} _SearchResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetDocumentRequest::GetDocumentRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.index_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.doc_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetDocumentRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetDocumentRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetDocumentRequestDefaultTypeInternal() {}
+  union {
+    GetDocumentRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetDocumentRequestDefaultTypeInternal _GetDocumentRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetDocumentResponse::GetDocumentResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.terms_)*/{}
+  , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetDocumentResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetDocumentResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetDocumentResponseDefaultTypeInternal() {}
+  union {
+    GetDocumentResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetDocumentResponseDefaultTypeInternal _GetDocumentResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetAttributeRequest::GetAttributeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.index_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttributeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttributeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttributeRequestDefaultTypeInternal() {}
+  union {
+    GetAttributeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttributeRequestDefaultTypeInternal _GetAttributeRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetAttributeResponse::GetAttributeResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttributeResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttributeResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttributeResponseDefaultTypeInternal() {}
+  union {
+    GetAttributeResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttributeResponseDefaultTypeInternal _GetAttributeResponse_default_instance_;
+PROTOBUF_CONSTEXPR InsertOrUpdateDocumentOp::InsertOrUpdateDocumentOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.terms_)*/{}
+  , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.doc_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InsertOrUpdateDocumentOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InsertOrUpdateDocumentOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InsertOrUpdateDocumentOpDefaultTypeInternal() {}
+  union {
+    InsertOrUpdateDocumentOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InsertOrUpdateDocumentOpDefaultTypeInternal _InsertOrUpdateDocumentOp_default_instance_;
+PROTOBUF_CONSTEXPR DeleteDocumentOp::DeleteDocumentOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.doc_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteDocumentOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteDocumentOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteDocumentOpDefaultTypeInternal() {}
+  union {
+    DeleteDocumentOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteDocumentOpDefaultTypeInternal _DeleteDocumentOp_default_instance_;
+PROTOBUF_CONSTEXPR SetAttributeOp::SetAttributeOp(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetAttributeOpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetAttributeOpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetAttributeOpDefaultTypeInternal() {}
+  union {
+    SetAttributeOp _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetAttributeOpDefaultTypeInternal _SetAttributeOp_default_instance_;
+PROTOBUF_CONSTEXPR Operation::Operation(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.op_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct OperationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OperationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OperationDefaultTypeInternal() {}
+  union {
+    Operation _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationDefaultTypeInternal _Operation_default_instance_;
+PROTOBUF_CONSTEXPR UpdateRequest::UpdateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ops_)*/{}
+  , /*decltype(_impl_.index_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateRequestDefaultTypeInternal() {}
+  union {
+    UpdateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateRequestDefaultTypeInternal _UpdateRequest_default_instance_;
+PROTOBUF_CONSTEXPR UpdateResponse::UpdateResponse(
+    ::_pbi::ConstantInitialized) {}
+struct UpdateResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateResponseDefaultTypeInternal() {}
+  union {
+    UpdateResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateResponseDefaultTypeInternal _UpdateResponse_default_instance_;
+PROTOBUF_CONSTEXPR SearchResult::SearchResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.doc_id_)*/0u
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchResultDefaultTypeInternal() {}
+  union {
+    SearchResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchResultDefaultTypeInternal _SearchResult_default_instance_;
+PROTOBUF_CONSTEXPR DocumentFilter::DocumentFilter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bitmap_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.min_id_)*/0u
+  , /*decltype(_impl_.max_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DocumentFilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DocumentFilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DocumentFilterDefaultTypeInternal() {}
+  union {
+    DocumentFilter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DocumentFilterDefaultTypeInternal _DocumentFilter_default_instance_;
+PROTOBUF_CONSTEXPR SearchRequest::SearchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.terms_)*/{}
+  , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.index_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filter_)*/nullptr
+  , /*decltype(_impl_.max_results_)*/0
+  , /*decltype(_impl_.bypass_cache_)*/false
+  , /*decltype(_impl_.allow_partial_results_)*/false
+  , /*decltype(_impl_.sampled_)*/false
+  , /*decltype(_impl_.sample_stride_)*/0u
+  , /*decltype(_impl_.sample_candidates_)*/0u
+  , /*decltype(_impl_.expand_distance_)*/0u
+  , /*decltype(_impl_.expand_mask_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchRequestDefaultTypeInternal() {}
+  union {
+    SearchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchRequestDefaultTypeInternal _SearchRequest_default_instance_;
+PROTOBUF_CONSTEXPR SearchResponse::SearchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.partial_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchResponseDefaultTypeInternal() {}
+  union {
+    SearchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchResponseDefaultTypeInternal _SearchResponse_default_instance_;
+PROTOBUF_CONSTEXPR SearchQuery::SearchQuery(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.terms_)*/{}
+  , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.max_results_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchQueryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchQueryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchQueryDefaultTypeInternal() {}
+  union {
+    SearchQuery _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchQueryDefaultTypeInternal _SearchQuery_default_instance_;
+PROTOBUF_CONSTEXPR BatchSearchRequest::BatchSearchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.queries_)*/{}
+  , /*decltype(_impl_.index_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.allow_partial_results_)*/false
+  , /*decltype(_impl_.interleaved_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchSearchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchSearchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchSearchRequestDefaultTypeInternal() {}
+  union {
+    BatchSearchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchSearchRequestDefaultTypeInternal _BatchSearchRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchSearchResponse::BatchSearchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_.partial_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchSearchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchSearchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchSearchResponseDefaultTypeInternal() {}
+  union {
+    BatchSearchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchSearchResponseDefaultTypeInternal _BatchSearchResponse_default_instance_;
 }  // namespace PB
 }  // namespace Server
 }  // namespace Acoustid
-namespace protobuf_index_2eproto {
-static void InitDefaultsGetDocumentRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_GetDocumentRequest_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::GetDocumentRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::GetDocumentRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GetDocumentRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGetDocumentRequest}, {}};
-
-static void InitDefaultsGetDocumentResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_GetDocumentResponse_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::GetDocumentResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::GetDocumentResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GetDocumentResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGetDocumentResponse}, {}};
-
-static void InitDefaultsGetAttributeRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_GetAttributeRequest_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::GetAttributeRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::GetAttributeRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GetAttributeRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGetAttributeRequest}, {}};
-
-static void InitDefaultsGetAttributeResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_GetAttributeResponse_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::GetAttributeResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::GetAttributeResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GetAttributeResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGetAttributeResponse}, {}};
-
-static void InitDefaultsInsertOrUpdateDocumentOp() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_InsertOrUpdateDocumentOp_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::InsertOrUpdateDocumentOp();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::InsertOrUpdateDocumentOp::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_InsertOrUpdateDocumentOp =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsInsertOrUpdateDocumentOp}, {}};
-
-static void InitDefaultsDeleteDocumentOp() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_DeleteDocumentOp_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::DeleteDocumentOp();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::DeleteDocumentOp::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_DeleteDocumentOp =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsDeleteDocumentOp}, {}};
-
-static void InitDefaultsSetAttributeOp() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_SetAttributeOp_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::SetAttributeOp();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::SetAttributeOp::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SetAttributeOp =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSetAttributeOp}, {}};
-
-static void InitDefaultsOperation() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_Operation_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::Operation();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::Operation::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<3> scc_info_Operation =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 3, InitDefaultsOperation}, {
-      &protobuf_index_2eproto::scc_info_InsertOrUpdateDocumentOp.base,
-      &protobuf_index_2eproto::scc_info_DeleteDocumentOp.base,
-      &protobuf_index_2eproto::scc_info_SetAttributeOp.base,}};
-
-static void InitDefaultsUpdateRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_UpdateRequest_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::UpdateRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::UpdateRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_UpdateRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsUpdateRequest}, {
-      &protobuf_index_2eproto::scc_info_Operation.base,}};
-
-static void InitDefaultsUpdateResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_UpdateResponse_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::UpdateResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::UpdateResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_UpdateResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsUpdateResponse}, {}};
-
-static void InitDefaultsSearchResult() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_SearchResult_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::SearchResult();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::SearchResult::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SearchResult =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSearchResult}, {}};
-
-static void InitDefaultsSearchRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_SearchRequest_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::SearchRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::SearchRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SearchRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSearchRequest}, {}};
-
-static void InitDefaultsSearchResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::Acoustid::Server::PB::_SearchResponse_default_instance_;
-    new (ptr) ::Acoustid::Server::PB::SearchResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::Acoustid::Server::PB::SearchResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SearchResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSearchResponse}, {
-      &protobuf_index_2eproto::scc_info_SearchResult.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_GetDocumentRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GetDocumentResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GetAttributeRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GetAttributeResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_InsertOrUpdateDocumentOp.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_DeleteDocumentOp.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SetAttributeOp.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Operation.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_UpdateRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_UpdateResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SearchResult.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SearchRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SearchResponse.base);
-}
+static ::_pb::Metadata file_level_metadata_index_2eproto[17];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_index_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_index_2eproto = nullptr;
 
-::google::protobuf::Metadata file_level_metadata[13];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_index_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, _impl_.index_name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, _impl_.doc_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentResponse, _impl_.terms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, _impl_.index_name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, _impl_.name_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, index_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentRequest, doc_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeResponse, _impl_.value_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetDocumentResponse, terms_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, _impl_.doc_id_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, _impl_.terms_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DeleteDocumentOp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, index_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeRequest, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DeleteDocumentOp, _impl_.doc_id_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::GetAttributeResponse, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::Operation, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::Operation, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::Operation, _impl_.op_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, doc_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::InsertOrUpdateDocumentOp, terms_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, _impl_.index_name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, _impl_.ops_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::DeleteDocumentOp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::UpdateResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::DeleteDocumentOp, doc_id_),
+  ~0u,  // no _inlined_string_donated_
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SetAttributeOp, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, _impl_.doc_id_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, _impl_.score_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::Operation, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DocumentFilter, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::Operation, _oneof_case_[0]),
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  offsetof(::Acoustid::Server::PB::OperationDefaultTypeInternal, insert_or_update_document_),
-  offsetof(::Acoustid::Server::PB::OperationDefaultTypeInternal, delete_document_),
-  offsetof(::Acoustid::Server::PB::OperationDefaultTypeInternal, set_attribute_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::Operation, op_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DocumentFilter, _impl_.min_id_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DocumentFilter, _impl_.max_id_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::DocumentFilter, _impl_.bitmap_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, index_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::UpdateRequest, ops_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.index_name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.terms_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.max_results_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.bypass_cache_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.allow_partial_results_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.sampled_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.sample_stride_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.sample_candidates_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.expand_distance_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.expand_mask_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _impl_.filter_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::UpdateResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResponse, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchResponse, _impl_.partial_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchQuery, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, doc_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchResult, score_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchQuery, _impl_.terms_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::SearchQuery, _impl_.max_results_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, index_name_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, terms_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchRequest, max_results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchRequest, _impl_.index_name_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchRequest, _impl_.queries_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchRequest, _impl_.allow_partial_results_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchRequest, _impl_.interleaved_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::Acoustid::Server::PB::SearchResponse, results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchResponse, _impl_.responses_),
+  PROTOBUF_FIELD_OFFSET(::Acoustid::Server::PB::BatchSearchResponse, _impl_.partial_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::Acoustid::Server::PB::GetDocumentRequest)},
-  { 7, -1, sizeof(::Acoustid::Server::PB::GetDocumentResponse)},
-  { 13, -1, sizeof(::Acoustid::Server::PB::GetAttributeRequest)},
-  { 20, -1, sizeof(::Acoustid::Server::PB::GetAttributeResponse)},
-  { 26, -1, sizeof(::Acoustid::Server::PB::InsertOrUpdateDocumentOp)},
-  { 33, -1, sizeof(::Acoustid::Server::PB::DeleteDocumentOp)},
-  { 39, -1, sizeof(::Acoustid::Server::PB::SetAttributeOp)},
-  { 46, -1, sizeof(::Acoustid::Server::PB::Operation)},
-  { 55, -1, sizeof(::Acoustid::Server::PB::UpdateRequest)},
-  { 62, -1, sizeof(::Acoustid::Server::PB::UpdateResponse)},
-  { 67, -1, sizeof(::Acoustid::Server::PB::SearchResult)},
-  { 74, -1, sizeof(::Acoustid::Server::PB::SearchRequest)},
-  { 82, -1, sizeof(::Acoustid::Server::PB::SearchResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::Acoustid::Server::PB::GetDocumentRequest)},
+  { 8, -1, -1, sizeof(::Acoustid::Server::PB::GetDocumentResponse)},
+  { 15, -1, -1, sizeof(::Acoustid::Server::PB::GetAttributeRequest)},
+  { 23, -1, -1, sizeof(::Acoustid::Server::PB::GetAttributeResponse)},
+  { 30, -1, -1, sizeof(::Acoustid::Server::PB::InsertOrUpdateDocumentOp)},
+  { 38, -1, -1, sizeof(::Acoustid::Server::PB::DeleteDocumentOp)},
+  { 45, -1, -1, sizeof(::Acoustid::Server::PB::SetAttributeOp)},
+  { 53, -1, -1, sizeof(::Acoustid::Server::PB::Operation)},
+  { 63, -1, -1, sizeof(::Acoustid::Server::PB::UpdateRequest)},
+  { 71, -1, -1, sizeof(::Acoustid::Server::PB::UpdateResponse)},
+  { 77, -1, -1, sizeof(::Acoustid::Server::PB::SearchResult)},
+  { 85, -1, -1, sizeof(::Acoustid::Server::PB::DocumentFilter)},
+  { 94, -1, -1, sizeof(::Acoustid::Server::PB::SearchRequest)},
+  { 111, -1, -1, sizeof(::Acoustid::Server::PB::SearchResponse)},
+  { 119, -1, -1, sizeof(::Acoustid::Server::PB::SearchQuery)},
+  { 127, -1, -1, sizeof(::Acoustid::Server::PB::BatchSearchRequest)},
+  { 137, -1, -1, sizeof(::Acoustid::Server::PB::BatchSearchResponse)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_GetDocumentRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_GetDocumentResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_GetAttributeRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_GetAttributeResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_InsertOrUpdateDocumentOp_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_DeleteDocumentOp_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_SetAttributeOp_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_Operation_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_UpdateRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_UpdateResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_SearchResult_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_SearchRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::Acoustid::Server::PB::_SearchResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::Acoustid::Server::PB::_GetDocumentRequest_default_instance_._instance,
+  &::Acoustid::Server::PB::_GetDocumentResponse_default_instance_._instance,
+  &::Acoustid::Server::PB::_GetAttributeRequest_default_instance_._instance,
+  &::Acoustid::Server::PB::_GetAttributeResponse_default_instance_._instance,
+  &::Acoustid::Server::PB::_InsertOrUpdateDocumentOp_default_instance_._instance,
+  &::Acoustid::Server::PB::_DeleteDocumentOp_default_instance_._instance,
+  &::Acoustid::Server::PB::_SetAttributeOp_default_instance_._instance,
+  &::Acoustid::Server::PB::_Operation_default_instance_._instance,
+  &::Acoustid::Server::PB::_UpdateRequest_default_instance_._instance,
+  &::Acoustid::Server::PB::_UpdateResponse_default_instance_._instance,
+  &::Acoustid::Server::PB::_SearchResult_default_instance_._instance,
+  &::Acoustid::Server::PB::_DocumentFilter_default_instance_._instance,
+  &::Acoustid::Server::PB::_SearchRequest_default_instance_._instance,
+  &::Acoustid::Server::PB::_SearchResponse_default_instance_._instance,
+  &::Acoustid::Server::PB::_SearchQuery_default_instance_._instance,
+  &::Acoustid::Server::PB::_BatchSearchRequest_default_instance_._instance,
+  &::Acoustid::Server::PB::_BatchSearchResponse_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "index.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 13);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\013index.proto\022\022Acoustid.Server.PB\"8\n\022Get"
-      "DocumentRequest\022\022\n\nindex_name\030\001 \001(\t\022\016\n\006d"
-      "oc_id\030\002 \001(\r\"$\n\023GetDocumentResponse\022\r\n\005te"
-      "rms\030\002 \003(\r\"7\n\023GetAttributeRequest\022\022\n\ninde"
-      "x_name\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\"%\n\024GetAttribu"
-      "teResponse\022\r\n\005value\030\002 \001(\t\"9\n\030InsertOrUpd"
-      "ateDocumentOp\022\016\n\006doc_id\030\001 \001(\r\022\r\n\005terms\030\002"
-      " \003(\r\"\"\n\020DeleteDocumentOp\022\016\n\006doc_id\030\001 \001(\r"
-      "\"-\n\016SetAttributeOp\022\014\n\004name\030\001 \001(\t\022\r\n\005valu"
-      "e\030\002 \001(\t\"\342\001\n\tOperation\022Q\n\031insert_or_updat"
-      "e_document\030\001 \001(\0132,.Acoustid.Server.PB.In"
-      "sertOrUpdateDocumentOpH\000\022\?\n\017delete_docum"
-      "ent\030\002 \001(\0132$.Acoustid.Server.PB.DeleteDoc"
-      "umentOpH\000\022;\n\rset_attribute\030\003 \001(\0132\".Acous"
-      "tid.Server.PB.SetAttributeOpH\000B\004\n\002op\"O\n\r"
-      "UpdateRequest\022\022\n\nindex_name\030\001 \001(\t\022*\n\003ops"
-      "\030\002 \003(\0132\035.Acoustid.Server.PB.Operation\"\020\n"
-      "\016UpdateResponse\"-\n\014SearchResult\022\016\n\006doc_i"
-      "d\030\001 \001(\r\022\r\n\005score\030\002 \001(\002\"G\n\rSearchRequest\022"
-      "\022\n\nindex_name\030\001 \001(\t\022\r\n\005terms\030\002 \003(\r\022\023\n\013ma"
-      "x_results\030\003 \001(\005\"C\n\016SearchResponse\0221\n\007res"
-      "ults\030\001 \003(\0132 .Acoustid.Server.PB.SearchRe"
-      "sult2\354\002\n\005Index\022^\n\013GetDocument\022&.Acoustid"
-      ".Server.PB.GetDocumentRequest\032\'.Acoustid"
-      ".Server.PB.GetDocumentResponse\022a\n\014GetAtt"
-      "ribute\022\'.Acoustid.Server.PB.GetAttribute"
-      "Request\032(.Acoustid.Server.PB.GetAttribut"
-      "eResponse\022O\n\006Update\022!.Acoustid.Server.PB"
-      ".UpdateRequest\032\".Acoustid.Server.PB.Upda"
-      "teResponse\022O\n\006Search\022!.Acoustid.Server.P"
-      "B.SearchRequest\032\".Acoustid.Server.PB.Sea"
-      "rchResponseb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1259);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "index.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_index_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013index.proto\022\022Acoustid.Server.PB\"8\n\022Get"
+  "DocumentRequest\022\022\n\nindex_name\030\001 \001(\t\022\016\n\006d"
+  "oc_id\030\002 \001(\r\"$\n\023GetDocumentResponse\022\r\n\005te"
+  "rms\030\002 \003(\r\"7\n\023GetAttributeRequest\022\022\n\ninde"
+  "x_name\030\001 \001(\t\022\014\n\004name\030\002 \001(\t\"%\n\024GetAttribu"
+  "teResponse\022\r\n\005value\030\002 \001(\t\"9\n\030InsertOrUpd"
+  "ateDocumentOp\022\016\n\006doc_id\030\001 \001(\r\022\r\n\005terms\030\002"
+  " \003(\r\"\"\n\020DeleteDocumentOp\022\016\n\006doc_id\030\001 \001(\r"
+  "\"-\n\016SetAttributeOp\022\014\n\004name\030\001 \001(\t\022\r\n\005valu"
+  "e\030\002 \001(\t\"\342\001\n\tOperation\022Q\n\031insert_or_updat"
+  "e_document\030\001 \001(\0132,.Acoustid.Server.PB.In"
+  "sertOrUpdateDocumentOpH\000\022\?\n\017delete_docum"
+  "ent\030\002 \001(\0132$.Acoustid.Server.PB.DeleteDoc"
+  "umentOpH\000\022;\n\rset_attribute\030\003 \001(\0132\".Acous"
+  "tid.Server.PB.SetAttributeOpH\000B\004\n\002op\"O\n\r"
+  "UpdateRequest\022\022\n\nindex_name\030\001 \001(\t\022*\n\003ops"
+  "\030\002 \003(\0132\035.Acoustid.Server.PB.Operation\"\020\n"
+  "\016UpdateResponse\"-\n\014SearchResult\022\016\n\006doc_i"
+  "d\030\001 \001(\r\022\r\n\005score\030\002 \001(\002\"@\n\016DocumentFilter"
+  "\022\016\n\006min_id\030\001 \001(\r\022\016\n\006max_id\030\002 \001(\r\022\016\n\006bitm"
+  "ap\030\003 \001(\014\"\241\002\n\rSearchRequest\022\022\n\nindex_name"
+  "\030\001 \001(\t\022\r\n\005terms\030\002 \003(\r\022\023\n\013max_results\030\003 \001"
+  "(\005\022\024\n\014bypass_cache\030\004 \001(\010\022\035\n\025allow_partia"
+  "l_results\030\005 \001(\010\022\017\n\007sampled\030\006 \001(\010\022\025\n\rsamp"
+  "le_stride\030\007 \001(\r\022\031\n\021sample_candidates\030\010 \001"
+  "(\r\022\027\n\017expand_distance\030\t \001(\r\022\023\n\013expand_ma"
+  "sk\030\n \001(\007\0222\n\006filter\030\013 \001(\0132\".Acoustid.Serv"
+  "er.PB.DocumentFilter\"T\n\016SearchResponse\0221"
+  "\n\007results\030\001 \003(\0132 .Acoustid.Server.PB.Sea"
+  "rchResult\022\017\n\007partial\030\002 \001(\010\"1\n\013SearchQuer"
+  "y\022\r\n\005terms\030\001 \003(\r\022\023\n\013max_results\030\002 \001(\005\"\216\001"
+  "\n\022BatchSearchRequest\022\022\n\nindex_name\030\001 \001(\t"
+  "\0220\n\007queries\030\002 \003(\0132\037.Acoustid.Server.PB.S"
+  "earchQuery\022\035\n\025allow_partial_results\030\003 \001("
+  "\010\022\023\n\013interleaved\030\004 \001(\010\"]\n\023BatchSearchRes"
+  "ponse\0225\n\tresponses\030\001 \003(\0132\".Acoustid.Serv"
+  "er.PB.SearchResponse\022\017\n\007partial\030\002 \001(\0102\314\003"
+  "\n\005Index\022^\n\013GetDocument\022&.Acoustid.Server"
+  ".PB.GetDocumentRequest\032\'.Acoustid.Server"
+  ".PB.GetDocumentResponse\022a\n\014GetAttribute\022"
+  "\'.Acoustid.Server.PB.GetAttributeRequest"
+  "\032(.Acoustid.Server.PB.GetAttributeRespon"
+  "se\022O\n\006Update\022!.Acoustid.Server.PB.Update"
+  "Request\032\".Acoustid.Server.PB.UpdateRespo"
+  "nse\022O\n\006Search\022!.Acoustid.Server.PB.Searc"
+  "hRequest\032\".Acoustid.Server.PB.SearchResp"
+  "onse\022^\n\013BatchSearch\022&.Acoustid.Server.PB"
+  ".BatchSearchRequest\032\'.Acoustid.Server.PB"
+  ".BatchSearchResponseb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_index_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_index_2eproto = {
+    false, false, 1948, descriptor_table_protodef_index_2eproto,
+    "index.proto",
+    &descriptor_table_index_2eproto_once, nullptr, 0, 17,
+    schemas, file_default_instances, TableStruct_index_2eproto::offsets,
+    file_level_metadata_index_2eproto, file_level_enum_descriptors_index_2eproto,
+    file_level_service_descriptors_index_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_index_2eproto_getter() {
+  return &descriptor_table_index_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_index_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_index_2eproto(&descriptor_table_index_2eproto);
 namespace Acoustid {
 namespace Server {
 namespace PB {
 
 // ===================================================================
 
-void GetDocumentRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetDocumentRequest::kIndexNameFieldNumber;
-const int GetDocumentRequest::kDocIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GetDocumentRequest::_Internal {
+ public:
+};
 
-GetDocumentRequest::GetDocumentRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_GetDocumentRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.GetDocumentRequest)
+GetDocumentRequest::GetDocumentRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.GetDocumentRequest)
 }
 GetDocumentRequest::GetDocumentRequest(const GetDocumentRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.index_name().size() > 0) {
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
-  }
-  doc_id_ = from.doc_id_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetDocumentRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_name_){}
+    , decltype(_impl_.doc_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_index_name().empty()) {
+    _this->_impl_.index_name_.Set(from._internal_index_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.doc_id_ = from._impl_.doc_id_;
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.GetDocumentRequest)
 }
 
-void GetDocumentRequest::SharedCtor() {
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  doc_id_ = 0u;
+inline void GetDocumentRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_name_){}
+    , decltype(_impl_.doc_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetDocumentRequest::~GetDocumentRequest() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.GetDocumentRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GetDocumentRequest::SharedDtor() {
-  index_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GetDocumentRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.index_name_.Destroy();
 }
 
 void GetDocumentRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GetDocumentRequest::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GetDocumentRequest& GetDocumentRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_GetDocumentRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GetDocumentRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.GetDocumentRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  doc_id_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool GetDocumentRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.GetDocumentRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.index_name_.ClearToEmpty();
+  _impl_.doc_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetDocumentRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string index_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_index_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->index_name().data(), static_cast<int>(this->index_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.GetDocumentRequest.index_name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_index_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.GetDocumentRequest.index_name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 doc_id = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &doc_id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.doc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.GetDocumentRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.GetDocumentRequest)
-  return false;
-#undef DO_
-}
-
-void GetDocumentRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.GetDocumentRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.GetDocumentRequest.index_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->index_name(), output);
-  }
-
-  // uint32 doc_id = 2;
-  if (this->doc_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->doc_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.GetDocumentRequest)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GetDocumentRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* GetDocumentRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.GetDocumentRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_index_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_index_name().data(), static_cast<int>(this->_internal_index_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.GetDocumentRequest.index_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->index_name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_index_name(), target);
   }
 
   // uint32 doc_id = 2;
-  if (this->doc_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->doc_id(), target);
+  if (this->_internal_doc_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_doc_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.GetDocumentRequest)
   return target;
@@ -693,66 +693,47 @@ size_t GetDocumentRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.GetDocumentRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
+  if (!this->_internal_index_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->index_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_index_name());
   }
 
   // uint32 doc_id = 2;
-  if (this->doc_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->doc_id());
+  if (this->_internal_doc_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_doc_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetDocumentRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.GetDocumentRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetDocumentRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetDocumentRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.GetDocumentRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.GetDocumentRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetDocumentRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetDocumentRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetDocumentRequest::GetClassData() const { return &_class_data_; }
 
-void GetDocumentRequest::MergeFrom(const GetDocumentRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetDocumentRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.index_name().size() > 0) {
+void GetDocumentRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetDocumentRequest*>(&to_msg);
+  auto& from = static_cast<const GetDocumentRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetDocumentRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
+  if (!from._internal_index_name().empty()) {
+    _this->_internal_set_index_name(from._internal_index_name());
   }
-  if (from.doc_id() != 0) {
-    set_doc_id(from.doc_id());
+  if (from._internal_doc_id() != 0) {
+    _this->_internal_set_doc_id(from._internal_doc_id());
   }
-}
-
-void GetDocumentRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.GetDocumentRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetDocumentRequest::CopyFrom(const GetDocumentRequest& from) {
@@ -766,178 +747,145 @@ bool GetDocumentRequest::IsInitialized() const {
   return true;
 }
 
-void GetDocumentRequest::Swap(GetDocumentRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GetDocumentRequest::InternalSwap(GetDocumentRequest* other) {
   using std::swap;
-  index_name_.Swap(&other->index_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(doc_id_, other->doc_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.index_name_, lhs_arena,
+      &other->_impl_.index_name_, rhs_arena
+  );
+  swap(_impl_.doc_id_, other->_impl_.doc_id_);
 }
 
-::google::protobuf::Metadata GetDocumentRequest::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GetDocumentRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void GetDocumentResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetDocumentResponse::kTermsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GetDocumentResponse::_Internal {
+ public:
+};
 
-GetDocumentResponse::GetDocumentResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_GetDocumentResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.GetDocumentResponse)
+GetDocumentResponse::GetDocumentResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.GetDocumentResponse)
 }
 GetDocumentResponse::GetDocumentResponse(const GetDocumentResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      terms_(from.terms_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetDocumentResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){from._impl_.terms_}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.GetDocumentResponse)
 }
 
-void GetDocumentResponse::SharedCtor() {
+inline void GetDocumentResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){arena}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GetDocumentResponse::~GetDocumentResponse() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.GetDocumentResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GetDocumentResponse::SharedDtor() {
+inline void GetDocumentResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.terms_.~RepeatedField();
 }
 
 void GetDocumentResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GetDocumentResponse::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const GetDocumentResponse& GetDocumentResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_GetDocumentResponse.base);
-  return *internal_default_instance();
-}
-
-
 void GetDocumentResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.GetDocumentResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  terms_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.terms_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool GetDocumentResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.GetDocumentResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* GetDocumentResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated uint32 terms = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_terms())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_terms())));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_terms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_terms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.GetDocumentResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.GetDocumentResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void GetDocumentResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.GetDocumentResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* GetDocumentResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.GetDocumentResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _terms_cached_byte_size_));
-  }
-  for (int i = 0, n = this->terms_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->terms(i), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  {
+    int byte_size = _impl_._terms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_terms(), byte_size, target);
+    }
   }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.GetDocumentResponse)
-}
 
-::google::protobuf::uint8* GetDocumentResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.GetDocumentResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _terms_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->terms_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.GetDocumentResponse)
   return target;
@@ -947,62 +895,44 @@ size_t GetDocumentResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.GetDocumentResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 terms = 2;
   {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->terms_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.terms_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _terms_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._terms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetDocumentResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.GetDocumentResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetDocumentResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetDocumentResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.GetDocumentResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.GetDocumentResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetDocumentResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetDocumentResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetDocumentResponse::GetClassData() const { return &_class_data_; }
 
-void GetDocumentResponse::MergeFrom(const GetDocumentResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetDocumentResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  terms_.MergeFrom(from.terms_);
-}
+void GetDocumentResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetDocumentResponse*>(&to_msg);
+  auto& from = static_cast<const GetDocumentResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetDocumentResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GetDocumentResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.GetDocumentResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.terms_.MergeFrom(from._impl_.terms_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetDocumentResponse::CopyFrom(const GetDocumentResponse& from) {
@@ -1016,220 +946,185 @@ bool GetDocumentResponse::IsInitialized() const {
   return true;
 }
 
-void GetDocumentResponse::Swap(GetDocumentResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GetDocumentResponse::InternalSwap(GetDocumentResponse* other) {
   using std::swap;
-  terms_.InternalSwap(&other->terms_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.terms_.InternalSwap(&other->_impl_.terms_);
 }
 
-::google::protobuf::Metadata GetDocumentResponse::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GetDocumentResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void GetAttributeRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetAttributeRequest::kIndexNameFieldNumber;
-const int GetAttributeRequest::kNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GetAttributeRequest::_Internal {
+ public:
+};
 
-GetAttributeRequest::GetAttributeRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_GetAttributeRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.GetAttributeRequest)
+GetAttributeRequest::GetAttributeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.GetAttributeRequest)
 }
 GetAttributeRequest::GetAttributeRequest(const GetAttributeRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.index_name().size() > 0) {
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
-  }
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttributeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_name_){}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_index_name().empty()) {
+    _this->_impl_.index_name_.Set(from._internal_index_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.GetAttributeRequest)
 }
 
-void GetAttributeRequest::SharedCtor() {
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GetAttributeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.index_name_){}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetAttributeRequest::~GetAttributeRequest() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.GetAttributeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GetAttributeRequest::SharedDtor() {
-  index_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GetAttributeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.index_name_.Destroy();
+  _impl_.name_.Destroy();
 }
 
 void GetAttributeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GetAttributeRequest::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GetAttributeRequest& GetAttributeRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_GetAttributeRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GetAttributeRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.GetAttributeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool GetAttributeRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.GetAttributeRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.index_name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetAttributeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string index_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_index_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->index_name().data(), static_cast<int>(this->index_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.GetAttributeRequest.index_name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_index_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.GetAttributeRequest.index_name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string name = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.GetAttributeRequest.name"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.GetAttributeRequest.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.GetAttributeRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.GetAttributeRequest)
-  return false;
-#undef DO_
-}
-
-void GetAttributeRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.GetAttributeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.GetAttributeRequest.index_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->index_name(), output);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.GetAttributeRequest.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->name(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.GetAttributeRequest)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GetAttributeRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* GetAttributeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.GetAttributeRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_index_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_index_name().data(), static_cast<int>(this->_internal_index_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.GetAttributeRequest.index_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->index_name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_index_name(), target);
   }
 
   // string name = 2;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.GetAttributeRequest.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.GetAttributeRequest)
   return target;
@@ -1239,67 +1134,49 @@ size_t GetAttributeRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.GetAttributeRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
+  if (!this->_internal_index_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->index_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_index_name());
   }
 
   // string name = 2;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetAttributeRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.GetAttributeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetAttributeRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetAttributeRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.GetAttributeRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.GetAttributeRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttributeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttributeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttributeRequest::GetClassData() const { return &_class_data_; }
 
-void GetAttributeRequest::MergeFrom(const GetAttributeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetAttributeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.index_name().size() > 0) {
+void GetAttributeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttributeRequest*>(&to_msg);
+  auto& from = static_cast<const GetAttributeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetAttributeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
+  if (!from._internal_index_name().empty()) {
+    _this->_internal_set_index_name(from._internal_index_name());
   }
-  if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void GetAttributeRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.GetAttributeRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetAttributeRequest::CopyFrom(const GetAttributeRequest& from) {
@@ -1313,178 +1190,158 @@ bool GetAttributeRequest::IsInitialized() const {
   return true;
 }
 
-void GetAttributeRequest::Swap(GetAttributeRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GetAttributeRequest::InternalSwap(GetAttributeRequest* other) {
   using std::swap;
-  index_name_.Swap(&other->index_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.index_name_, lhs_arena,
+      &other->_impl_.index_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata GetAttributeRequest::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttributeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void GetAttributeResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GetAttributeResponse::kValueFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GetAttributeResponse::_Internal {
+ public:
+};
 
-GetAttributeResponse::GetAttributeResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_GetAttributeResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.GetAttributeResponse)
+GetAttributeResponse::GetAttributeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.GetAttributeResponse)
 }
 GetAttributeResponse::GetAttributeResponse(const GetAttributeResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.value().size() > 0) {
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttributeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.GetAttributeResponse)
 }
 
-void GetAttributeResponse::SharedCtor() {
-  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GetAttributeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GetAttributeResponse::~GetAttributeResponse() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.GetAttributeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GetAttributeResponse::SharedDtor() {
-  value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GetAttributeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
 }
 
 void GetAttributeResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* GetAttributeResponse::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GetAttributeResponse& GetAttributeResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_GetAttributeResponse.base);
-  return *internal_default_instance();
-}
-
 
 void GetAttributeResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.GetAttributeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool GetAttributeResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.GetAttributeResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* GetAttributeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string value = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_value()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->value().data(), static_cast<int>(this->value().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.GetAttributeResponse.value"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.GetAttributeResponse.value"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.GetAttributeResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.GetAttributeResponse)
-  return false;
-#undef DO_
-}
-
-void GetAttributeResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.GetAttributeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), static_cast<int>(this->value().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.GetAttributeResponse.value");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->value(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.GetAttributeResponse)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GetAttributeResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* GetAttributeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.GetAttributeResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), static_cast<int>(this->value().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.GetAttributeResponse.value");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->value(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.GetAttributeResponse)
   return target;
@@ -1494,56 +1351,39 @@ size_t GetAttributeResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.GetAttributeResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->value());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GetAttributeResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.GetAttributeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GetAttributeResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GetAttributeResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.GetAttributeResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.GetAttributeResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttributeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttributeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttributeResponse::GetClassData() const { return &_class_data_; }
 
-void GetAttributeResponse::MergeFrom(const GetAttributeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetAttributeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.value().size() > 0) {
+void GetAttributeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttributeResponse*>(&to_msg);
+  auto& from = static_cast<const GetAttributeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.GetAttributeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-}
-
-void GetAttributeResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.GetAttributeResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GetAttributeResponse::CopyFrom(const GetAttributeResponse& from) {
@@ -1557,205 +1397,162 @@ bool GetAttributeResponse::IsInitialized() const {
   return true;
 }
 
-void GetAttributeResponse::Swap(GetAttributeResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GetAttributeResponse::InternalSwap(GetAttributeResponse* other) {
   using std::swap;
-  value_.Swap(&other->value_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata GetAttributeResponse::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttributeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void InsertOrUpdateDocumentOp::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int InsertOrUpdateDocumentOp::kDocIdFieldNumber;
-const int InsertOrUpdateDocumentOp::kTermsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class InsertOrUpdateDocumentOp::_Internal {
+ public:
+};
 
-InsertOrUpdateDocumentOp::InsertOrUpdateDocumentOp()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_InsertOrUpdateDocumentOp.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
+InsertOrUpdateDocumentOp::InsertOrUpdateDocumentOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
 }
 InsertOrUpdateDocumentOp::InsertOrUpdateDocumentOp(const InsertOrUpdateDocumentOp& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      terms_(from.terms_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  doc_id_ = from.doc_id_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InsertOrUpdateDocumentOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){from._impl_.terms_}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.doc_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.doc_id_ = from._impl_.doc_id_;
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
 }
 
-void InsertOrUpdateDocumentOp::SharedCtor() {
-  doc_id_ = 0u;
+inline void InsertOrUpdateDocumentOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){arena}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.doc_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 InsertOrUpdateDocumentOp::~InsertOrUpdateDocumentOp() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void InsertOrUpdateDocumentOp::SharedDtor() {
+inline void InsertOrUpdateDocumentOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.terms_.~RepeatedField();
 }
 
 void InsertOrUpdateDocumentOp::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* InsertOrUpdateDocumentOp::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const InsertOrUpdateDocumentOp& InsertOrUpdateDocumentOp::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_InsertOrUpdateDocumentOp.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void InsertOrUpdateDocumentOp::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  terms_.Clear();
-  doc_id_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool InsertOrUpdateDocumentOp::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.terms_.Clear();
+  _impl_.doc_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InsertOrUpdateDocumentOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 doc_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &doc_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.doc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 terms = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_terms())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_terms())));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_terms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_terms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void InsertOrUpdateDocumentOp::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* InsertOrUpdateDocumentOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->doc_id(), output);
+  if (this->_internal_doc_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_doc_id(), target);
   }
 
   // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _terms_cached_byte_size_));
-  }
-  for (int i = 0, n = this->terms_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->terms(i), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-}
-
-::google::protobuf::uint8* InsertOrUpdateDocumentOp::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->doc_id(), target);
+  {
+    int byte_size = _impl_._terms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_terms(), byte_size, target);
+    }
   }
 
-  // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _terms_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->terms_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
   return target;
@@ -1765,72 +1562,52 @@ size_t InsertOrUpdateDocumentOp::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 terms = 2;
   {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->terms_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.terms_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _terms_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._terms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->doc_id());
+  if (this->_internal_doc_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_doc_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InsertOrUpdateDocumentOp::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InsertOrUpdateDocumentOp* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const InsertOrUpdateDocumentOp>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertOrUpdateDocumentOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InsertOrUpdateDocumentOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertOrUpdateDocumentOp::GetClassData() const { return &_class_data_; }
 
-void InsertOrUpdateDocumentOp::MergeFrom(const InsertOrUpdateDocumentOp& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void InsertOrUpdateDocumentOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertOrUpdateDocumentOp*>(&to_msg);
+  auto& from = static_cast<const InsertOrUpdateDocumentOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  terms_.MergeFrom(from.terms_);
-  if (from.doc_id() != 0) {
-    set_doc_id(from.doc_id());
+  _this->_impl_.terms_.MergeFrom(from._impl_.terms_);
+  if (from._internal_doc_id() != 0) {
+    _this->_internal_set_doc_id(from._internal_doc_id());
   }
-}
-
-void InsertOrUpdateDocumentOp::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void InsertOrUpdateDocumentOp::CopyFrom(const InsertOrUpdateDocumentOp& from) {
@@ -1844,159 +1621,132 @@ bool InsertOrUpdateDocumentOp::IsInitialized() const {
   return true;
 }
 
-void InsertOrUpdateDocumentOp::Swap(InsertOrUpdateDocumentOp* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void InsertOrUpdateDocumentOp::InternalSwap(InsertOrUpdateDocumentOp* other) {
   using std::swap;
-  terms_.InternalSwap(&other->terms_);
-  swap(doc_id_, other->doc_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.terms_.InternalSwap(&other->_impl_.terms_);
+  swap(_impl_.doc_id_, other->_impl_.doc_id_);
 }
 
-::google::protobuf::Metadata InsertOrUpdateDocumentOp::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata InsertOrUpdateDocumentOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void DeleteDocumentOp::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DeleteDocumentOp::kDocIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class DeleteDocumentOp::_Internal {
+ public:
+};
 
-DeleteDocumentOp::DeleteDocumentOp()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_DeleteDocumentOp.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.DeleteDocumentOp)
+DeleteDocumentOp::DeleteDocumentOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.DeleteDocumentOp)
 }
 DeleteDocumentOp::DeleteDocumentOp(const DeleteDocumentOp& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  doc_id_ = from.doc_id_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteDocumentOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.doc_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.doc_id_ = from._impl_.doc_id_;
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.DeleteDocumentOp)
 }
 
-void DeleteDocumentOp::SharedCtor() {
-  doc_id_ = 0u;
+inline void DeleteDocumentOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.doc_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DeleteDocumentOp::~DeleteDocumentOp() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.DeleteDocumentOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DeleteDocumentOp::SharedDtor() {
+inline void DeleteDocumentOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void DeleteDocumentOp::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* DeleteDocumentOp::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const DeleteDocumentOp& DeleteDocumentOp::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_DeleteDocumentOp.base);
-  return *internal_default_instance();
-}
-
-
 void DeleteDocumentOp::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.DeleteDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  doc_id_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.doc_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool DeleteDocumentOp::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.DeleteDocumentOp)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* DeleteDocumentOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 doc_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &doc_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.doc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.DeleteDocumentOp)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.DeleteDocumentOp)
-  return false;
-#undef DO_
-}
-
-void DeleteDocumentOp::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.DeleteDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->doc_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.DeleteDocumentOp)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* DeleteDocumentOp::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* DeleteDocumentOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.DeleteDocumentOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->doc_id(), target);
+  if (this->_internal_doc_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_doc_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.DeleteDocumentOp)
   return target;
@@ -2006,55 +1756,37 @@ size_t DeleteDocumentOp::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.DeleteDocumentOp)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->doc_id());
+  if (this->_internal_doc_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_doc_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DeleteDocumentOp::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.DeleteDocumentOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DeleteDocumentOp* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const DeleteDocumentOp>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.DeleteDocumentOp)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.DeleteDocumentOp)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteDocumentOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteDocumentOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteDocumentOp::GetClassData() const { return &_class_data_; }
 
-void DeleteDocumentOp::MergeFrom(const DeleteDocumentOp& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.DeleteDocumentOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void DeleteDocumentOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteDocumentOp*>(&to_msg);
+  auto& from = static_cast<const DeleteDocumentOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.DeleteDocumentOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.doc_id() != 0) {
-    set_doc_id(from.doc_id());
+  if (from._internal_doc_id() != 0) {
+    _this->_internal_set_doc_id(from._internal_doc_id());
   }
-}
-
-void DeleteDocumentOp::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.DeleteDocumentOp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DeleteDocumentOp::CopyFrom(const DeleteDocumentOp& from) {
@@ -2068,220 +1800,185 @@ bool DeleteDocumentOp::IsInitialized() const {
   return true;
 }
 
-void DeleteDocumentOp::Swap(DeleteDocumentOp* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DeleteDocumentOp::InternalSwap(DeleteDocumentOp* other) {
   using std::swap;
-  swap(doc_id_, other->doc_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.doc_id_, other->_impl_.doc_id_);
 }
 
-::google::protobuf::Metadata DeleteDocumentOp::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteDocumentOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void SetAttributeOp::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SetAttributeOp::kNameFieldNumber;
-const int SetAttributeOp::kValueFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SetAttributeOp::_Internal {
+ public:
+};
 
-SetAttributeOp::SetAttributeOp()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_SetAttributeOp.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.SetAttributeOp)
+SetAttributeOp::SetAttributeOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.SetAttributeOp)
 }
 SetAttributeOp::SetAttributeOp(const SetAttributeOp& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.value().size() > 0) {
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetAttributeOp* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SetAttributeOp)
 }
 
-void SetAttributeOp::SharedCtor() {
-  name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SetAttributeOp::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SetAttributeOp::~SetAttributeOp() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SetAttributeOp)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SetAttributeOp::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void SetAttributeOp::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
 }
 
 void SetAttributeOp::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* SetAttributeOp::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SetAttributeOp& SetAttributeOp::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_SetAttributeOp.base);
-  return *internal_default_instance();
-}
-
 
 void SetAttributeOp::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SetAttributeOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool SetAttributeOp::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.SetAttributeOp)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.name_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetAttributeOp::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.SetAttributeOp.name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.SetAttributeOp.name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string value = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_value()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->value().data(), static_cast<int>(this->value().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.SetAttributeOp.value"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.SetAttributeOp.value"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.SetAttributeOp)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.SetAttributeOp)
-  return false;
-#undef DO_
-}
-
-void SetAttributeOp::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.SetAttributeOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.SetAttributeOp.name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), static_cast<int>(this->value().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.SetAttributeOp.value");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->value(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.SetAttributeOp)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SetAttributeOp::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SetAttributeOp::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SetAttributeOp)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.SetAttributeOp.name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // string value = 2;
-  if (this->value().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->value().data(), static_cast<int>(this->value().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.SetAttributeOp.value");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->value(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SetAttributeOp)
   return target;
@@ -2291,67 +1988,49 @@ size_t SetAttributeOp::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SetAttributeOp)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
   // string value = 2;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->value());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SetAttributeOp::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.SetAttributeOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SetAttributeOp* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SetAttributeOp>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.SetAttributeOp)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.SetAttributeOp)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetAttributeOp::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetAttributeOp::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetAttributeOp::GetClassData() const { return &_class_data_; }
 
-void SetAttributeOp::MergeFrom(const SetAttributeOp& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SetAttributeOp)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void SetAttributeOp::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetAttributeOp*>(&to_msg);
+  auto& from = static_cast<const SetAttributeOp&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SetAttributeOp)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.value().size() > 0) {
-
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-}
-
-void SetAttributeOp::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.SetAttributeOp)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SetAttributeOp::CopyFrom(const SetAttributeOp& from) {
@@ -2365,106 +2044,123 @@ bool SetAttributeOp::IsInitialized() const {
   return true;
 }
 
-void SetAttributeOp::Swap(SetAttributeOp* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SetAttributeOp::InternalSwap(SetAttributeOp* other) {
   using std::swap;
-  name_.Swap(&other->name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  value_.Swap(&other->value_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata SetAttributeOp::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SetAttributeOp::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void Operation::InitAsDefaultInstance() {
-  ::Acoustid::Server::PB::_Operation_default_instance_.insert_or_update_document_ = const_cast< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp*>(
-      ::Acoustid::Server::PB::InsertOrUpdateDocumentOp::internal_default_instance());
-  ::Acoustid::Server::PB::_Operation_default_instance_.delete_document_ = const_cast< ::Acoustid::Server::PB::DeleteDocumentOp*>(
-      ::Acoustid::Server::PB::DeleteDocumentOp::internal_default_instance());
-  ::Acoustid::Server::PB::_Operation_default_instance_.set_attribute_ = const_cast< ::Acoustid::Server::PB::SetAttributeOp*>(
-      ::Acoustid::Server::PB::SetAttributeOp::internal_default_instance());
+class Operation::_Internal {
+ public:
+  static const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& insert_or_update_document(const Operation* msg);
+  static const ::Acoustid::Server::PB::DeleteDocumentOp& delete_document(const Operation* msg);
+  static const ::Acoustid::Server::PB::SetAttributeOp& set_attribute(const Operation* msg);
+};
+
+const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp&
+Operation::_Internal::insert_or_update_document(const Operation* msg) {
+  return *msg->_impl_.op_.insert_or_update_document_;
+}
+const ::Acoustid::Server::PB::DeleteDocumentOp&
+Operation::_Internal::delete_document(const Operation* msg) {
+  return *msg->_impl_.op_.delete_document_;
+}
+const ::Acoustid::Server::PB::SetAttributeOp&
+Operation::_Internal::set_attribute(const Operation* msg) {
+  return *msg->_impl_.op_.set_attribute_;
 }
 void Operation::set_allocated_insert_or_update_document(::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_op();
   if (insert_or_update_document) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(insert_or_update_document);
     if (message_arena != submessage_arena) {
-      insert_or_update_document = ::google::protobuf::internal::GetOwnedMessage(
+      insert_or_update_document = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, insert_or_update_document, submessage_arena);
     }
     set_has_insert_or_update_document();
-    op_.insert_or_update_document_ = insert_or_update_document;
+    _impl_.op_.insert_or_update_document_ = insert_or_update_document;
   }
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.Operation.insert_or_update_document)
 }
 void Operation::set_allocated_delete_document(::Acoustid::Server::PB::DeleteDocumentOp* delete_document) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_op();
   if (delete_document) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delete_document);
     if (message_arena != submessage_arena) {
-      delete_document = ::google::protobuf::internal::GetOwnedMessage(
+      delete_document = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, delete_document, submessage_arena);
     }
     set_has_delete_document();
-    op_.delete_document_ = delete_document;
+    _impl_.op_.delete_document_ = delete_document;
   }
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.Operation.delete_document)
 }
 void Operation::set_allocated_set_attribute(::Acoustid::Server::PB::SetAttributeOp* set_attribute) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_op();
   if (set_attribute) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_attribute);
     if (message_arena != submessage_arena) {
-      set_attribute = ::google::protobuf::internal::GetOwnedMessage(
+      set_attribute = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, set_attribute, submessage_arena);
     }
     set_has_set_attribute();
-    op_.set_attribute_ = set_attribute;
+    _impl_.op_.set_attribute_ = set_attribute;
   }
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.Operation.set_attribute)
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Operation::kInsertOrUpdateDocumentFieldNumber;
-const int Operation::kDeleteDocumentFieldNumber;
-const int Operation::kSetAttributeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Operation::Operation()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_Operation.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.Operation)
+Operation::Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.Operation)
 }
 Operation::Operation(const Operation& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Operation* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_op();
   switch (from.op_case()) {
     case kInsertOrUpdateDocument: {
-      mutable_insert_or_update_document()->::Acoustid::Server::PB::InsertOrUpdateDocumentOp::MergeFrom(from.insert_or_update_document());
+      _this->_internal_mutable_insert_or_update_document()->::Acoustid::Server::PB::InsertOrUpdateDocumentOp::MergeFrom(
+          from._internal_insert_or_update_document());
       break;
     }
     case kDeleteDocument: {
-      mutable_delete_document()->::Acoustid::Server::PB::DeleteDocumentOp::MergeFrom(from.delete_document());
+      _this->_internal_mutable_delete_document()->::Acoustid::Server::PB::DeleteDocumentOp::MergeFrom(
+          from._internal_delete_document());
       break;
     }
     case kSetAttribute: {
-      mutable_set_attribute()->::Acoustid::Server::PB::SetAttributeOp::MergeFrom(from.set_attribute());
+      _this->_internal_mutable_set_attribute()->::Acoustid::Server::PB::SetAttributeOp::MergeFrom(
+          from._internal_set_attribute());
       break;
     }
     case OP_NOT_SET: {
@@ -2474,287 +2170,238 @@ Operation::Operation(const Operation& from)
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.Operation)
 }
 
-void Operation::SharedCtor() {
+inline void Operation::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_op();
 }
 
 Operation::~Operation() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.Operation)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Operation::SharedDtor() {
+inline void Operation::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_op()) {
     clear_op();
   }
 }
 
 void Operation::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Operation::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Operation& Operation::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_Operation.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Operation::clear_op() {
 // @@protoc_insertion_point(one_of_clear_start:Acoustid.Server.PB.Operation)
   switch (op_case()) {
     case kInsertOrUpdateDocument: {
-      delete op_.insert_or_update_document_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.insert_or_update_document_;
+      }
       break;
     }
     case kDeleteDocument: {
-      delete op_.delete_document_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.delete_document_;
+      }
       break;
     }
     case kSetAttribute: {
-      delete op_.set_attribute_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.op_.set_attribute_;
+      }
       break;
     }
     case OP_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = OP_NOT_SET;
+  _impl_._oneof_case_[0] = OP_NOT_SET;
 }
 
 
 void Operation::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.Operation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_op();
-  _internal_metadata_.Clear();
-}
-
-bool Operation::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.Operation)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Operation::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_insert_or_update_document()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_insert_or_update_document(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_delete_document()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delete_document(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_set_attribute()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_attribute(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.Operation)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.Operation)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Operation::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.Operation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* Operation::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.Operation)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
-  if (has_insert_or_update_document()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_insert_or_update_document(), output);
+  if (_internal_has_insert_or_update_document()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::insert_or_update_document(this),
+        _Internal::insert_or_update_document(this).GetCachedSize(), target, stream);
   }
 
   // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
-  if (has_delete_document()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_delete_document(), output);
+  if (_internal_has_delete_document()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::delete_document(this),
+        _Internal::delete_document(this).GetCachedSize(), target, stream);
   }
 
   // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
-  if (has_set_attribute()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_set_attribute(), output);
+  if (_internal_has_set_attribute()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::set_attribute(this),
+        _Internal::set_attribute(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.Operation)
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.Operation)
+  return target;
 }
 
-::google::protobuf::uint8* Operation::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.Operation)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+size_t Operation::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.Operation)
+  size_t total_size = 0;
 
-  // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
-  if (has_insert_or_update_document()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_insert_or_update_document(), deterministic, target);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
-  if (has_delete_document()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_delete_document(), deterministic, target);
-  }
-
-  // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
-  if (has_set_attribute()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_set_attribute(), deterministic, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.Operation)
-  return target;
-}
-
-size_t Operation::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.Operation)
-  size_t total_size = 0;
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
   switch (op_case()) {
     // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
     case kInsertOrUpdateDocument: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *op_.insert_or_update_document_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.insert_or_update_document_);
       break;
     }
     // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
     case kDeleteDocument: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *op_.delete_document_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.delete_document_);
       break;
     }
     // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
     case kSetAttribute: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *op_.set_attribute_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.op_.set_attribute_);
       break;
     }
     case OP_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Operation::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.Operation)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Operation* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Operation>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.Operation)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.Operation)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Operation::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Operation::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Operation::GetClassData() const { return &_class_data_; }
 
-void Operation::MergeFrom(const Operation& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.Operation)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void Operation::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Operation*>(&to_msg);
+  auto& from = static_cast<const Operation&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.Operation)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.op_case()) {
     case kInsertOrUpdateDocument: {
-      mutable_insert_or_update_document()->::Acoustid::Server::PB::InsertOrUpdateDocumentOp::MergeFrom(from.insert_or_update_document());
+      _this->_internal_mutable_insert_or_update_document()->::Acoustid::Server::PB::InsertOrUpdateDocumentOp::MergeFrom(
+          from._internal_insert_or_update_document());
       break;
     }
     case kDeleteDocument: {
-      mutable_delete_document()->::Acoustid::Server::PB::DeleteDocumentOp::MergeFrom(from.delete_document());
+      _this->_internal_mutable_delete_document()->::Acoustid::Server::PB::DeleteDocumentOp::MergeFrom(
+          from._internal_delete_document());
       break;
     }
     case kSetAttribute: {
-      mutable_set_attribute()->::Acoustid::Server::PB::SetAttributeOp::MergeFrom(from.set_attribute());
+      _this->_internal_mutable_set_attribute()->::Acoustid::Server::PB::SetAttributeOp::MergeFrom(
+          from._internal_set_attribute());
       break;
     }
     case OP_NOT_SET: {
       break;
     }
   }
-}
-
-void Operation::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.Operation)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Operation::CopyFrom(const Operation& from) {
@@ -2768,208 +2415,175 @@ bool Operation::IsInitialized() const {
   return true;
 }
 
-void Operation::Swap(Operation* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Operation::InternalSwap(Operation* other) {
   using std::swap;
-  swap(op_, other->op_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.op_, other->_impl_.op_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata Operation::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Operation::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void UpdateRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UpdateRequest::kIndexNameFieldNumber;
-const int UpdateRequest::kOpsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UpdateRequest::_Internal {
+ public:
+};
 
-UpdateRequest::UpdateRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_UpdateRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.UpdateRequest)
+UpdateRequest::UpdateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.UpdateRequest)
 }
 UpdateRequest::UpdateRequest(const UpdateRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      ops_(from.ops_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.index_name().size() > 0) {
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){from._impl_.ops_}
+    , decltype(_impl_.index_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_index_name().empty()) {
+    _this->_impl_.index_name_.Set(from._internal_index_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.UpdateRequest)
 }
 
-void UpdateRequest::SharedCtor() {
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void UpdateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ops_){arena}
+    , decltype(_impl_.index_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 UpdateRequest::~UpdateRequest() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.UpdateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UpdateRequest::SharedDtor() {
-  index_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void UpdateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ops_.~RepeatedPtrField();
+  _impl_.index_name_.Destroy();
 }
 
 void UpdateRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* UpdateRequest::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UpdateRequest& UpdateRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_UpdateRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void UpdateRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.UpdateRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ops_.Clear();
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool UpdateRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.UpdateRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.ops_.Clear();
+  _impl_.index_name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string index_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_index_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->index_name().data(), static_cast<int>(this->index_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.UpdateRequest.index_name"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_index_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.UpdateRequest.index_name"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .Acoustid.Server.PB.Operation ops = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_ops()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_ops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.UpdateRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.UpdateRequest)
-  return false;
-#undef DO_
-}
-
-void UpdateRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.UpdateRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.UpdateRequest.index_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->index_name(), output);
-  }
-
-  // repeated .Acoustid.Server.PB.Operation ops = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->ops_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->ops(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.UpdateRequest)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* UpdateRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* UpdateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.UpdateRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_index_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_index_name().data(), static_cast<int>(this->_internal_index_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "Acoustid.Server.PB.UpdateRequest.index_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->index_name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_index_name(), target);
   }
 
   // repeated .Acoustid.Server.PB.Operation ops = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->ops_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->ops(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_ops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_ops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.UpdateRequest)
   return target;
@@ -2979,68 +2593,47 @@ size_t UpdateRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.UpdateRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .Acoustid.Server.PB.Operation ops = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->ops_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->ops(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_ops_size();
+  for (const auto& msg : this->_impl_.ops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string index_name = 1;
-  if (this->index_name().size() > 0) {
+  if (!this->_internal_index_name().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->index_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_index_name());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.UpdateRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UpdateRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.UpdateRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.UpdateRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateRequest::GetClassData() const { return &_class_data_; }
 
-void UpdateRequest::MergeFrom(const UpdateRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.UpdateRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  ops_.MergeFrom(from.ops_);
-  if (from.index_name().size() > 0) {
+void UpdateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateRequest*>(&to_msg);
+  auto& from = static_cast<const UpdateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.UpdateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
+  _this->_impl_.ops_.MergeFrom(from._impl_.ops_);
+  if (!from._internal_index_name().empty()) {
+    _this->_internal_set_index_name(from._internal_index_name());
   }
-}
-
-void UpdateRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.UpdateRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void UpdateRequest::CopyFrom(const UpdateRequest& from) {
@@ -3054,370 +2647,201 @@ bool UpdateRequest::IsInitialized() const {
   return true;
 }
 
-void UpdateRequest::Swap(UpdateRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void UpdateRequest::InternalSwap(UpdateRequest* other) {
   using std::swap;
-  CastToBase(&ops_)->InternalSwap(CastToBase(&other->ops_));
-  index_name_.Swap(&other->index_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ops_.InternalSwap(&other->_impl_.ops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.index_name_, lhs_arena,
+      &other->_impl_.index_name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata UpdateRequest::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void UpdateResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class UpdateResponse::_Internal {
+ public:
+};
 
-UpdateResponse::UpdateResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_UpdateResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.UpdateResponse)
+UpdateResponse::UpdateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.UpdateResponse)
 }
 UpdateResponse::UpdateResponse(const UpdateResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  UpdateResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.UpdateResponse)
 }
 
-void UpdateResponse::SharedCtor() {
-}
-
-UpdateResponse::~UpdateResponse() {
-  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.UpdateResponse)
-  SharedDtor();
-}
-
-void UpdateResponse::SharedDtor() {
-}
-
-void UpdateResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* UpdateResponse::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const UpdateResponse& UpdateResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_UpdateResponse.base);
-  return *internal_default_instance();
-}
-
-
-void UpdateResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.UpdateResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _internal_metadata_.Clear();
-}
-
-bool UpdateResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.UpdateResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, _internal_metadata_.mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.UpdateResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.UpdateResponse)
-  return false;
-#undef DO_
-}
-
-void UpdateResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.UpdateResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.UpdateResponse)
-}
 
-::google::protobuf::uint8* UpdateResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.UpdateResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.UpdateResponse)
-  return target;
-}
 
-size_t UpdateResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.UpdateResponse)
-  size_t total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateResponse::GetClassData() const { return &_class_data_; }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void UpdateResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.UpdateResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const UpdateResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.UpdateResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.UpdateResponse)
-    MergeFrom(*source);
-  }
-}
-
-void UpdateResponse::MergeFrom(const UpdateResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.UpdateResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-}
 
-void UpdateResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.UpdateResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void UpdateResponse::CopyFrom(const UpdateResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.UpdateResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool UpdateResponse::IsInitialized() const {
-  return true;
-}
 
-void UpdateResponse::Swap(UpdateResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UpdateResponse::InternalSwap(UpdateResponse* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
 
-::google::protobuf::Metadata UpdateResponse::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void SearchResult::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SearchResult::kDocIdFieldNumber;
-const int SearchResult::kScoreFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SearchResult::_Internal {
+ public:
+};
 
-SearchResult::SearchResult()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_SearchResult.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.SearchResult)
+SearchResult::SearchResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.SearchResult)
 }
 SearchResult::SearchResult(const SearchResult& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&doc_id_, &from.doc_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&score_) -
-    reinterpret_cast<char*>(&doc_id_)) + sizeof(score_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.doc_id_){}
+    , decltype(_impl_.score_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.doc_id_, &from._impl_.doc_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.score_) -
+    reinterpret_cast<char*>(&_impl_.doc_id_)) + sizeof(_impl_.score_));
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SearchResult)
 }
 
-void SearchResult::SharedCtor() {
-  ::memset(&doc_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&score_) -
-      reinterpret_cast<char*>(&doc_id_)) + sizeof(score_));
+inline void SearchResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.doc_id_){0u}
+    , decltype(_impl_.score_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SearchResult::~SearchResult() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SearchResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SearchResult::SharedDtor() {
+inline void SearchResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SearchResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SearchResult::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SearchResult& SearchResult::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_SearchResult.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SearchResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SearchResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&doc_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&score_) -
-      reinterpret_cast<char*>(&doc_id_)) + sizeof(score_));
-  _internal_metadata_.Clear();
-}
-
-bool SearchResult::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.SearchResult)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.doc_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.score_) -
+      reinterpret_cast<char*>(&_impl_.doc_id_)) + sizeof(_impl_.score_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 doc_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &doc_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.doc_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float score = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &score_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.SearchResult)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.SearchResult)
-  return false;
-#undef DO_
-}
-
-void SearchResult::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.SearchResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->doc_id(), output);
-  }
-
-  // float score = 2;
-  if (this->score() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->score(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.SearchResult)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SearchResult::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SearchResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchResult)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->doc_id(), target);
+  if (this->_internal_doc_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_doc_id(), target);
   }
 
   // float score = 2;
-  if (this->score() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->score(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = this->_internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_score(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SearchResult)
   return target;
@@ -3427,63 +2851,53 @@ size_t SearchResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SearchResult)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 doc_id = 1;
-  if (this->doc_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->doc_id());
+  if (this->_internal_doc_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_doc_id());
   }
 
   // float score = 2;
-  if (this->score() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = this->_internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SearchResult::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.SearchResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SearchResult* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SearchResult>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.SearchResult)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.SearchResult)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchResult::GetClassData() const { return &_class_data_; }
 
-void SearchResult::MergeFrom(const SearchResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void SearchResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchResult*>(&to_msg);
+  auto& from = static_cast<const SearchResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.doc_id() != 0) {
-    set_doc_id(from.doc_id());
+  if (from._internal_doc_id() != 0) {
+    _this->_internal_set_doc_id(from._internal_doc_id());
   }
-  if (from.score() != 0) {
-    set_score(from.score());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_score = from._internal_score();
+  uint32_t raw_score;
+  memcpy(&raw_score, &tmp_score, sizeof(tmp_score));
+  if (raw_score != 0) {
+    _this->_internal_set_score(from._internal_score());
   }
-}
-
-void SearchResult::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.SearchResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SearchResult::CopyFrom(const SearchResult& from) {
@@ -3497,336 +2911,734 @@ bool SearchResult::IsInitialized() const {
   return true;
 }
 
-void SearchResult::Swap(SearchResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SearchResult::InternalSwap(SearchResult* other) {
   using std::swap;
-  swap(doc_id_, other->doc_id_);
-  swap(score_, other->score_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchResult, _impl_.score_)
+      + sizeof(SearchResult::_impl_.score_)
+      - PROTOBUF_FIELD_OFFSET(SearchResult, _impl_.doc_id_)>(
+          reinterpret_cast<char*>(&_impl_.doc_id_),
+          reinterpret_cast<char*>(&other->_impl_.doc_id_));
 }
 
-::google::protobuf::Metadata SearchResult::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SearchResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void SearchRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SearchRequest::kIndexNameFieldNumber;
-const int SearchRequest::kTermsFieldNumber;
-const int SearchRequest::kMaxResultsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SearchRequest::SearchRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_SearchRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.SearchRequest)
-}
-SearchRequest::SearchRequest(const SearchRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      terms_(from.terms_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.index_name().size() > 0) {
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
-  }
-  max_results_ = from.max_results_;
-  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SearchRequest)
-}
+class DocumentFilter::_Internal {
+ public:
+};
 
-void SearchRequest::SharedCtor() {
-  index_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  max_results_ = 0;
+DocumentFilter::DocumentFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.DocumentFilter)
+}
+DocumentFilter::DocumentFilter(const DocumentFilter& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DocumentFilter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bitmap_){}
+    , decltype(_impl_.min_id_){}
+    , decltype(_impl_.max_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.bitmap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bitmap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_bitmap().empty()) {
+    _this->_impl_.bitmap_.Set(from._internal_bitmap(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.min_id_, &from._impl_.min_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_id_) -
+    reinterpret_cast<char*>(&_impl_.min_id_)) + sizeof(_impl_.max_id_));
+  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.DocumentFilter)
+}
+
+inline void DocumentFilter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bitmap_){}
+    , decltype(_impl_.min_id_){0u}
+    , decltype(_impl_.max_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.bitmap_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bitmap_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SearchRequest::~SearchRequest() {
-  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SearchRequest)
+DocumentFilter::~DocumentFilter() {
+  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.DocumentFilter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SearchRequest::SharedDtor() {
-  index_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void DocumentFilter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bitmap_.Destroy();
 }
 
-void SearchRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SearchRequest::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SearchRequest& SearchRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_SearchRequest.base);
-  return *internal_default_instance();
+void DocumentFilter::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void SearchRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SearchRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void DocumentFilter::Clear() {
+// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.DocumentFilter)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  terms_.Clear();
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  max_results_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool SearchRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.SearchRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string index_name = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_index_name()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->index_name().data(), static_cast<int>(this->index_name().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "Acoustid.Server.PB.SearchRequest.index_name"));
-        } else {
+  _impl_.bitmap_.ClearToEmpty();
+  ::memset(&_impl_.min_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_id_) -
+      reinterpret_cast<char*>(&_impl_.min_id_)) + sizeof(_impl_.max_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DocumentFilter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 min_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.min_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated uint32 terms = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_terms())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_terms())));
-        } else {
+        continue;
+      // uint32 max_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 max_results = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &max_results_)));
-        } else {
+        continue;
+      // bytes bitmap = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_bitmap();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.SearchRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.SearchRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SearchRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.SearchRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* DocumentFilter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.DocumentFilter)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.SearchRequest.index_name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->index_name(), output);
+  // uint32 min_id = 1;
+  if (this->_internal_min_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_min_id(), target);
   }
 
-  // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _terms_cached_byte_size_));
-  }
-  for (int i = 0, n = this->terms_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->terms(i), output);
+  // uint32 max_id = 2;
+  if (this->_internal_max_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_max_id(), target);
   }
 
-  // int32 max_results = 3;
-  if (this->max_results() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->max_results(), output);
+  // bytes bitmap = 3;
+  if (!this->_internal_bitmap().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_bitmap(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.SearchRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.DocumentFilter)
+  return target;
 }
 
-::google::protobuf::uint8* SearchRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+size_t DocumentFilter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.DocumentFilter)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->index_name().data(), static_cast<int>(this->index_name().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "Acoustid.Server.PB.SearchRequest.index_name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->index_name(), target);
+  // bytes bitmap = 3;
+  if (!this->_internal_bitmap().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_bitmap());
   }
 
-  // repeated uint32 terms = 2;
-  if (this->terms_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _terms_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->terms_, target);
+  // uint32 min_id = 1;
+  if (this->_internal_min_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min_id());
   }
 
-  // int32 max_results = 3;
-  if (this->max_results() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->max_results(), target);
+  // uint32 max_id = 2;
+  if (this->_internal_max_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_id());
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SearchRequest)
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-size_t SearchRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SearchRequest)
-  size_t total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DocumentFilter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DocumentFilter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DocumentFilter::GetClassData() const { return &_class_data_; }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated uint32 terms = 2;
-  {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->terms_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _terms_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
-  }
 
-  // string index_name = 1;
-  if (this->index_name().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->index_name());
-  }
+void DocumentFilter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DocumentFilter*>(&to_msg);
+  auto& from = static_cast<const DocumentFilter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.DocumentFilter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // int32 max_results = 3;
-  if (this->max_results() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->max_results());
+  if (!from._internal_bitmap().empty()) {
+    _this->_internal_set_bitmap(from._internal_bitmap());
   }
-
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  if (from._internal_min_id() != 0) {
+    _this->_internal_set_min_id(from._internal_min_id());
+  }
+  if (from._internal_max_id() != 0) {
+    _this->_internal_set_max_id(from._internal_max_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SearchRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.SearchRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SearchRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SearchRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.SearchRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.SearchRequest)
-    MergeFrom(*source);
-  }
+void DocumentFilter::CopyFrom(const DocumentFilter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.DocumentFilter)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-void SearchRequest::MergeFrom(const SearchRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+bool DocumentFilter::IsInitialized() const {
+  return true;
+}
+
+void DocumentFilter::InternalSwap(DocumentFilter* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bitmap_, lhs_arena,
+      &other->_impl_.bitmap_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DocumentFilter, _impl_.max_id_)
+      + sizeof(DocumentFilter::_impl_.max_id_)
+      - PROTOBUF_FIELD_OFFSET(DocumentFilter, _impl_.min_id_)>(
+          reinterpret_cast<char*>(&_impl_.min_id_),
+          reinterpret_cast<char*>(&other->_impl_.min_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DocumentFilter::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[11]);
+}
+
+// ===================================================================
+
+class SearchRequest::_Internal {
+ public:
+  static const ::Acoustid::Server::PB::DocumentFilter& filter(const SearchRequest* msg);
+};
+
+const ::Acoustid::Server::PB::DocumentFilter&
+SearchRequest::_Internal::filter(const SearchRequest* msg) {
+  return *msg->_impl_.filter_;
+}
+SearchRequest::SearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.SearchRequest)
+}
+SearchRequest::SearchRequest(const SearchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){from._impl_.terms_}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.index_name_){}
+    , decltype(_impl_.filter_){nullptr}
+    , decltype(_impl_.max_results_){}
+    , decltype(_impl_.bypass_cache_){}
+    , decltype(_impl_.allow_partial_results_){}
+    , decltype(_impl_.sampled_){}
+    , decltype(_impl_.sample_stride_){}
+    , decltype(_impl_.sample_candidates_){}
+    , decltype(_impl_.expand_distance_){}
+    , decltype(_impl_.expand_mask_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_index_name().empty()) {
+    _this->_impl_.index_name_.Set(from._internal_index_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_filter()) {
+    _this->_impl_.filter_ = new ::Acoustid::Server::PB::DocumentFilter(*from._impl_.filter_);
+  }
+  ::memcpy(&_impl_.max_results_, &from._impl_.max_results_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.expand_mask_) -
+    reinterpret_cast<char*>(&_impl_.max_results_)) + sizeof(_impl_.expand_mask_));
+  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SearchRequest)
+}
+
+inline void SearchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){arena}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.index_name_){}
+    , decltype(_impl_.filter_){nullptr}
+    , decltype(_impl_.max_results_){0}
+    , decltype(_impl_.bypass_cache_){false}
+    , decltype(_impl_.allow_partial_results_){false}
+    , decltype(_impl_.sampled_){false}
+    , decltype(_impl_.sample_stride_){0u}
+    , decltype(_impl_.sample_candidates_){0u}
+    , decltype(_impl_.expand_distance_){0u}
+    , decltype(_impl_.expand_mask_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SearchRequest::~SearchRequest() {
+  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SearchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SearchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.terms_.~RepeatedField();
+  _impl_.index_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.filter_;
+}
+
+void SearchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SearchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SearchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.terms_.Clear();
+  _impl_.index_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.filter_ != nullptr) {
+    delete _impl_.filter_;
+  }
+  _impl_.filter_ = nullptr;
+  ::memset(&_impl_.max_results_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.expand_mask_) -
+      reinterpret_cast<char*>(&_impl_.max_results_)) + sizeof(_impl_.expand_mask_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string index_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_index_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.SearchRequest.index_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 terms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_terms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_terms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_results = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool bypass_cache = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bypass_cache_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_partial_results = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.allow_partial_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool sampled = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.sampled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sample_stride = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.sample_stride_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 sample_candidates = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.sample_candidates_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 expand_distance = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.expand_distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed32 expand_mask = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _impl_.expand_mask_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Acoustid.Server.PB.DocumentFilter filter = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  terms_.MergeFrom(from.terms_);
-  if (from.index_name().size() > 0) {
+  // string index_name = 1;
+  if (!this->_internal_index_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_index_name().data(), static_cast<int>(this->_internal_index_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Acoustid.Server.PB.SearchRequest.index_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_index_name(), target);
+  }
+
+  // repeated uint32 terms = 2;
+  {
+    int byte_size = _impl_._terms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_terms(), byte_size, target);
+    }
+  }
+
+  // int32 max_results = 3;
+  if (this->_internal_max_results() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_max_results(), target);
+  }
+
+  // bool bypass_cache = 4;
+  if (this->_internal_bypass_cache() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_bypass_cache(), target);
+  }
+
+  // bool allow_partial_results = 5;
+  if (this->_internal_allow_partial_results() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_allow_partial_results(), target);
+  }
+
+  // bool sampled = 6;
+  if (this->_internal_sampled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_sampled(), target);
+  }
+
+  // uint32 sample_stride = 7;
+  if (this->_internal_sample_stride() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_sample_stride(), target);
+  }
+
+  // uint32 sample_candidates = 8;
+  if (this->_internal_sample_candidates() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_sample_candidates(), target);
+  }
+
+  // uint32 expand_distance = 9;
+  if (this->_internal_expand_distance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_expand_distance(), target);
+  }
 
-    index_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.index_name_);
+  // fixed32 expand_mask = 10;
+  if (this->_internal_expand_mask() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(10, this->_internal_expand_mask(), target);
   }
-  if (from.max_results() != 0) {
-    set_max_results(from.max_results());
+
+  // .Acoustid.Server.PB.DocumentFilter filter = 11;
+  if (this->_internal_has_filter()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::filter(this),
+        _Internal::filter(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SearchRequest)
+  return target;
 }
 
-void SearchRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.SearchRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+size_t SearchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SearchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 terms = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.terms_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._terms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string index_name = 1;
+  if (!this->_internal_index_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_index_name());
+  }
+
+  // .Acoustid.Server.PB.DocumentFilter filter = 11;
+  if (this->_internal_has_filter()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.filter_);
+  }
+
+  // int32 max_results = 3;
+  if (this->_internal_max_results() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_results());
+  }
+
+  // bool bypass_cache = 4;
+  if (this->_internal_bypass_cache() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool allow_partial_results = 5;
+  if (this->_internal_allow_partial_results() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool sampled = 6;
+  if (this->_internal_sampled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 sample_stride = 7;
+  if (this->_internal_sample_stride() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sample_stride());
+  }
+
+  // uint32 sample_candidates = 8;
+  if (this->_internal_sample_candidates() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sample_candidates());
+  }
+
+  // uint32 expand_distance = 9;
+  if (this->_internal_expand_distance() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_expand_distance());
+  }
+
+  // fixed32 expand_mask = 10;
+  if (this->_internal_expand_mask() != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchRequest::GetClassData() const { return &_class_data_; }
+
+
+void SearchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchRequest*>(&to_msg);
+  auto& from = static_cast<const SearchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.terms_.MergeFrom(from._impl_.terms_);
+  if (!from._internal_index_name().empty()) {
+    _this->_internal_set_index_name(from._internal_index_name());
+  }
+  if (from._internal_has_filter()) {
+    _this->_internal_mutable_filter()->::Acoustid::Server::PB::DocumentFilter::MergeFrom(
+        from._internal_filter());
+  }
+  if (from._internal_max_results() != 0) {
+    _this->_internal_set_max_results(from._internal_max_results());
+  }
+  if (from._internal_bypass_cache() != 0) {
+    _this->_internal_set_bypass_cache(from._internal_bypass_cache());
+  }
+  if (from._internal_allow_partial_results() != 0) {
+    _this->_internal_set_allow_partial_results(from._internal_allow_partial_results());
+  }
+  if (from._internal_sampled() != 0) {
+    _this->_internal_set_sampled(from._internal_sampled());
+  }
+  if (from._internal_sample_stride() != 0) {
+    _this->_internal_set_sample_stride(from._internal_sample_stride());
+  }
+  if (from._internal_sample_candidates() != 0) {
+    _this->_internal_set_sample_candidates(from._internal_sample_candidates());
+  }
+  if (from._internal_expand_distance() != 0) {
+    _this->_internal_set_expand_distance(from._internal_expand_distance());
+  }
+  if (from._internal_expand_mask() != 0) {
+    _this->_internal_set_expand_mask(from._internal_expand_mask());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SearchRequest::CopyFrom(const SearchRequest& from) {
@@ -3840,165 +3652,168 @@ bool SearchRequest::IsInitialized() const {
   return true;
 }
 
-void SearchRequest::Swap(SearchRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SearchRequest::InternalSwap(SearchRequest* other) {
   using std::swap;
-  terms_.InternalSwap(&other->terms_);
-  index_name_.Swap(&other->index_name_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(max_results_, other->max_results_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata SearchRequest::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.terms_.InternalSwap(&other->_impl_.terms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.index_name_, lhs_arena,
+      &other->_impl_.index_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchRequest, _impl_.expand_mask_)
+      + sizeof(SearchRequest::_impl_.expand_mask_)
+      - PROTOBUF_FIELD_OFFSET(SearchRequest, _impl_.filter_)>(
+          reinterpret_cast<char*>(&_impl_.filter_),
+          reinterpret_cast<char*>(&other->_impl_.filter_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void SearchResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SearchResponse::kResultsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SearchResponse::_Internal {
+ public:
+};
 
-SearchResponse::SearchResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_index_2eproto::scc_info_SearchResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:Acoustid.Server.PB.SearchResponse)
+SearchResponse::SearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.SearchResponse)
 }
 SearchResponse::SearchResponse(const SearchResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      results_(from.results_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.partial_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.partial_ = from._impl_.partial_;
   // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SearchResponse)
 }
 
-void SearchResponse::SharedCtor() {
+inline void SearchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.partial_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SearchResponse::~SearchResponse() {
   // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SearchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SearchResponse::SharedDtor() {
+inline void SearchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
 }
 
 void SearchResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* SearchResponse::descriptor() {
-  ::protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SearchResponse& SearchResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_index_2eproto::scc_info_SearchResponse.base);
-  return *internal_default_instance();
-}
-
 
 void SearchResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SearchResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  results_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.results_.Clear();
+  _impl_.partial_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SearchResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:Acoustid.Server.PB.SearchResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SearchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .Acoustid.Server.PB.SearchResult results = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_results()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // bool partial = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.partial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:Acoustid.Server.PB.SearchResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:Acoustid.Server.PB.SearchResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SearchResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:Acoustid.Server.PB.SearchResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SearchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .Acoustid.Server.PB.SearchResult results = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->results(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:Acoustid.Server.PB.SearchResponse)
-}
 
-::google::protobuf::uint8* SearchResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .Acoustid.Server.PB.SearchResult results = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->results(static_cast<int>(i)), deterministic, target);
+  // bool partial = 2;
+  if (this->_internal_partial() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_partial(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SearchResponse)
   return target;
@@ -4008,132 +3823,874 @@ size_t SearchResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SearchResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Acoustid.Server.PB.SearchResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // repeated .Acoustid.Server.PB.SearchResult results = 1;
+
+  // bool partial = 2;
+  if (this->_internal_partial() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchResponse::GetClassData() const { return &_class_data_; }
+
+
+void SearchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchResponse*>(&to_msg);
+  auto& from = static_cast<const SearchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_partial() != 0) {
+    _this->_internal_set_partial(from._internal_partial());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SearchResponse::CopyFrom(const SearchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.SearchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SearchResponse::IsInitialized() const {
+  return true;
+}
+
+void SearchResponse::InternalSwap(SearchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  swap(_impl_.partial_, other->_impl_.partial_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[13]);
+}
+
+// ===================================================================
+
+class SearchQuery::_Internal {
+ public:
+};
+
+SearchQuery::SearchQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.SearchQuery)
+}
+SearchQuery::SearchQuery(const SearchQuery& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchQuery* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){from._impl_.terms_}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.max_results_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.max_results_ = from._impl_.max_results_;
+  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.SearchQuery)
+}
+
+inline void SearchQuery::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.terms_){arena}
+    , /*decltype(_impl_._terms_cached_byte_size_)*/{0}
+    , decltype(_impl_.max_results_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SearchQuery::~SearchQuery() {
+  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.SearchQuery)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SearchQuery::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.terms_.~RepeatedField();
+}
+
+void SearchQuery::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SearchQuery::Clear() {
+// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.SearchQuery)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.terms_.Clear();
+  _impl_.max_results_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchQuery::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 terms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_terms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_terms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchQuery::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.SearchQuery)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 terms = 1;
   {
-    unsigned int count = static_cast<unsigned int>(this->results_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->results(static_cast<int>(i)));
+    int byte_size = _impl_._terms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_terms(), byte_size, target);
     }
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  // int32 max_results = 2;
+  if (this->_internal_max_results() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_results(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.SearchQuery)
+  return target;
 }
 
-void SearchResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Acoustid.Server.PB.SearchResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SearchResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SearchResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Acoustid.Server.PB.SearchResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Acoustid.Server.PB.SearchResponse)
-    MergeFrom(*source);
+size_t SearchQuery::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.SearchQuery)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 terms = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.terms_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._terms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int32 max_results = 2;
+  if (this->_internal_max_results() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_results());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SearchResponse::MergeFrom(const SearchResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchQuery::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchQuery::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchQuery::GetClassData() const { return &_class_data_; }
+
+
+void SearchQuery::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchQuery*>(&to_msg);
+  auto& from = static_cast<const SearchQuery&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.SearchQuery)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  results_.MergeFrom(from.results_);
+  _this->_impl_.terms_.MergeFrom(from._impl_.terms_);
+  if (from._internal_max_results() != 0) {
+    _this->_internal_set_max_results(from._internal_max_results());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SearchResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Acoustid.Server.PB.SearchResponse)
+void SearchQuery::CopyFrom(const SearchQuery& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.SearchQuery)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SearchResponse::CopyFrom(const SearchResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.SearchResponse)
+bool SearchQuery::IsInitialized() const {
+  return true;
+}
+
+void SearchQuery::InternalSwap(SearchQuery* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.terms_.InternalSwap(&other->_impl_.terms_);
+  swap(_impl_.max_results_, other->_impl_.max_results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchQuery::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[14]);
+}
+
+// ===================================================================
+
+class BatchSearchRequest::_Internal {
+ public:
+};
+
+BatchSearchRequest::BatchSearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.BatchSearchRequest)
+}
+BatchSearchRequest::BatchSearchRequest(const BatchSearchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchSearchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queries_){from._impl_.queries_}
+    , decltype(_impl_.index_name_){}
+    , decltype(_impl_.allow_partial_results_){}
+    , decltype(_impl_.interleaved_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_index_name().empty()) {
+    _this->_impl_.index_name_.Set(from._internal_index_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.allow_partial_results_, &from._impl_.allow_partial_results_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.interleaved_) -
+    reinterpret_cast<char*>(&_impl_.allow_partial_results_)) + sizeof(_impl_.interleaved_));
+  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.BatchSearchRequest)
+}
+
+inline void BatchSearchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.queries_){arena}
+    , decltype(_impl_.index_name_){}
+    , decltype(_impl_.allow_partial_results_){false}
+    , decltype(_impl_.interleaved_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.index_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchSearchRequest::~BatchSearchRequest() {
+  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.BatchSearchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchSearchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.queries_.~RepeatedPtrField();
+  _impl_.index_name_.Destroy();
+}
+
+void BatchSearchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchSearchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.BatchSearchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.queries_.Clear();
+  _impl_.index_name_.ClearToEmpty();
+  ::memset(&_impl_.allow_partial_results_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.interleaved_) -
+      reinterpret_cast<char*>(&_impl_.allow_partial_results_)) + sizeof(_impl_.interleaved_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchSearchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string index_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_index_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Acoustid.Server.PB.BatchSearchRequest.index_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Acoustid.Server.PB.SearchQuery queries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_partial_results = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.allow_partial_results_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool interleaved = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.interleaved_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchSearchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.BatchSearchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string index_name = 1;
+  if (!this->_internal_index_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_index_name().data(), static_cast<int>(this->_internal_index_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Acoustid.Server.PB.BatchSearchRequest.index_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_index_name(), target);
+  }
+
+  // repeated .Acoustid.Server.PB.SearchQuery queries = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool allow_partial_results = 3;
+  if (this->_internal_allow_partial_results() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_allow_partial_results(), target);
+  }
+
+  // bool interleaved = 4;
+  if (this->_internal_interleaved() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_interleaved(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.BatchSearchRequest)
+  return target;
+}
+
+size_t BatchSearchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.BatchSearchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Acoustid.Server.PB.SearchQuery queries = 2;
+  total_size += 1UL * this->_internal_queries_size();
+  for (const auto& msg : this->_impl_.queries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string index_name = 1;
+  if (!this->_internal_index_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_index_name());
+  }
+
+  // bool allow_partial_results = 3;
+  if (this->_internal_allow_partial_results() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool interleaved = 4;
+  if (this->_internal_interleaved() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchSearchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchSearchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchSearchRequest::GetClassData() const { return &_class_data_; }
+
+
+void BatchSearchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchSearchRequest*>(&to_msg);
+  auto& from = static_cast<const BatchSearchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.BatchSearchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.queries_.MergeFrom(from._impl_.queries_);
+  if (!from._internal_index_name().empty()) {
+    _this->_internal_set_index_name(from._internal_index_name());
+  }
+  if (from._internal_allow_partial_results() != 0) {
+    _this->_internal_set_allow_partial_results(from._internal_allow_partial_results());
+  }
+  if (from._internal_interleaved() != 0) {
+    _this->_internal_set_interleaved(from._internal_interleaved());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchSearchRequest::CopyFrom(const BatchSearchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.BatchSearchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SearchResponse::IsInitialized() const {
+bool BatchSearchRequest::IsInitialized() const {
   return true;
 }
 
-void SearchResponse::Swap(SearchResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void SearchResponse::InternalSwap(SearchResponse* other) {
+void BatchSearchRequest::InternalSwap(BatchSearchRequest* other) {
   using std::swap;
-  CastToBase(&results_)->InternalSwap(CastToBase(&other->results_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.queries_.InternalSwap(&other->_impl_.queries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.index_name_, lhs_arena,
+      &other->_impl_.index_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchSearchRequest, _impl_.interleaved_)
+      + sizeof(BatchSearchRequest::_impl_.interleaved_)
+      - PROTOBUF_FIELD_OFFSET(BatchSearchRequest, _impl_.allow_partial_results_)>(
+          reinterpret_cast<char*>(&_impl_.allow_partial_results_),
+          reinterpret_cast<char*>(&other->_impl_.allow_partial_results_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchSearchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[15]);
+}
+
+// ===================================================================
+
+class BatchSearchResponse::_Internal {
+ public:
+};
+
+BatchSearchResponse::BatchSearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Acoustid.Server.PB.BatchSearchResponse)
+}
+BatchSearchResponse::BatchSearchResponse(const BatchSearchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchSearchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){from._impl_.responses_}
+    , decltype(_impl_.partial_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.partial_ = from._impl_.partial_;
+  // @@protoc_insertion_point(copy_constructor:Acoustid.Server.PB.BatchSearchResponse)
+}
+
+inline void BatchSearchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){arena}
+    , decltype(_impl_.partial_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BatchSearchResponse::~BatchSearchResponse() {
+  // @@protoc_insertion_point(destructor:Acoustid.Server.PB.BatchSearchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchSearchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.responses_.~RepeatedPtrField();
+}
+
+void BatchSearchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchSearchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:Acoustid.Server.PB.BatchSearchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.responses_.Clear();
+  _impl_.partial_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchSearchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Acoustid.Server.PB.SearchResponse responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool partial = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.partial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchSearchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Acoustid.Server.PB.BatchSearchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Acoustid.Server.PB.SearchResponse responses = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool partial = 2;
+  if (this->_internal_partial() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_partial(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Acoustid.Server.PB.BatchSearchResponse)
+  return target;
+}
+
+size_t BatchSearchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Acoustid.Server.PB.BatchSearchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Acoustid.Server.PB.SearchResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->_impl_.responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bool partial = 2;
+  if (this->_internal_partial() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchSearchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchSearchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchSearchResponse::GetClassData() const { return &_class_data_; }
+
+
+void BatchSearchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchSearchResponse*>(&to_msg);
+  auto& from = static_cast<const BatchSearchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Acoustid.Server.PB.BatchSearchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  if (from._internal_partial() != 0) {
+    _this->_internal_set_partial(from._internal_partial());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchSearchResponse::CopyFrom(const BatchSearchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Acoustid.Server.PB.BatchSearchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-::google::protobuf::Metadata SearchResponse::GetMetadata() const {
-  protobuf_index_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_index_2eproto::file_level_metadata[kIndexInFileMessages];
+bool BatchSearchResponse::IsInitialized() const {
+  return true;
 }
 
+void BatchSearchResponse::InternalSwap(BatchSearchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+  swap(_impl_.partial_, other->_impl_.partial_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchSearchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_index_2eproto_getter, &descriptor_table_index_2eproto_once,
+      file_level_metadata_index_2eproto[16]);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace PB
 }  // namespace Server
 }  // namespace Acoustid
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::GetDocumentRequest* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetDocumentRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::GetDocumentRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::GetDocumentRequest*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetDocumentRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::GetDocumentRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::GetDocumentResponse*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetDocumentResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::GetDocumentResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::GetAttributeRequest*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetAttributeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::GetAttributeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::GetAttributeResponse*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetAttributeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::GetAttributeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::InsertOrUpdateDocumentOp*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::GetDocumentResponse* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetDocumentResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::GetDocumentResponse >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::DeleteDocumentOp*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::DeleteDocumentOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::DeleteDocumentOp >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::GetAttributeRequest* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetAttributeRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::GetAttributeRequest >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::SetAttributeOp*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SetAttributeOp >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::SetAttributeOp >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::GetAttributeResponse* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::GetAttributeResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::GetAttributeResponse >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::Operation*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::Operation >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::Operation >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::UpdateRequest*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::UpdateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::UpdateRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::DeleteDocumentOp* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::DeleteDocumentOp >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::DeleteDocumentOp >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::UpdateResponse*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::UpdateResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::UpdateResponse >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::SetAttributeOp* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SetAttributeOp >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::SetAttributeOp >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::SearchResult*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::SearchResult >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::Operation* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::Operation >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::Operation >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::DocumentFilter*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::DocumentFilter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::DocumentFilter >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::UpdateRequest* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::UpdateRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::UpdateRequest >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::SearchRequest*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::SearchRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::UpdateResponse* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::UpdateResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::UpdateResponse >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::SearchResponse*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::SearchResponse >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::SearchResult* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchResult >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::SearchResult >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::SearchQuery*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchQuery >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::SearchQuery >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::SearchRequest* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::SearchRequest >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::BatchSearchRequest*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::BatchSearchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::BatchSearchRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::Acoustid::Server::PB::SearchResponse* Arena::CreateMaybeMessage< ::Acoustid::Server::PB::SearchResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::Acoustid::Server::PB::SearchResponse >(arena);
+template<> PROTOBUF_NOINLINE ::Acoustid::Server::PB::BatchSearchResponse*
+Arena::CreateMaybeMessage< ::Acoustid::Server::PB::BatchSearchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Acoustid::Server::PB::BatchSearchResponse >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,148 +1,175 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: index.proto
 
-#ifndef PROTOBUF_INCLUDED_index_2eproto
-#define PROTOBUF_INCLUDED_index_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_index_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_index_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_index_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_index_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_index_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_index_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_index_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_index_2eproto;
 namespace Acoustid {
 namespace Server {
 namespace PB {
+class BatchSearchRequest;
+struct BatchSearchRequestDefaultTypeInternal;
+extern BatchSearchRequestDefaultTypeInternal _BatchSearchRequest_default_instance_;
+class BatchSearchResponse;
+struct BatchSearchResponseDefaultTypeInternal;
+extern BatchSearchResponseDefaultTypeInternal _BatchSearchResponse_default_instance_;
 class DeleteDocumentOp;
-class DeleteDocumentOpDefaultTypeInternal;
+struct DeleteDocumentOpDefaultTypeInternal;
 extern DeleteDocumentOpDefaultTypeInternal _DeleteDocumentOp_default_instance_;
+class DocumentFilter;
+struct DocumentFilterDefaultTypeInternal;
+extern DocumentFilterDefaultTypeInternal _DocumentFilter_default_instance_;
 class GetAttributeRequest;
-class GetAttributeRequestDefaultTypeInternal;
+struct GetAttributeRequestDefaultTypeInternal;
 extern GetAttributeRequestDefaultTypeInternal _GetAttributeRequest_default_instance_;
 class GetAttributeResponse;
-class GetAttributeResponseDefaultTypeInternal;
+struct GetAttributeResponseDefaultTypeInternal;
 extern GetAttributeResponseDefaultTypeInternal _GetAttributeResponse_default_instance_;
 class GetDocumentRequest;
-class GetDocumentRequestDefaultTypeInternal;
+struct GetDocumentRequestDefaultTypeInternal;
 extern GetDocumentRequestDefaultTypeInternal _GetDocumentRequest_default_instance_;
 class GetDocumentResponse;
-class GetDocumentResponseDefaultTypeInternal;
+struct GetDocumentResponseDefaultTypeInternal;
 extern GetDocumentResponseDefaultTypeInternal _GetDocumentResponse_default_instance_;
 class InsertOrUpdateDocumentOp;
-class InsertOrUpdateDocumentOpDefaultTypeInternal;
+struct InsertOrUpdateDocumentOpDefaultTypeInternal;
 extern InsertOrUpdateDocumentOpDefaultTypeInternal _InsertOrUpdateDocumentOp_default_instance_;
 class Operation;
-class OperationDefaultTypeInternal;
+struct OperationDefaultTypeInternal;
 extern OperationDefaultTypeInternal _Operation_default_instance_;
+class SearchQuery;
+struct SearchQueryDefaultTypeInternal;
+extern SearchQueryDefaultTypeInternal _SearchQuery_default_instance_;
 class SearchRequest;
-class SearchRequestDefaultTypeInternal;
+struct SearchRequestDefaultTypeInternal;
 extern SearchRequestDefaultTypeInternal _SearchRequest_default_instance_;
 class SearchResponse;
-class SearchResponseDefaultTypeInternal;
+struct SearchResponseDefaultTypeInternal;
 extern SearchResponseDefaultTypeInternal _SearchResponse_default_instance_;
 class SearchResult;
-class SearchResultDefaultTypeInternal;
+struct SearchResultDefaultTypeInternal;
 extern SearchResultDefaultTypeInternal _SearchResult_default_instance_;
 class SetAttributeOp;
-class SetAttributeOpDefaultTypeInternal;
+struct SetAttributeOpDefaultTypeInternal;
 extern SetAttributeOpDefaultTypeInternal _SetAttributeOp_default_instance_;
 class UpdateRequest;
-class UpdateRequestDefaultTypeInternal;
+struct UpdateRequestDefaultTypeInternal;
 extern UpdateRequestDefaultTypeInternal _UpdateRequest_default_instance_;
 class UpdateResponse;
-class UpdateResponseDefaultTypeInternal;
+struct UpdateResponseDefaultTypeInternal;
 extern UpdateResponseDefaultTypeInternal _UpdateResponse_default_instance_;
 }  // namespace PB
 }  // namespace Server
 }  // namespace Acoustid
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::Acoustid::Server::PB::BatchSearchRequest* Arena::CreateMaybeMessage<::Acoustid::Server::PB::BatchSearchRequest>(Arena*);
+template<> ::Acoustid::Server::PB::BatchSearchResponse* Arena::CreateMaybeMessage<::Acoustid::Server::PB::BatchSearchResponse>(Arena*);
 template<> ::Acoustid::Server::PB::DeleteDocumentOp* Arena::CreateMaybeMessage<::Acoustid::Server::PB::DeleteDocumentOp>(Arena*);
+template<> ::Acoustid::Server::PB::DocumentFilter* Arena::CreateMaybeMessage<::Acoustid::Server::PB::DocumentFilter>(Arena*);
 template<> ::Acoustid::Server::PB::GetAttributeRequest* Arena::CreateMaybeMessage<::Acoustid::Server::PB::GetAttributeRequest>(Arena*);
 template<> ::Acoustid::Server::PB::GetAttributeResponse* Arena::CreateMaybeMessage<::Acoustid::Server::PB::GetAttributeResponse>(Arena*);
 template<> ::Acoustid::Server::PB::GetDocumentRequest* Arena::CreateMaybeMessage<::Acoustid::Server::PB::GetDocumentRequest>(Arena*);
 template<> ::Acoustid::Server::PB::GetDocumentResponse* Arena::CreateMaybeMessage<::Acoustid::Server::PB::GetDocumentResponse>(Arena*);
 template<> ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Arena::CreateMaybeMessage<::Acoustid::Server::PB::InsertOrUpdateDocumentOp>(Arena*);
 template<> ::Acoustid::Server::PB::Operation* Arena::CreateMaybeMessage<::Acoustid::Server::PB::Operation>(Arena*);
+template<> ::Acoustid::Server::PB::SearchQuery* Arena::CreateMaybeMessage<::Acoustid::Server::PB::SearchQuery>(Arena*);
 template<> ::Acoustid::Server::PB::SearchRequest* Arena::CreateMaybeMessage<::Acoustid::Server::PB::SearchRequest>(Arena*);
 template<> ::Acoustid::Server::PB::SearchResponse* Arena::CreateMaybeMessage<::Acoustid::Server::PB::SearchResponse>(Arena*);
 template<> ::Acoustid::Server::PB::SearchResult* Arena::CreateMaybeMessage<::Acoustid::Server::PB::SearchResult>(Arena*);
 template<> ::Acoustid::Server::PB::SetAttributeOp* Arena::CreateMaybeMessage<::Acoustid::Server::PB::SetAttributeOp>(Arena*);
 template<> ::Acoustid::Server::PB::UpdateRequest* Arena::CreateMaybeMessage<::Acoustid::Server::PB::UpdateRequest>(Arena*);
 template<> ::Acoustid::Server::PB::UpdateResponse* Arena::CreateMaybeMessage<::Acoustid::Server::PB::UpdateResponse>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace Acoustid {
 namespace Server {
 namespace PB {
 
 // ===================================================================
 
-class GetDocumentRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetDocumentRequest) */ {
+class GetDocumentRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetDocumentRequest) */ {
  public:
-  GetDocumentRequest();
-  virtual ~GetDocumentRequest();
+  inline GetDocumentRequest() : GetDocumentRequest(nullptr) {}
+  ~GetDocumentRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetDocumentRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetDocumentRequest(const GetDocumentRequest& from);
-
-  inline GetDocumentRequest& operator=(const GetDocumentRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetDocumentRequest(GetDocumentRequest&& from) noexcept
     : GetDocumentRequest() {
     *this = ::std::move(from);
   }
 
+  inline GetDocumentRequest& operator=(const GetDocumentRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetDocumentRequest& operator=(GetDocumentRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetDocumentRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetDocumentRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetDocumentRequest* internal_default_instance() {
     return reinterpret_cast<const GetDocumentRequest*>(
                &_GetDocumentRequest_default_instance_);
@@ -150,117 +177,163 @@ class GetDocumentRequest : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(GetDocumentRequest* other);
   friend void swap(GetDocumentRequest& a, GetDocumentRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetDocumentRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetDocumentRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetDocumentRequest* New() const final {
-    return CreateMaybeMessage<GetDocumentRequest>(NULL);
-  }
-
-  GetDocumentRequest* New(::google::protobuf::Arena* arena) const final {
+  GetDocumentRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetDocumentRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetDocumentRequest& from);
-  void MergeFrom(const GetDocumentRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetDocumentRequest& from) {
+    GetDocumentRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetDocumentRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.GetDocumentRequest";
   }
+  protected:
+  explicit GetDocumentRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIndexNameFieldNumber = 1,
+    kDocIdFieldNumber = 2,
+  };
   // string index_name = 1;
   void clear_index_name();
-  static const int kIndexNameFieldNumber = 1;
-  const ::std::string& index_name() const;
-  void set_index_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_index_name(::std::string&& value);
-  #endif
-  void set_index_name(const char* value);
-  void set_index_name(const char* value, size_t size);
-  ::std::string* mutable_index_name();
-  ::std::string* release_index_name();
-  void set_allocated_index_name(::std::string* index_name);
+  const std::string& index_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_index_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_name();
+  PROTOBUF_NODISCARD std::string* release_index_name();
+  void set_allocated_index_name(std::string* index_name);
+  private:
+  const std::string& _internal_index_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_name(const std::string& value);
+  std::string* _internal_mutable_index_name();
+  public:
 
   // uint32 doc_id = 2;
   void clear_doc_id();
-  static const int kDocIdFieldNumber = 2;
-  ::google::protobuf::uint32 doc_id() const;
-  void set_doc_id(::google::protobuf::uint32 value);
+  uint32_t doc_id() const;
+  void set_doc_id(uint32_t value);
+  private:
+  uint32_t _internal_doc_id() const;
+  void _internal_set_doc_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.GetDocumentRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr index_name_;
-  ::google::protobuf::uint32 doc_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+    uint32_t doc_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetDocumentResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetDocumentResponse) */ {
+class GetDocumentResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetDocumentResponse) */ {
  public:
-  GetDocumentResponse();
-  virtual ~GetDocumentResponse();
+  inline GetDocumentResponse() : GetDocumentResponse(nullptr) {}
+  ~GetDocumentResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetDocumentResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetDocumentResponse(const GetDocumentResponse& from);
-
-  inline GetDocumentResponse& operator=(const GetDocumentResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetDocumentResponse(GetDocumentResponse&& from) noexcept
     : GetDocumentResponse() {
     *this = ::std::move(from);
   }
 
+  inline GetDocumentResponse& operator=(const GetDocumentResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetDocumentResponse& operator=(GetDocumentResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetDocumentResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetDocumentResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetDocumentResponse* internal_default_instance() {
     return reinterpret_cast<const GetDocumentResponse*>(
                &_GetDocumentResponse_default_instance_);
@@ -268,109 +341,161 @@ class GetDocumentResponse : public ::google::protobuf::Message /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(GetDocumentResponse* other);
   friend void swap(GetDocumentResponse& a, GetDocumentResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetDocumentResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetDocumentResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetDocumentResponse* New() const final {
-    return CreateMaybeMessage<GetDocumentResponse>(NULL);
-  }
-
-  GetDocumentResponse* New(::google::protobuf::Arena* arena) const final {
+  GetDocumentResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetDocumentResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetDocumentResponse& from);
-  void MergeFrom(const GetDocumentResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetDocumentResponse& from) {
+    GetDocumentResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetDocumentResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.GetDocumentResponse";
   }
+  protected:
+  explicit GetDocumentResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTermsFieldNumber = 2,
+  };
   // repeated uint32 terms = 2;
   int terms_size() const;
+  private:
+  int _internal_terms_size() const;
+  public:
   void clear_terms();
-  static const int kTermsFieldNumber = 2;
-  ::google::protobuf::uint32 terms(int index) const;
-  void set_terms(int index, ::google::protobuf::uint32 value);
-  void add_terms(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_terms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_terms() const;
+  void _internal_add_terms(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_terms();
+  public:
+  uint32_t terms(int index) const;
+  void set_terms(int index, uint32_t value);
+  void add_terms(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       terms() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_terms();
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.GetDocumentResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > terms_;
-  mutable int _terms_cached_byte_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > terms_;
+    mutable std::atomic<int> _terms_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetAttributeRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetAttributeRequest) */ {
+class GetAttributeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetAttributeRequest) */ {
  public:
-  GetAttributeRequest();
-  virtual ~GetAttributeRequest();
+  inline GetAttributeRequest() : GetAttributeRequest(nullptr) {}
+  ~GetAttributeRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetAttributeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetAttributeRequest(const GetAttributeRequest& from);
-
-  inline GetAttributeRequest& operator=(const GetAttributeRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetAttributeRequest(GetAttributeRequest&& from) noexcept
     : GetAttributeRequest() {
     *this = ::std::move(from);
   }
 
+  inline GetAttributeRequest& operator=(const GetAttributeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetAttributeRequest& operator=(GetAttributeRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetAttributeRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttributeRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetAttributeRequest* internal_default_instance() {
     return reinterpret_cast<const GetAttributeRequest*>(
                &_GetAttributeRequest_default_instance_);
@@ -378,125 +503,168 @@ class GetAttributeRequest : public ::google::protobuf::Message /* @@protoc_inser
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(GetAttributeRequest* other);
   friend void swap(GetAttributeRequest& a, GetAttributeRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetAttributeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttributeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetAttributeRequest* New() const final {
-    return CreateMaybeMessage<GetAttributeRequest>(NULL);
-  }
-
-  GetAttributeRequest* New(::google::protobuf::Arena* arena) const final {
+  GetAttributeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetAttributeRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetAttributeRequest& from);
-  void MergeFrom(const GetAttributeRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttributeRequest& from) {
+    GetAttributeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetAttributeRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.GetAttributeRequest";
   }
+  protected:
+  explicit GetAttributeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIndexNameFieldNumber = 1,
+    kNameFieldNumber = 2,
+  };
   // string index_name = 1;
   void clear_index_name();
-  static const int kIndexNameFieldNumber = 1;
-  const ::std::string& index_name() const;
-  void set_index_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_index_name(::std::string&& value);
-  #endif
-  void set_index_name(const char* value);
-  void set_index_name(const char* value, size_t size);
-  ::std::string* mutable_index_name();
-  ::std::string* release_index_name();
-  void set_allocated_index_name(::std::string* index_name);
+  const std::string& index_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_index_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_name();
+  PROTOBUF_NODISCARD std::string* release_index_name();
+  void set_allocated_index_name(std::string* index_name);
+  private:
+  const std::string& _internal_index_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_name(const std::string& value);
+  std::string* _internal_mutable_index_name();
+  public:
 
   // string name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.GetAttributeRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr index_name_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetAttributeResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetAttributeResponse) */ {
+class GetAttributeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.GetAttributeResponse) */ {
  public:
-  GetAttributeResponse();
-  virtual ~GetAttributeResponse();
+  inline GetAttributeResponse() : GetAttributeResponse(nullptr) {}
+  ~GetAttributeResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetAttributeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetAttributeResponse(const GetAttributeResponse& from);
-
-  inline GetAttributeResponse& operator=(const GetAttributeResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetAttributeResponse(GetAttributeResponse&& from) noexcept
     : GetAttributeResponse() {
     *this = ::std::move(from);
   }
 
+  inline GetAttributeResponse& operator=(const GetAttributeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetAttributeResponse& operator=(GetAttributeResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetAttributeResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttributeResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetAttributeResponse* internal_default_instance() {
     return reinterpret_cast<const GetAttributeResponse*>(
                &_GetAttributeResponse_default_instance_);
@@ -504,110 +672,152 @@ class GetAttributeResponse : public ::google::protobuf::Message /* @@protoc_inse
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(GetAttributeResponse* other);
   friend void swap(GetAttributeResponse& a, GetAttributeResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetAttributeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttributeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetAttributeResponse* New() const final {
-    return CreateMaybeMessage<GetAttributeResponse>(NULL);
-  }
-
-  GetAttributeResponse* New(::google::protobuf::Arena* arena) const final {
+  GetAttributeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetAttributeResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetAttributeResponse& from);
-  void MergeFrom(const GetAttributeResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttributeResponse& from) {
+    GetAttributeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetAttributeResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.GetAttributeResponse";
   }
+  protected:
+  explicit GetAttributeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kValueFieldNumber = 2,
+  };
   // string value = 2;
   void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  #if LANG_CXX11
-  void set_value(::std::string&& value);
-  #endif
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.GetAttributeResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InsertOrUpdateDocumentOp : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.InsertOrUpdateDocumentOp) */ {
+class InsertOrUpdateDocumentOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.InsertOrUpdateDocumentOp) */ {
  public:
-  InsertOrUpdateDocumentOp();
-  virtual ~InsertOrUpdateDocumentOp();
+  inline InsertOrUpdateDocumentOp() : InsertOrUpdateDocumentOp(nullptr) {}
+  ~InsertOrUpdateDocumentOp() override;
+  explicit PROTOBUF_CONSTEXPR InsertOrUpdateDocumentOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InsertOrUpdateDocumentOp(const InsertOrUpdateDocumentOp& from);
-
-  inline InsertOrUpdateDocumentOp& operator=(const InsertOrUpdateDocumentOp& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   InsertOrUpdateDocumentOp(InsertOrUpdateDocumentOp&& from) noexcept
     : InsertOrUpdateDocumentOp() {
     *this = ::std::move(from);
   }
 
+  inline InsertOrUpdateDocumentOp& operator=(const InsertOrUpdateDocumentOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline InsertOrUpdateDocumentOp& operator=(InsertOrUpdateDocumentOp&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const InsertOrUpdateDocumentOp& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InsertOrUpdateDocumentOp& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const InsertOrUpdateDocumentOp* internal_default_instance() {
     return reinterpret_cast<const InsertOrUpdateDocumentOp*>(
                &_InsertOrUpdateDocumentOp_default_instance_);
@@ -615,116 +825,172 @@ class InsertOrUpdateDocumentOp : public ::google::protobuf::Message /* @@protoc_
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(InsertOrUpdateDocumentOp* other);
   friend void swap(InsertOrUpdateDocumentOp& a, InsertOrUpdateDocumentOp& b) {
     a.Swap(&b);
   }
+  inline void Swap(InsertOrUpdateDocumentOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InsertOrUpdateDocumentOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline InsertOrUpdateDocumentOp* New() const final {
-    return CreateMaybeMessage<InsertOrUpdateDocumentOp>(NULL);
-  }
-
-  InsertOrUpdateDocumentOp* New(::google::protobuf::Arena* arena) const final {
+  InsertOrUpdateDocumentOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InsertOrUpdateDocumentOp>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InsertOrUpdateDocumentOp& from);
-  void MergeFrom(const InsertOrUpdateDocumentOp& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertOrUpdateDocumentOp& from) {
+    InsertOrUpdateDocumentOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InsertOrUpdateDocumentOp* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.InsertOrUpdateDocumentOp";
   }
+  protected:
+  explicit InsertOrUpdateDocumentOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTermsFieldNumber = 2,
+    kDocIdFieldNumber = 1,
+  };
   // repeated uint32 terms = 2;
   int terms_size() const;
+  private:
+  int _internal_terms_size() const;
+  public:
   void clear_terms();
-  static const int kTermsFieldNumber = 2;
-  ::google::protobuf::uint32 terms(int index) const;
-  void set_terms(int index, ::google::protobuf::uint32 value);
-  void add_terms(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_terms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_terms() const;
+  void _internal_add_terms(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_terms();
+  public:
+  uint32_t terms(int index) const;
+  void set_terms(int index, uint32_t value);
+  void add_terms(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       terms() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_terms();
 
   // uint32 doc_id = 1;
   void clear_doc_id();
-  static const int kDocIdFieldNumber = 1;
-  ::google::protobuf::uint32 doc_id() const;
-  void set_doc_id(::google::protobuf::uint32 value);
+  uint32_t doc_id() const;
+  void set_doc_id(uint32_t value);
+  private:
+  uint32_t _internal_doc_id() const;
+  void _internal_set_doc_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.InsertOrUpdateDocumentOp)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > terms_;
-  mutable int _terms_cached_byte_size_;
-  ::google::protobuf::uint32 doc_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > terms_;
+    mutable std::atomic<int> _terms_cached_byte_size_;
+    uint32_t doc_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeleteDocumentOp : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.DeleteDocumentOp) */ {
+class DeleteDocumentOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.DeleteDocumentOp) */ {
  public:
-  DeleteDocumentOp();
-  virtual ~DeleteDocumentOp();
+  inline DeleteDocumentOp() : DeleteDocumentOp(nullptr) {}
+  ~DeleteDocumentOp() override;
+  explicit PROTOBUF_CONSTEXPR DeleteDocumentOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeleteDocumentOp(const DeleteDocumentOp& from);
-
-  inline DeleteDocumentOp& operator=(const DeleteDocumentOp& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   DeleteDocumentOp(DeleteDocumentOp&& from) noexcept
     : DeleteDocumentOp() {
     *this = ::std::move(from);
   }
 
+  inline DeleteDocumentOp& operator=(const DeleteDocumentOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline DeleteDocumentOp& operator=(DeleteDocumentOp&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DeleteDocumentOp& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteDocumentOp& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DeleteDocumentOp* internal_default_instance() {
     return reinterpret_cast<const DeleteDocumentOp*>(
                &_DeleteDocumentOp_default_instance_);
@@ -732,102 +998,147 @@ class DeleteDocumentOp : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(DeleteDocumentOp* other);
   friend void swap(DeleteDocumentOp& a, DeleteDocumentOp& b) {
     a.Swap(&b);
   }
+  inline void Swap(DeleteDocumentOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteDocumentOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DeleteDocumentOp* New() const final {
-    return CreateMaybeMessage<DeleteDocumentOp>(NULL);
-  }
-
-  DeleteDocumentOp* New(::google::protobuf::Arena* arena) const final {
+  DeleteDocumentOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeleteDocumentOp>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DeleteDocumentOp& from);
-  void MergeFrom(const DeleteDocumentOp& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteDocumentOp& from) {
+    DeleteDocumentOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DeleteDocumentOp* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.DeleteDocumentOp";
   }
+  protected:
+  explicit DeleteDocumentOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDocIdFieldNumber = 1,
+  };
   // uint32 doc_id = 1;
   void clear_doc_id();
-  static const int kDocIdFieldNumber = 1;
-  ::google::protobuf::uint32 doc_id() const;
-  void set_doc_id(::google::protobuf::uint32 value);
+  uint32_t doc_id() const;
+  void set_doc_id(uint32_t value);
+  private:
+  uint32_t _internal_doc_id() const;
+  void _internal_set_doc_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.DeleteDocumentOp)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 doc_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t doc_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SetAttributeOp : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SetAttributeOp) */ {
+class SetAttributeOp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SetAttributeOp) */ {
  public:
-  SetAttributeOp();
-  virtual ~SetAttributeOp();
+  inline SetAttributeOp() : SetAttributeOp(nullptr) {}
+  ~SetAttributeOp() override;
+  explicit PROTOBUF_CONSTEXPR SetAttributeOp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SetAttributeOp(const SetAttributeOp& from);
-
-  inline SetAttributeOp& operator=(const SetAttributeOp& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SetAttributeOp(SetAttributeOp&& from) noexcept
     : SetAttributeOp() {
     *this = ::std::move(from);
   }
 
+  inline SetAttributeOp& operator=(const SetAttributeOp& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SetAttributeOp& operator=(SetAttributeOp&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SetAttributeOp& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetAttributeOp& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SetAttributeOp* internal_default_instance() {
     return reinterpret_cast<const SetAttributeOp*>(
                &_SetAttributeOp_default_instance_);
@@ -835,124 +1146,168 @@ class SetAttributeOp : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(SetAttributeOp* other);
   friend void swap(SetAttributeOp& a, SetAttributeOp& b) {
     a.Swap(&b);
   }
+  inline void Swap(SetAttributeOp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetAttributeOp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SetAttributeOp* New() const final {
-    return CreateMaybeMessage<SetAttributeOp>(NULL);
-  }
-
-  SetAttributeOp* New(::google::protobuf::Arena* arena) const final {
+  SetAttributeOp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SetAttributeOp>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SetAttributeOp& from);
-  void MergeFrom(const SetAttributeOp& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetAttributeOp& from) {
+    SetAttributeOp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SetAttributeOp* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.SetAttributeOp";
   }
+  protected:
+  explicit SetAttributeOp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string value = 2;
   void clear_value();
-  static const int kValueFieldNumber = 2;
-  const ::std::string& value() const;
-  void set_value(const ::std::string& value);
-  #if LANG_CXX11
-  void set_value(::std::string&& value);
-  #endif
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
-  ::std::string* mutable_value();
-  ::std::string* release_value();
-  void set_allocated_value(::std::string* value);
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.SetAttributeOp)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr value_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Operation : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.Operation) */ {
+class Operation final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.Operation) */ {
  public:
-  Operation();
-  virtual ~Operation();
+  inline Operation() : Operation(nullptr) {}
+  ~Operation() override;
+  explicit PROTOBUF_CONSTEXPR Operation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Operation(const Operation& from);
-
-  inline Operation& operator=(const Operation& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Operation(Operation&& from) noexcept
     : Operation() {
     *this = ::std::move(from);
   }
 
+  inline Operation& operator=(const Operation& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Operation& operator=(Operation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Operation& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Operation& default_instance() {
+    return *internal_default_instance();
+  }
   enum OpCase {
     kInsertOrUpdateDocument = 1,
     kDeleteDocument = 2,
@@ -960,7 +1315,6 @@ class Operation : public ::google::protobuf::Message /* @@protoc_insertion_point
     OP_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Operation* internal_default_instance() {
     return reinterpret_cast<const Operation*>(
                &_Operation_default_instance_);
@@ -968,96 +1322,140 @@ class Operation : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(Operation* other);
   friend void swap(Operation& a, Operation& b) {
     a.Swap(&b);
   }
+  inline void Swap(Operation* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Operation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Operation* New() const final {
-    return CreateMaybeMessage<Operation>(NULL);
-  }
-
-  Operation* New(::google::protobuf::Arena* arena) const final {
+  Operation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Operation>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Operation& from);
-  void MergeFrom(const Operation& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Operation& from) {
+    Operation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Operation* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.Operation";
   }
+  protected:
+  explicit Operation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kInsertOrUpdateDocumentFieldNumber = 1,
+    kDeleteDocumentFieldNumber = 2,
+    kSetAttributeFieldNumber = 3,
+  };
   // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
   bool has_insert_or_update_document() const;
-  void clear_insert_or_update_document();
-  static const int kInsertOrUpdateDocumentFieldNumber = 1;
   private:
-  const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& _internal_insert_or_update_document() const;
+  bool _internal_has_insert_or_update_document() const;
   public:
+  void clear_insert_or_update_document();
   const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& insert_or_update_document() const;
-  ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* release_insert_or_update_document();
+  PROTOBUF_NODISCARD ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* release_insert_or_update_document();
   ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* mutable_insert_or_update_document();
   void set_allocated_insert_or_update_document(::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document);
+  private:
+  const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& _internal_insert_or_update_document() const;
+  ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* _internal_mutable_insert_or_update_document();
+  public:
+  void unsafe_arena_set_allocated_insert_or_update_document(
+      ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document);
+  ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* unsafe_arena_release_insert_or_update_document();
 
   // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
   bool has_delete_document() const;
-  void clear_delete_document();
-  static const int kDeleteDocumentFieldNumber = 2;
   private:
-  const ::Acoustid::Server::PB::DeleteDocumentOp& _internal_delete_document() const;
+  bool _internal_has_delete_document() const;
   public:
+  void clear_delete_document();
   const ::Acoustid::Server::PB::DeleteDocumentOp& delete_document() const;
-  ::Acoustid::Server::PB::DeleteDocumentOp* release_delete_document();
+  PROTOBUF_NODISCARD ::Acoustid::Server::PB::DeleteDocumentOp* release_delete_document();
   ::Acoustid::Server::PB::DeleteDocumentOp* mutable_delete_document();
   void set_allocated_delete_document(::Acoustid::Server::PB::DeleteDocumentOp* delete_document);
+  private:
+  const ::Acoustid::Server::PB::DeleteDocumentOp& _internal_delete_document() const;
+  ::Acoustid::Server::PB::DeleteDocumentOp* _internal_mutable_delete_document();
+  public:
+  void unsafe_arena_set_allocated_delete_document(
+      ::Acoustid::Server::PB::DeleteDocumentOp* delete_document);
+  ::Acoustid::Server::PB::DeleteDocumentOp* unsafe_arena_release_delete_document();
 
   // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
   bool has_set_attribute() const;
-  void clear_set_attribute();
-  static const int kSetAttributeFieldNumber = 3;
   private:
-  const ::Acoustid::Server::PB::SetAttributeOp& _internal_set_attribute() const;
+  bool _internal_has_set_attribute() const;
   public:
+  void clear_set_attribute();
   const ::Acoustid::Server::PB::SetAttributeOp& set_attribute() const;
-  ::Acoustid::Server::PB::SetAttributeOp* release_set_attribute();
+  PROTOBUF_NODISCARD ::Acoustid::Server::PB::SetAttributeOp* release_set_attribute();
   ::Acoustid::Server::PB::SetAttributeOp* mutable_set_attribute();
   void set_allocated_set_attribute(::Acoustid::Server::PB::SetAttributeOp* set_attribute);
+  private:
+  const ::Acoustid::Server::PB::SetAttributeOp& _internal_set_attribute() const;
+  ::Acoustid::Server::PB::SetAttributeOp* _internal_mutable_set_attribute();
+  public:
+  void unsafe_arena_set_allocated_set_attribute(
+      ::Acoustid::Server::PB::SetAttributeOp* set_attribute);
+  ::Acoustid::Server::PB::SetAttributeOp* unsafe_arena_release_set_attribute();
 
   void clear_op();
   OpCase op_case() const;
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.Operation)
  private:
+  class _Internal;
   void set_has_insert_or_update_document();
   void set_has_delete_document();
   void set_has_set_attribute();
@@ -1065,50 +1463,69 @@ class Operation : public ::google::protobuf::Message /* @@protoc_insertion_point
   inline bool has_op() const;
   inline void clear_has_op();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  union OpUnion {
-    OpUnion() {}
-    ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document_;
-    ::Acoustid::Server::PB::DeleteDocumentOp* delete_document_;
-    ::Acoustid::Server::PB::SetAttributeOp* set_attribute_;
-  } op_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union OpUnion {
+      constexpr OpUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document_;
+      ::Acoustid::Server::PB::DeleteDocumentOp* delete_document_;
+      ::Acoustid::Server::PB::SetAttributeOp* set_attribute_;
+    } op_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.UpdateRequest) */ {
+class UpdateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.UpdateRequest) */ {
  public:
-  UpdateRequest();
-  virtual ~UpdateRequest();
+  inline UpdateRequest() : UpdateRequest(nullptr) {}
+  ~UpdateRequest() override;
+  explicit PROTOBUF_CONSTEXPR UpdateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateRequest(const UpdateRequest& from);
-
-  inline UpdateRequest& operator=(const UpdateRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UpdateRequest(UpdateRequest&& from) noexcept
     : UpdateRequest() {
     *this = ::std::move(from);
   }
 
+  inline UpdateRequest& operator=(const UpdateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UpdateRequest& operator=(UpdateRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UpdateRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UpdateRequest* internal_default_instance() {
     return reinterpret_cast<const UpdateRequest*>(
                &_UpdateRequest_default_instance_);
@@ -1116,123 +1533,171 @@ class UpdateRequest : public ::google::protobuf::Message /* @@protoc_insertion_p
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(UpdateRequest* other);
   friend void swap(UpdateRequest& a, UpdateRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(UpdateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateRequest* New() const final {
-    return CreateMaybeMessage<UpdateRequest>(NULL);
-  }
-
-  UpdateRequest* New(::google::protobuf::Arena* arena) const final {
+  UpdateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UpdateRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const UpdateRequest& from);
-  void MergeFrom(const UpdateRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateRequest& from) {
+    UpdateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(UpdateRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.UpdateRequest";
   }
+  protected:
+  explicit UpdateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kOpsFieldNumber = 2,
+    kIndexNameFieldNumber = 1,
+  };
   // repeated .Acoustid.Server.PB.Operation ops = 2;
   int ops_size() const;
+  private:
+  int _internal_ops_size() const;
+  public:
   void clear_ops();
-  static const int kOpsFieldNumber = 2;
   ::Acoustid::Server::PB::Operation* mutable_ops(int index);
-  ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::Operation >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::Operation >*
       mutable_ops();
+  private:
+  const ::Acoustid::Server::PB::Operation& _internal_ops(int index) const;
+  ::Acoustid::Server::PB::Operation* _internal_add_ops();
+  public:
   const ::Acoustid::Server::PB::Operation& ops(int index) const;
   ::Acoustid::Server::PB::Operation* add_ops();
-  const ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::Operation >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::Operation >&
       ops() const;
 
   // string index_name = 1;
   void clear_index_name();
-  static const int kIndexNameFieldNumber = 1;
-  const ::std::string& index_name() const;
-  void set_index_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_index_name(::std::string&& value);
-  #endif
-  void set_index_name(const char* value);
-  void set_index_name(const char* value, size_t size);
-  ::std::string* mutable_index_name();
-  ::std::string* release_index_name();
-  void set_allocated_index_name(::std::string* index_name);
+  const std::string& index_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_index_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_name();
+  PROTOBUF_NODISCARD std::string* release_index_name();
+  void set_allocated_index_name(std::string* index_name);
+  private:
+  const std::string& _internal_index_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_name(const std::string& value);
+  std::string* _internal_mutable_index_name();
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.UpdateRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::Operation > ops_;
-  ::google::protobuf::internal::ArenaStringPtr index_name_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::Operation > ops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.UpdateResponse) */ {
+class UpdateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.UpdateResponse) */ {
  public:
-  UpdateResponse();
-  virtual ~UpdateResponse();
+  inline UpdateResponse() : UpdateResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR UpdateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   UpdateResponse(const UpdateResponse& from);
-
-  inline UpdateResponse& operator=(const UpdateResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   UpdateResponse(UpdateResponse&& from) noexcept
     : UpdateResponse() {
     *this = ::std::move(from);
   }
 
+  inline UpdateResponse& operator=(const UpdateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline UpdateResponse& operator=(UpdateResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const UpdateResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const UpdateResponse* internal_default_instance() {
     return reinterpret_cast<const UpdateResponse*>(
                &_UpdateResponse_default_instance_);
@@ -1240,51 +1705,57 @@ class UpdateResponse : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(UpdateResponse* other);
   friend void swap(UpdateResponse& a, UpdateResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(UpdateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateResponse* New() const final {
-    return CreateMaybeMessage<UpdateResponse>(NULL);
-  }
-
-  UpdateResponse* New(::google::protobuf::Arena* arena) const final {
+  UpdateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<UpdateResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const UpdateResponse& from);
-  void MergeFrom(const UpdateResponse& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const UpdateResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const UpdateResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
   private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(UpdateResponse* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.UpdateResponse";
   }
+  protected:
+  explicit UpdateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1292,43 +1763,60 @@ class UpdateResponse : public ::google::protobuf::Message /* @@protoc_insertion_
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.UpdateResponse)
  private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SearchResult : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchResult) */ {
+class SearchResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchResult) */ {
  public:
-  SearchResult();
-  virtual ~SearchResult();
+  inline SearchResult() : SearchResult(nullptr) {}
+  ~SearchResult() override;
+  explicit PROTOBUF_CONSTEXPR SearchResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SearchResult(const SearchResult& from);
-
-  inline SearchResult& operator=(const SearchResult& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SearchResult(SearchResult&& from) noexcept
     : SearchResult() {
     *this = ::std::move(from);
   }
 
+  inline SearchResult& operator=(const SearchResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SearchResult& operator=(SearchResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SearchResult& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchResult& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SearchResult* internal_default_instance() {
     return reinterpret_cast<const SearchResult*>(
                &_SearchResult_default_instance_);
@@ -1336,317 +1824,1277 @@ class SearchResult : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(SearchResult* other);
   friend void swap(SearchResult& a, SearchResult& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SearchResult* New() const final {
-    return CreateMaybeMessage<SearchResult>(NULL);
-  }
-
-  SearchResult* New(::google::protobuf::Arena* arena) const final {
+  SearchResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SearchResult>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SearchResult& from);
-  void MergeFrom(const SearchResult& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchResult& from) {
+    SearchResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SearchResult* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.SearchResult";
   }
+  protected:
+  explicit SearchResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDocIdFieldNumber = 1,
+    kScoreFieldNumber = 2,
+  };
   // uint32 doc_id = 1;
   void clear_doc_id();
-  static const int kDocIdFieldNumber = 1;
-  ::google::protobuf::uint32 doc_id() const;
-  void set_doc_id(::google::protobuf::uint32 value);
+  uint32_t doc_id() const;
+  void set_doc_id(uint32_t value);
+  private:
+  uint32_t _internal_doc_id() const;
+  void _internal_set_doc_id(uint32_t value);
+  public:
 
   // float score = 2;
   void clear_score();
-  static const int kScoreFieldNumber = 2;
   float score() const;
   void set_score(float value);
+  private:
+  float _internal_score() const;
+  void _internal_set_score(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.SearchResult)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 doc_id_;
-  float score_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t doc_id_;
+    float score_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SearchRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchRequest) */ {
+class DocumentFilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.DocumentFilter) */ {
  public:
-  SearchRequest();
-  virtual ~SearchRequest();
+  inline DocumentFilter() : DocumentFilter(nullptr) {}
+  ~DocumentFilter() override;
+  explicit PROTOBUF_CONSTEXPR DocumentFilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SearchRequest(const SearchRequest& from);
+  DocumentFilter(const DocumentFilter& from);
+  DocumentFilter(DocumentFilter&& from) noexcept
+    : DocumentFilter() {
+    *this = ::std::move(from);
+  }
 
-  inline SearchRequest& operator=(const SearchRequest& from) {
+  inline DocumentFilter& operator=(const DocumentFilter& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline DocumentFilter& operator=(DocumentFilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DocumentFilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DocumentFilter* internal_default_instance() {
+    return reinterpret_cast<const DocumentFilter*>(
+               &_DocumentFilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(DocumentFilter& a, DocumentFilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DocumentFilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DocumentFilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DocumentFilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DocumentFilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DocumentFilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DocumentFilter& from) {
+    DocumentFilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DocumentFilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.DocumentFilter";
+  }
+  protected:
+  explicit DocumentFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBitmapFieldNumber = 3,
+    kMinIdFieldNumber = 1,
+    kMaxIdFieldNumber = 2,
+  };
+  // bytes bitmap = 3;
+  void clear_bitmap();
+  const std::string& bitmap() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bitmap(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bitmap();
+  PROTOBUF_NODISCARD std::string* release_bitmap();
+  void set_allocated_bitmap(std::string* bitmap);
+  private:
+  const std::string& _internal_bitmap() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bitmap(const std::string& value);
+  std::string* _internal_mutable_bitmap();
+  public:
+
+  // uint32 min_id = 1;
+  void clear_min_id();
+  uint32_t min_id() const;
+  void set_min_id(uint32_t value);
+  private:
+  uint32_t _internal_min_id() const;
+  void _internal_set_min_id(uint32_t value);
+  public:
+
+  // uint32 max_id = 2;
+  void clear_max_id();
+  uint32_t max_id() const;
+  void set_max_id(uint32_t value);
+  private:
+  uint32_t _internal_max_id() const;
+  void _internal_set_max_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.DocumentFilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bitmap_;
+    uint32_t min_id_;
+    uint32_t max_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchRequest) */ {
+ public:
+  inline SearchRequest() : SearchRequest(nullptr) {}
+  ~SearchRequest() override;
+  explicit PROTOBUF_CONSTEXPR SearchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchRequest(const SearchRequest& from);
   SearchRequest(SearchRequest&& from) noexcept
     : SearchRequest() {
     *this = ::std::move(from);
   }
 
+  inline SearchRequest& operator=(const SearchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SearchRequest& operator=(SearchRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SearchRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SearchRequest* internal_default_instance() {
     return reinterpret_cast<const SearchRequest*>(
                &_SearchRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  void Swap(SearchRequest* other);
   friend void swap(SearchRequest& a, SearchRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SearchRequest* New() const final {
-    return CreateMaybeMessage<SearchRequest>(NULL);
-  }
-
-  SearchRequest* New(::google::protobuf::Arena* arena) const final {
+  SearchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SearchRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SearchRequest& from);
-  void MergeFrom(const SearchRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchRequest& from) {
+    SearchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SearchRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.SearchRequest";
   }
+  protected:
+  explicit SearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTermsFieldNumber = 2,
+    kIndexNameFieldNumber = 1,
+    kFilterFieldNumber = 11,
+    kMaxResultsFieldNumber = 3,
+    kBypassCacheFieldNumber = 4,
+    kAllowPartialResultsFieldNumber = 5,
+    kSampledFieldNumber = 6,
+    kSampleStrideFieldNumber = 7,
+    kSampleCandidatesFieldNumber = 8,
+    kExpandDistanceFieldNumber = 9,
+    kExpandMaskFieldNumber = 10,
+  };
   // repeated uint32 terms = 2;
   int terms_size() const;
+  private:
+  int _internal_terms_size() const;
+  public:
   void clear_terms();
-  static const int kTermsFieldNumber = 2;
-  ::google::protobuf::uint32 terms(int index) const;
-  void set_terms(int index, ::google::protobuf::uint32 value);
-  void add_terms(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_terms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_terms() const;
+  void _internal_add_terms(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_terms();
+  public:
+  uint32_t terms(int index) const;
+  void set_terms(int index, uint32_t value);
+  void add_terms(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       terms() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_terms();
 
   // string index_name = 1;
   void clear_index_name();
-  static const int kIndexNameFieldNumber = 1;
-  const ::std::string& index_name() const;
-  void set_index_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_index_name(::std::string&& value);
-  #endif
-  void set_index_name(const char* value);
-  void set_index_name(const char* value, size_t size);
-  ::std::string* mutable_index_name();
-  ::std::string* release_index_name();
-  void set_allocated_index_name(::std::string* index_name);
+  const std::string& index_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_index_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_name();
+  PROTOBUF_NODISCARD std::string* release_index_name();
+  void set_allocated_index_name(std::string* index_name);
+  private:
+  const std::string& _internal_index_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_name(const std::string& value);
+  std::string* _internal_mutable_index_name();
+  public:
+
+  // .Acoustid.Server.PB.DocumentFilter filter = 11;
+  bool has_filter() const;
+  private:
+  bool _internal_has_filter() const;
+  public:
+  void clear_filter();
+  const ::Acoustid::Server::PB::DocumentFilter& filter() const;
+  PROTOBUF_NODISCARD ::Acoustid::Server::PB::DocumentFilter* release_filter();
+  ::Acoustid::Server::PB::DocumentFilter* mutable_filter();
+  void set_allocated_filter(::Acoustid::Server::PB::DocumentFilter* filter);
+  private:
+  const ::Acoustid::Server::PB::DocumentFilter& _internal_filter() const;
+  ::Acoustid::Server::PB::DocumentFilter* _internal_mutable_filter();
+  public:
+  void unsafe_arena_set_allocated_filter(
+      ::Acoustid::Server::PB::DocumentFilter* filter);
+  ::Acoustid::Server::PB::DocumentFilter* unsafe_arena_release_filter();
 
   // int32 max_results = 3;
   void clear_max_results();
-  static const int kMaxResultsFieldNumber = 3;
-  ::google::protobuf::int32 max_results() const;
-  void set_max_results(::google::protobuf::int32 value);
+  int32_t max_results() const;
+  void set_max_results(int32_t value);
+  private:
+  int32_t _internal_max_results() const;
+  void _internal_set_max_results(int32_t value);
+  public:
+
+  // bool bypass_cache = 4;
+  void clear_bypass_cache();
+  bool bypass_cache() const;
+  void set_bypass_cache(bool value);
+  private:
+  bool _internal_bypass_cache() const;
+  void _internal_set_bypass_cache(bool value);
+  public:
+
+  // bool allow_partial_results = 5;
+  void clear_allow_partial_results();
+  bool allow_partial_results() const;
+  void set_allow_partial_results(bool value);
+  private:
+  bool _internal_allow_partial_results() const;
+  void _internal_set_allow_partial_results(bool value);
+  public:
+
+  // bool sampled = 6;
+  void clear_sampled();
+  bool sampled() const;
+  void set_sampled(bool value);
+  private:
+  bool _internal_sampled() const;
+  void _internal_set_sampled(bool value);
+  public:
+
+  // uint32 sample_stride = 7;
+  void clear_sample_stride();
+  uint32_t sample_stride() const;
+  void set_sample_stride(uint32_t value);
+  private:
+  uint32_t _internal_sample_stride() const;
+  void _internal_set_sample_stride(uint32_t value);
+  public:
+
+  // uint32 sample_candidates = 8;
+  void clear_sample_candidates();
+  uint32_t sample_candidates() const;
+  void set_sample_candidates(uint32_t value);
+  private:
+  uint32_t _internal_sample_candidates() const;
+  void _internal_set_sample_candidates(uint32_t value);
+  public:
+
+  // uint32 expand_distance = 9;
+  void clear_expand_distance();
+  uint32_t expand_distance() const;
+  void set_expand_distance(uint32_t value);
+  private:
+  uint32_t _internal_expand_distance() const;
+  void _internal_set_expand_distance(uint32_t value);
+  public:
+
+  // fixed32 expand_mask = 10;
+  void clear_expand_mask();
+  uint32_t expand_mask() const;
+  void set_expand_mask(uint32_t value);
+  private:
+  uint32_t _internal_expand_mask() const;
+  void _internal_set_expand_mask(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.SearchRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > terms_;
-  mutable int _terms_cached_byte_size_;
-  ::google::protobuf::internal::ArenaStringPtr index_name_;
-  ::google::protobuf::int32 max_results_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > terms_;
+    mutable std::atomic<int> _terms_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+    ::Acoustid::Server::PB::DocumentFilter* filter_;
+    int32_t max_results_;
+    bool bypass_cache_;
+    bool allow_partial_results_;
+    bool sampled_;
+    uint32_t sample_stride_;
+    uint32_t sample_candidates_;
+    uint32_t expand_distance_;
+    uint32_t expand_mask_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SearchResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchResponse) */ {
+class SearchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchResponse) */ {
  public:
-  SearchResponse();
-  virtual ~SearchResponse();
+  inline SearchResponse() : SearchResponse(nullptr) {}
+  ~SearchResponse() override;
+  explicit PROTOBUF_CONSTEXPR SearchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SearchResponse(const SearchResponse& from);
-
-  inline SearchResponse& operator=(const SearchResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SearchResponse(SearchResponse&& from) noexcept
     : SearchResponse() {
     *this = ::std::move(from);
   }
 
+  inline SearchResponse& operator=(const SearchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SearchResponse& operator=(SearchResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SearchResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SearchResponse* internal_default_instance() {
     return reinterpret_cast<const SearchResponse*>(
                &_SearchResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  void Swap(SearchResponse* other);
   friend void swap(SearchResponse& a, SearchResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SearchResponse* New() const final {
-    return CreateMaybeMessage<SearchResponse>(NULL);
-  }
-
-  SearchResponse* New(::google::protobuf::Arena* arena) const final {
+  SearchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SearchResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SearchResponse& from);
-  void MergeFrom(const SearchResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchResponse& from) {
+    SearchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SearchResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.SearchResponse";
   }
+  protected:
+  explicit SearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kResultsFieldNumber = 1,
+    kPartialFieldNumber = 2,
+  };
   // repeated .Acoustid.Server.PB.SearchResult results = 1;
   int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
   void clear_results();
-  static const int kResultsFieldNumber = 1;
   ::Acoustid::Server::PB::SearchResult* mutable_results(int index);
-  ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >*
       mutable_results();
+  private:
+  const ::Acoustid::Server::PB::SearchResult& _internal_results(int index) const;
+  ::Acoustid::Server::PB::SearchResult* _internal_add_results();
+  public:
   const ::Acoustid::Server::PB::SearchResult& results(int index) const;
   ::Acoustid::Server::PB::SearchResult* add_results();
-  const ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >&
       results() const;
 
+  // bool partial = 2;
+  void clear_partial();
+  bool partial() const;
+  void set_partial(bool value);
+  private:
+  bool _internal_partial() const;
+  void _internal_set_partial(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.SearchResponse)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult > results_;
+    bool partial_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchQuery final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.SearchQuery) */ {
+ public:
+  inline SearchQuery() : SearchQuery(nullptr) {}
+  ~SearchQuery() override;
+  explicit PROTOBUF_CONSTEXPR SearchQuery(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SearchQuery(const SearchQuery& from);
+  SearchQuery(SearchQuery&& from) noexcept
+    : SearchQuery() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchQuery& operator=(const SearchQuery& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchQuery& operator=(SearchQuery&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SearchQuery& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchQuery* internal_default_instance() {
+    return reinterpret_cast<const SearchQuery*>(
+               &_SearchQuery_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(SearchQuery& a, SearchQuery& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchQuery* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchQuery* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SearchQuery* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchQuery>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchQuery& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchQuery& from) {
+    SearchQuery::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchQuery* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.SearchQuery";
+  }
+  protected:
+  explicit SearchQuery(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermsFieldNumber = 1,
+    kMaxResultsFieldNumber = 2,
+  };
+  // repeated uint32 terms = 1;
+  int terms_size() const;
+  private:
+  int _internal_terms_size() const;
+  public:
+  void clear_terms();
+  private:
+  uint32_t _internal_terms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_terms() const;
+  void _internal_add_terms(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_terms();
+  public:
+  uint32_t terms(int index) const;
+  void set_terms(int index, uint32_t value);
+  void add_terms(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      terms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_terms();
+
+  // int32 max_results = 2;
+  void clear_max_results();
+  int32_t max_results() const;
+  void set_max_results(int32_t value);
+  private:
+  int32_t _internal_max_results() const;
+  void _internal_set_max_results(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.SearchQuery)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > terms_;
+    mutable std::atomic<int> _terms_cached_byte_size_;
+    int32_t max_results_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchSearchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.BatchSearchRequest) */ {
+ public:
+  inline BatchSearchRequest() : BatchSearchRequest(nullptr) {}
+  ~BatchSearchRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchSearchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchSearchRequest(const BatchSearchRequest& from);
+  BatchSearchRequest(BatchSearchRequest&& from) noexcept
+    : BatchSearchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchSearchRequest& operator=(const BatchSearchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchSearchRequest& operator=(BatchSearchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchSearchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchSearchRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchSearchRequest*>(
+               &_BatchSearchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(BatchSearchRequest& a, BatchSearchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchSearchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchSearchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchSearchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchSearchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchSearchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchSearchRequest& from) {
+    BatchSearchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchSearchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.BatchSearchRequest";
+  }
+  protected:
+  explicit BatchSearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueriesFieldNumber = 2,
+    kIndexNameFieldNumber = 1,
+    kAllowPartialResultsFieldNumber = 3,
+    kInterleavedFieldNumber = 4,
+  };
+  // repeated .Acoustid.Server.PB.SearchQuery queries = 2;
+  int queries_size() const;
+  private:
+  int _internal_queries_size() const;
+  public:
+  void clear_queries();
+  ::Acoustid::Server::PB::SearchQuery* mutable_queries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchQuery >*
+      mutable_queries();
+  private:
+  const ::Acoustid::Server::PB::SearchQuery& _internal_queries(int index) const;
+  ::Acoustid::Server::PB::SearchQuery* _internal_add_queries();
+  public:
+  const ::Acoustid::Server::PB::SearchQuery& queries(int index) const;
+  ::Acoustid::Server::PB::SearchQuery* add_queries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchQuery >&
+      queries() const;
+
+  // string index_name = 1;
+  void clear_index_name();
+  const std::string& index_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_index_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_name();
+  PROTOBUF_NODISCARD std::string* release_index_name();
+  void set_allocated_index_name(std::string* index_name);
+  private:
+  const std::string& _internal_index_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_name(const std::string& value);
+  std::string* _internal_mutable_index_name();
+  public:
+
+  // bool allow_partial_results = 3;
+  void clear_allow_partial_results();
+  bool allow_partial_results() const;
+  void set_allow_partial_results(bool value);
+  private:
+  bool _internal_allow_partial_results() const;
+  void _internal_set_allow_partial_results(bool value);
+  public:
+
+  // bool interleaved = 4;
+  void clear_interleaved();
+  bool interleaved() const;
+  void set_interleaved(bool value);
+  private:
+  bool _internal_interleaved() const;
+  void _internal_set_interleaved(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.BatchSearchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchQuery > queries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_name_;
+    bool allow_partial_results_;
+    bool interleaved_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchSearchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Acoustid.Server.PB.BatchSearchResponse) */ {
+ public:
+  inline BatchSearchResponse() : BatchSearchResponse(nullptr) {}
+  ~BatchSearchResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchSearchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchSearchResponse(const BatchSearchResponse& from);
+  BatchSearchResponse(BatchSearchResponse&& from) noexcept
+    : BatchSearchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchSearchResponse& operator=(const BatchSearchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchSearchResponse& operator=(BatchSearchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchSearchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchSearchResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchSearchResponse*>(
+               &_BatchSearchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(BatchSearchResponse& a, BatchSearchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchSearchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchSearchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchSearchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchSearchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchSearchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchSearchResponse& from) {
+    BatchSearchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchSearchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Acoustid.Server.PB.BatchSearchResponse";
+  }
+  protected:
+  explicit BatchSearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult > results_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_index_2eproto::TableStruct;
+  enum : int {
+    kResponsesFieldNumber = 1,
+    kPartialFieldNumber = 2,
+  };
+  // repeated .Acoustid.Server.PB.SearchResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::Acoustid::Server::PB::SearchResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResponse >*
+      mutable_responses();
+  private:
+  const ::Acoustid::Server::PB::SearchResponse& _internal_responses(int index) const;
+  ::Acoustid::Server::PB::SearchResponse* _internal_add_responses();
+  public:
+  const ::Acoustid::Server::PB::SearchResponse& responses(int index) const;
+  ::Acoustid::Server::PB::SearchResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResponse >&
+      responses() const;
+
+  // bool partial = 2;
+  void clear_partial();
+  bool partial() const;
+  void set_partial(bool value);
+  private:
+  bool _internal_partial() const;
+  void _internal_set_partial(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Acoustid.Server.PB.BatchSearchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResponse > responses_;
+    bool partial_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_index_2eproto;
 };
 // ===================================================================
 
@@ -1661,68 +3109,71 @@ class SearchResponse : public ::google::protobuf::Message /* @@protoc_insertion_
 
 // string index_name = 1;
 inline void GetDocumentRequest::clear_index_name() {
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.index_name_.ClearToEmpty();
 }
-inline const ::std::string& GetDocumentRequest::index_name() const {
+inline const std::string& GetDocumentRequest::index_name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetDocumentRequest.index_name)
-  return index_name_.GetNoArena();
+  return _internal_index_name();
 }
-inline void GetDocumentRequest::set_index_name(const ::std::string& value) {
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetDocumentRequest::set_index_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.index_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetDocumentRequest.index_name)
 }
-#if LANG_CXX11
-inline void GetDocumentRequest::set_index_name(::std::string&& value) {
-  
-  index_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.GetDocumentRequest.index_name)
+inline std::string* GetDocumentRequest::mutable_index_name() {
+  std::string* _s = _internal_mutable_index_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetDocumentRequest.index_name)
+  return _s;
 }
-#endif
-inline void GetDocumentRequest::set_index_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.GetDocumentRequest.index_name)
+inline const std::string& GetDocumentRequest::_internal_index_name() const {
+  return _impl_.index_name_.Get();
 }
-inline void GetDocumentRequest::set_index_name(const char* value, size_t size) {
+inline void GetDocumentRequest::_internal_set_index_name(const std::string& value) {
   
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.GetDocumentRequest.index_name)
+  _impl_.index_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetDocumentRequest::mutable_index_name() {
+inline std::string* GetDocumentRequest::_internal_mutable_index_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetDocumentRequest.index_name)
-  return index_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GetDocumentRequest::release_index_name() {
+inline std::string* GetDocumentRequest::release_index_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.GetDocumentRequest.index_name)
-  
-  return index_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Release();
 }
-inline void GetDocumentRequest::set_allocated_index_name(::std::string* index_name) {
-  if (index_name != NULL) {
+inline void GetDocumentRequest::set_allocated_index_name(std::string* index_name) {
+  if (index_name != nullptr) {
     
   } else {
     
   }
-  index_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), index_name);
+  _impl_.index_name_.SetAllocated(index_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.index_name_.IsDefault()) {
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.GetDocumentRequest.index_name)
 }
 
 // uint32 doc_id = 2;
 inline void GetDocumentRequest::clear_doc_id() {
-  doc_id_ = 0u;
+  _impl_.doc_id_ = 0u;
+}
+inline uint32_t GetDocumentRequest::_internal_doc_id() const {
+  return _impl_.doc_id_;
 }
-inline ::google::protobuf::uint32 GetDocumentRequest::doc_id() const {
+inline uint32_t GetDocumentRequest::doc_id() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetDocumentRequest.doc_id)
-  return doc_id_;
+  return _internal_doc_id();
 }
-inline void GetDocumentRequest::set_doc_id(::google::protobuf::uint32 value) {
+inline void GetDocumentRequest::_internal_set_doc_id(uint32_t value) {
   
-  doc_id_ = value;
+  _impl_.doc_id_ = value;
+}
+inline void GetDocumentRequest::set_doc_id(uint32_t value) {
+  _internal_set_doc_id(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetDocumentRequest.doc_id)
 }
 
@@ -1731,33 +3182,50 @@ inline void GetDocumentRequest::set_doc_id(::google::protobuf::uint32 value) {
 // GetDocumentResponse
 
 // repeated uint32 terms = 2;
+inline int GetDocumentResponse::_internal_terms_size() const {
+  return _impl_.terms_.size();
+}
 inline int GetDocumentResponse::terms_size() const {
-  return terms_.size();
+  return _internal_terms_size();
 }
 inline void GetDocumentResponse::clear_terms() {
-  terms_.Clear();
+  _impl_.terms_.Clear();
+}
+inline uint32_t GetDocumentResponse::_internal_terms(int index) const {
+  return _impl_.terms_.Get(index);
 }
-inline ::google::protobuf::uint32 GetDocumentResponse::terms(int index) const {
+inline uint32_t GetDocumentResponse::terms(int index) const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetDocumentResponse.terms)
-  return terms_.Get(index);
+  return _internal_terms(index);
 }
-inline void GetDocumentResponse::set_terms(int index, ::google::protobuf::uint32 value) {
-  terms_.Set(index, value);
+inline void GetDocumentResponse::set_terms(int index, uint32_t value) {
+  _impl_.terms_.Set(index, value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetDocumentResponse.terms)
 }
-inline void GetDocumentResponse::add_terms(::google::protobuf::uint32 value) {
-  terms_.Add(value);
+inline void GetDocumentResponse::_internal_add_terms(uint32_t value) {
+  _impl_.terms_.Add(value);
+}
+inline void GetDocumentResponse::add_terms(uint32_t value) {
+  _internal_add_terms(value);
   // @@protoc_insertion_point(field_add:Acoustid.Server.PB.GetDocumentResponse.terms)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GetDocumentResponse::_internal_terms() const {
+  return _impl_.terms_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 GetDocumentResponse::terms() const {
   // @@protoc_insertion_point(field_list:Acoustid.Server.PB.GetDocumentResponse.terms)
-  return terms_;
+  return _internal_terms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GetDocumentResponse::_internal_mutable_terms() {
+  return &_impl_.terms_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 GetDocumentResponse::mutable_terms() {
   // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.GetDocumentResponse.terms)
-  return &terms_;
+  return _internal_mutable_terms();
 }
 
 // -------------------------------------------------------------------
@@ -1766,107 +3234,101 @@ GetDocumentResponse::mutable_terms() {
 
 // string index_name = 1;
 inline void GetAttributeRequest::clear_index_name() {
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.index_name_.ClearToEmpty();
 }
-inline const ::std::string& GetAttributeRequest::index_name() const {
+inline const std::string& GetAttributeRequest::index_name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetAttributeRequest.index_name)
-  return index_name_.GetNoArena();
+  return _internal_index_name();
 }
-inline void GetAttributeRequest::set_index_name(const ::std::string& value) {
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAttributeRequest::set_index_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.index_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetAttributeRequest.index_name)
 }
-#if LANG_CXX11
-inline void GetAttributeRequest::set_index_name(::std::string&& value) {
-  
-  index_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.GetAttributeRequest.index_name)
+inline std::string* GetAttributeRequest::mutable_index_name() {
+  std::string* _s = _internal_mutable_index_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeRequest.index_name)
+  return _s;
 }
-#endif
-inline void GetAttributeRequest::set_index_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.GetAttributeRequest.index_name)
+inline const std::string& GetAttributeRequest::_internal_index_name() const {
+  return _impl_.index_name_.Get();
 }
-inline void GetAttributeRequest::set_index_name(const char* value, size_t size) {
+inline void GetAttributeRequest::_internal_set_index_name(const std::string& value) {
   
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.GetAttributeRequest.index_name)
+  _impl_.index_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeRequest::mutable_index_name() {
+inline std::string* GetAttributeRequest::_internal_mutable_index_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeRequest.index_name)
-  return index_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeRequest::release_index_name() {
+inline std::string* GetAttributeRequest::release_index_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.GetAttributeRequest.index_name)
-  
-  return index_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Release();
 }
-inline void GetAttributeRequest::set_allocated_index_name(::std::string* index_name) {
-  if (index_name != NULL) {
+inline void GetAttributeRequest::set_allocated_index_name(std::string* index_name) {
+  if (index_name != nullptr) {
     
   } else {
     
   }
-  index_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), index_name);
+  _impl_.index_name_.SetAllocated(index_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.index_name_.IsDefault()) {
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.GetAttributeRequest.index_name)
 }
 
 // string name = 2;
 inline void GetAttributeRequest::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& GetAttributeRequest::name() const {
+inline const std::string& GetAttributeRequest::name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetAttributeRequest.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void GetAttributeRequest::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAttributeRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetAttributeRequest.name)
 }
-#if LANG_CXX11
-inline void GetAttributeRequest::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.GetAttributeRequest.name)
+inline std::string* GetAttributeRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeRequest.name)
+  return _s;
 }
-#endif
-inline void GetAttributeRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.GetAttributeRequest.name)
+inline const std::string& GetAttributeRequest::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void GetAttributeRequest::set_name(const char* value, size_t size) {
+inline void GetAttributeRequest::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.GetAttributeRequest.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeRequest::mutable_name() {
+inline std::string* GetAttributeRequest::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeRequest.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeRequest::release_name() {
+inline std::string* GetAttributeRequest::release_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.GetAttributeRequest.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void GetAttributeRequest::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void GetAttributeRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.GetAttributeRequest.name)
 }
 
@@ -1876,54 +3338,51 @@ inline void GetAttributeRequest::set_allocated_name(::std::string* name) {
 
 // string value = 2;
 inline void GetAttributeResponse::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.ClearToEmpty();
 }
-inline const ::std::string& GetAttributeResponse::value() const {
+inline const std::string& GetAttributeResponse::value() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.GetAttributeResponse.value)
-  return value_.GetNoArena();
+  return _internal_value();
 }
-inline void GetAttributeResponse::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetAttributeResponse::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.GetAttributeResponse.value)
 }
-#if LANG_CXX11
-inline void GetAttributeResponse::set_value(::std::string&& value) {
-  
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.GetAttributeResponse.value)
+inline std::string* GetAttributeResponse::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeResponse.value)
+  return _s;
 }
-#endif
-inline void GetAttributeResponse::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.GetAttributeResponse.value)
+inline const std::string& GetAttributeResponse::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void GetAttributeResponse::set_value(const char* value, size_t size) {
+inline void GetAttributeResponse::_internal_set_value(const std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.GetAttributeResponse.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeResponse::mutable_value() {
+inline std::string* GetAttributeResponse::_internal_mutable_value() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.GetAttributeResponse.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* GetAttributeResponse::release_value() {
+inline std::string* GetAttributeResponse::release_value() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.GetAttributeResponse.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Release();
 }
-inline void GetAttributeResponse::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void GetAttributeResponse::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.GetAttributeResponse.value)
 }
 
@@ -1933,46 +3392,69 @@ inline void GetAttributeResponse::set_allocated_value(::std::string* value) {
 
 // uint32 doc_id = 1;
 inline void InsertOrUpdateDocumentOp::clear_doc_id() {
-  doc_id_ = 0u;
+  _impl_.doc_id_ = 0u;
 }
-inline ::google::protobuf::uint32 InsertOrUpdateDocumentOp::doc_id() const {
+inline uint32_t InsertOrUpdateDocumentOp::_internal_doc_id() const {
+  return _impl_.doc_id_;
+}
+inline uint32_t InsertOrUpdateDocumentOp::doc_id() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.InsertOrUpdateDocumentOp.doc_id)
-  return doc_id_;
+  return _internal_doc_id();
 }
-inline void InsertOrUpdateDocumentOp::set_doc_id(::google::protobuf::uint32 value) {
+inline void InsertOrUpdateDocumentOp::_internal_set_doc_id(uint32_t value) {
   
-  doc_id_ = value;
+  _impl_.doc_id_ = value;
+}
+inline void InsertOrUpdateDocumentOp::set_doc_id(uint32_t value) {
+  _internal_set_doc_id(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.InsertOrUpdateDocumentOp.doc_id)
 }
 
 // repeated uint32 terms = 2;
+inline int InsertOrUpdateDocumentOp::_internal_terms_size() const {
+  return _impl_.terms_.size();
+}
 inline int InsertOrUpdateDocumentOp::terms_size() const {
-  return terms_.size();
+  return _internal_terms_size();
 }
 inline void InsertOrUpdateDocumentOp::clear_terms() {
-  terms_.Clear();
+  _impl_.terms_.Clear();
 }
-inline ::google::protobuf::uint32 InsertOrUpdateDocumentOp::terms(int index) const {
+inline uint32_t InsertOrUpdateDocumentOp::_internal_terms(int index) const {
+  return _impl_.terms_.Get(index);
+}
+inline uint32_t InsertOrUpdateDocumentOp::terms(int index) const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.InsertOrUpdateDocumentOp.terms)
-  return terms_.Get(index);
+  return _internal_terms(index);
 }
-inline void InsertOrUpdateDocumentOp::set_terms(int index, ::google::protobuf::uint32 value) {
-  terms_.Set(index, value);
+inline void InsertOrUpdateDocumentOp::set_terms(int index, uint32_t value) {
+  _impl_.terms_.Set(index, value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.InsertOrUpdateDocumentOp.terms)
 }
-inline void InsertOrUpdateDocumentOp::add_terms(::google::protobuf::uint32 value) {
-  terms_.Add(value);
+inline void InsertOrUpdateDocumentOp::_internal_add_terms(uint32_t value) {
+  _impl_.terms_.Add(value);
+}
+inline void InsertOrUpdateDocumentOp::add_terms(uint32_t value) {
+  _internal_add_terms(value);
   // @@protoc_insertion_point(field_add:Acoustid.Server.PB.InsertOrUpdateDocumentOp.terms)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+InsertOrUpdateDocumentOp::_internal_terms() const {
+  return _impl_.terms_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 InsertOrUpdateDocumentOp::terms() const {
   // @@protoc_insertion_point(field_list:Acoustid.Server.PB.InsertOrUpdateDocumentOp.terms)
-  return terms_;
+  return _internal_terms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+InsertOrUpdateDocumentOp::_internal_mutable_terms() {
+  return &_impl_.terms_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 InsertOrUpdateDocumentOp::mutable_terms() {
   // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.InsertOrUpdateDocumentOp.terms)
-  return &terms_;
+  return _internal_mutable_terms();
 }
 
 // -------------------------------------------------------------------
@@ -1981,15 +3463,21 @@ InsertOrUpdateDocumentOp::mutable_terms() {
 
 // uint32 doc_id = 1;
 inline void DeleteDocumentOp::clear_doc_id() {
-  doc_id_ = 0u;
+  _impl_.doc_id_ = 0u;
+}
+inline uint32_t DeleteDocumentOp::_internal_doc_id() const {
+  return _impl_.doc_id_;
 }
-inline ::google::protobuf::uint32 DeleteDocumentOp::doc_id() const {
+inline uint32_t DeleteDocumentOp::doc_id() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.DeleteDocumentOp.doc_id)
-  return doc_id_;
+  return _internal_doc_id();
 }
-inline void DeleteDocumentOp::set_doc_id(::google::protobuf::uint32 value) {
+inline void DeleteDocumentOp::_internal_set_doc_id(uint32_t value) {
   
-  doc_id_ = value;
+  _impl_.doc_id_ = value;
+}
+inline void DeleteDocumentOp::set_doc_id(uint32_t value) {
+  _internal_set_doc_id(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.DeleteDocumentOp.doc_id)
 }
 
@@ -1999,107 +3487,101 @@ inline void DeleteDocumentOp::set_doc_id(::google::protobuf::uint32 value) {
 
 // string name = 1;
 inline void SetAttributeOp::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& SetAttributeOp::name() const {
+inline const std::string& SetAttributeOp::name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SetAttributeOp.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void SetAttributeOp::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetAttributeOp::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SetAttributeOp.name)
 }
-#if LANG_CXX11
-inline void SetAttributeOp::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.SetAttributeOp.name)
+inline std::string* SetAttributeOp::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SetAttributeOp.name)
+  return _s;
 }
-#endif
-inline void SetAttributeOp::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.SetAttributeOp.name)
+inline const std::string& SetAttributeOp::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void SetAttributeOp::set_name(const char* value, size_t size) {
+inline void SetAttributeOp::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.SetAttributeOp.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SetAttributeOp::mutable_name() {
+inline std::string* SetAttributeOp::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SetAttributeOp.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SetAttributeOp::release_name() {
+inline std::string* SetAttributeOp::release_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.SetAttributeOp.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void SetAttributeOp::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void SetAttributeOp::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.SetAttributeOp.name)
 }
 
 // string value = 2;
 inline void SetAttributeOp::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.ClearToEmpty();
 }
-inline const ::std::string& SetAttributeOp::value() const {
+inline const std::string& SetAttributeOp::value() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SetAttributeOp.value)
-  return value_.GetNoArena();
+  return _internal_value();
 }
-inline void SetAttributeOp::set_value(const ::std::string& value) {
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SetAttributeOp::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SetAttributeOp.value)
 }
-#if LANG_CXX11
-inline void SetAttributeOp::set_value(::std::string&& value) {
-  
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.SetAttributeOp.value)
+inline std::string* SetAttributeOp::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SetAttributeOp.value)
+  return _s;
 }
-#endif
-inline void SetAttributeOp::set_value(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.SetAttributeOp.value)
+inline const std::string& SetAttributeOp::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void SetAttributeOp::set_value(const char* value, size_t size) {
+inline void SetAttributeOp::_internal_set_value(const std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.SetAttributeOp.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SetAttributeOp::mutable_value() {
+inline std::string* SetAttributeOp::_internal_mutable_value() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SetAttributeOp.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SetAttributeOp::release_value() {
+inline std::string* SetAttributeOp::release_value() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.SetAttributeOp.value)
-  
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Release();
 }
-inline void SetAttributeOp::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void SetAttributeOp::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.SetAttributeOp.value)
 }
 
@@ -2108,145 +3590,235 @@ inline void SetAttributeOp::set_allocated_value(::std::string* value) {
 // Operation
 
 // .Acoustid.Server.PB.InsertOrUpdateDocumentOp insert_or_update_document = 1;
-inline bool Operation::has_insert_or_update_document() const {
+inline bool Operation::_internal_has_insert_or_update_document() const {
   return op_case() == kInsertOrUpdateDocument;
 }
+inline bool Operation::has_insert_or_update_document() const {
+  return _internal_has_insert_or_update_document();
+}
 inline void Operation::set_has_insert_or_update_document() {
-  _oneof_case_[0] = kInsertOrUpdateDocument;
+  _impl_._oneof_case_[0] = kInsertOrUpdateDocument;
 }
 inline void Operation::clear_insert_or_update_document() {
-  if (has_insert_or_update_document()) {
-    delete op_.insert_or_update_document_;
+  if (_internal_has_insert_or_update_document()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.insert_or_update_document_;
+    }
     clear_has_op();
   }
 }
-inline const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& Operation::_internal_insert_or_update_document() const {
-  return *op_.insert_or_update_document_;
-}
 inline ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Operation::release_insert_or_update_document() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.Operation.insert_or_update_document)
-  if (has_insert_or_update_document()) {
+  if (_internal_has_insert_or_update_document()) {
     clear_has_op();
-      ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* temp = op_.insert_or_update_document_;
-    op_.insert_or_update_document_ = NULL;
+    ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* temp = _impl_.op_.insert_or_update_document_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.insert_or_update_document_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& Operation::_internal_insert_or_update_document() const {
+  return _internal_has_insert_or_update_document()
+      ? *_impl_.op_.insert_or_update_document_
+      : reinterpret_cast< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp&>(::Acoustid::Server::PB::_InsertOrUpdateDocumentOp_default_instance_);
+}
 inline const ::Acoustid::Server::PB::InsertOrUpdateDocumentOp& Operation::insert_or_update_document() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.Operation.insert_or_update_document)
-  return has_insert_or_update_document()
-      ? *op_.insert_or_update_document_
-      : *reinterpret_cast< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp*>(&::Acoustid::Server::PB::_InsertOrUpdateDocumentOp_default_instance_);
+  return _internal_insert_or_update_document();
 }
-inline ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Operation::mutable_insert_or_update_document() {
-  if (!has_insert_or_update_document()) {
+inline ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Operation::unsafe_arena_release_insert_or_update_document() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Acoustid.Server.PB.Operation.insert_or_update_document)
+  if (_internal_has_insert_or_update_document()) {
+    clear_has_op();
+    ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* temp = _impl_.op_.insert_or_update_document_;
+    _impl_.op_.insert_or_update_document_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Operation::unsafe_arena_set_allocated_insert_or_update_document(::Acoustid::Server::PB::InsertOrUpdateDocumentOp* insert_or_update_document) {
+  clear_op();
+  if (insert_or_update_document) {
+    set_has_insert_or_update_document();
+    _impl_.op_.insert_or_update_document_ = insert_or_update_document;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Acoustid.Server.PB.Operation.insert_or_update_document)
+}
+inline ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Operation::_internal_mutable_insert_or_update_document() {
+  if (!_internal_has_insert_or_update_document()) {
     clear_op();
     set_has_insert_or_update_document();
-    op_.insert_or_update_document_ = CreateMaybeMessage< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(
-        GetArenaNoVirtual());
+    _impl_.op_.insert_or_update_document_ = CreateMaybeMessage< ::Acoustid::Server::PB::InsertOrUpdateDocumentOp >(GetArenaForAllocation());
   }
+  return _impl_.op_.insert_or_update_document_;
+}
+inline ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* Operation::mutable_insert_or_update_document() {
+  ::Acoustid::Server::PB::InsertOrUpdateDocumentOp* _msg = _internal_mutable_insert_or_update_document();
   // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.Operation.insert_or_update_document)
-  return op_.insert_or_update_document_;
+  return _msg;
 }
 
 // .Acoustid.Server.PB.DeleteDocumentOp delete_document = 2;
-inline bool Operation::has_delete_document() const {
+inline bool Operation::_internal_has_delete_document() const {
   return op_case() == kDeleteDocument;
 }
+inline bool Operation::has_delete_document() const {
+  return _internal_has_delete_document();
+}
 inline void Operation::set_has_delete_document() {
-  _oneof_case_[0] = kDeleteDocument;
+  _impl_._oneof_case_[0] = kDeleteDocument;
 }
 inline void Operation::clear_delete_document() {
-  if (has_delete_document()) {
-    delete op_.delete_document_;
+  if (_internal_has_delete_document()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.delete_document_;
+    }
     clear_has_op();
   }
 }
-inline const ::Acoustid::Server::PB::DeleteDocumentOp& Operation::_internal_delete_document() const {
-  return *op_.delete_document_;
-}
 inline ::Acoustid::Server::PB::DeleteDocumentOp* Operation::release_delete_document() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.Operation.delete_document)
-  if (has_delete_document()) {
+  if (_internal_has_delete_document()) {
     clear_has_op();
-      ::Acoustid::Server::PB::DeleteDocumentOp* temp = op_.delete_document_;
-    op_.delete_document_ = NULL;
+    ::Acoustid::Server::PB::DeleteDocumentOp* temp = _impl_.op_.delete_document_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.delete_document_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::Acoustid::Server::PB::DeleteDocumentOp& Operation::_internal_delete_document() const {
+  return _internal_has_delete_document()
+      ? *_impl_.op_.delete_document_
+      : reinterpret_cast< ::Acoustid::Server::PB::DeleteDocumentOp&>(::Acoustid::Server::PB::_DeleteDocumentOp_default_instance_);
+}
 inline const ::Acoustid::Server::PB::DeleteDocumentOp& Operation::delete_document() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.Operation.delete_document)
-  return has_delete_document()
-      ? *op_.delete_document_
-      : *reinterpret_cast< ::Acoustid::Server::PB::DeleteDocumentOp*>(&::Acoustid::Server::PB::_DeleteDocumentOp_default_instance_);
+  return _internal_delete_document();
 }
-inline ::Acoustid::Server::PB::DeleteDocumentOp* Operation::mutable_delete_document() {
-  if (!has_delete_document()) {
+inline ::Acoustid::Server::PB::DeleteDocumentOp* Operation::unsafe_arena_release_delete_document() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Acoustid.Server.PB.Operation.delete_document)
+  if (_internal_has_delete_document()) {
+    clear_has_op();
+    ::Acoustid::Server::PB::DeleteDocumentOp* temp = _impl_.op_.delete_document_;
+    _impl_.op_.delete_document_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Operation::unsafe_arena_set_allocated_delete_document(::Acoustid::Server::PB::DeleteDocumentOp* delete_document) {
+  clear_op();
+  if (delete_document) {
+    set_has_delete_document();
+    _impl_.op_.delete_document_ = delete_document;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Acoustid.Server.PB.Operation.delete_document)
+}
+inline ::Acoustid::Server::PB::DeleteDocumentOp* Operation::_internal_mutable_delete_document() {
+  if (!_internal_has_delete_document()) {
     clear_op();
     set_has_delete_document();
-    op_.delete_document_ = CreateMaybeMessage< ::Acoustid::Server::PB::DeleteDocumentOp >(
-        GetArenaNoVirtual());
+    _impl_.op_.delete_document_ = CreateMaybeMessage< ::Acoustid::Server::PB::DeleteDocumentOp >(GetArenaForAllocation());
   }
+  return _impl_.op_.delete_document_;
+}
+inline ::Acoustid::Server::PB::DeleteDocumentOp* Operation::mutable_delete_document() {
+  ::Acoustid::Server::PB::DeleteDocumentOp* _msg = _internal_mutable_delete_document();
   // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.Operation.delete_document)
-  return op_.delete_document_;
+  return _msg;
 }
 
 // .Acoustid.Server.PB.SetAttributeOp set_attribute = 3;
-inline bool Operation::has_set_attribute() const {
+inline bool Operation::_internal_has_set_attribute() const {
   return op_case() == kSetAttribute;
 }
+inline bool Operation::has_set_attribute() const {
+  return _internal_has_set_attribute();
+}
 inline void Operation::set_has_set_attribute() {
-  _oneof_case_[0] = kSetAttribute;
+  _impl_._oneof_case_[0] = kSetAttribute;
 }
 inline void Operation::clear_set_attribute() {
-  if (has_set_attribute()) {
-    delete op_.set_attribute_;
+  if (_internal_has_set_attribute()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.op_.set_attribute_;
+    }
     clear_has_op();
   }
 }
+inline ::Acoustid::Server::PB::SetAttributeOp* Operation::release_set_attribute() {
+  // @@protoc_insertion_point(field_release:Acoustid.Server.PB.Operation.set_attribute)
+  if (_internal_has_set_attribute()) {
+    clear_has_op();
+    ::Acoustid::Server::PB::SetAttributeOp* temp = _impl_.op_.set_attribute_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.op_.set_attribute_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
 inline const ::Acoustid::Server::PB::SetAttributeOp& Operation::_internal_set_attribute() const {
-  return *op_.set_attribute_;
+  return _internal_has_set_attribute()
+      ? *_impl_.op_.set_attribute_
+      : reinterpret_cast< ::Acoustid::Server::PB::SetAttributeOp&>(::Acoustid::Server::PB::_SetAttributeOp_default_instance_);
+}
+inline const ::Acoustid::Server::PB::SetAttributeOp& Operation::set_attribute() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.Operation.set_attribute)
+  return _internal_set_attribute();
 }
-inline ::Acoustid::Server::PB::SetAttributeOp* Operation::release_set_attribute() {
-  // @@protoc_insertion_point(field_release:Acoustid.Server.PB.Operation.set_attribute)
-  if (has_set_attribute()) {
+inline ::Acoustid::Server::PB::SetAttributeOp* Operation::unsafe_arena_release_set_attribute() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Acoustid.Server.PB.Operation.set_attribute)
+  if (_internal_has_set_attribute()) {
     clear_has_op();
-      ::Acoustid::Server::PB::SetAttributeOp* temp = op_.set_attribute_;
-    op_.set_attribute_ = NULL;
+    ::Acoustid::Server::PB::SetAttributeOp* temp = _impl_.op_.set_attribute_;
+    _impl_.op_.set_attribute_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
-inline const ::Acoustid::Server::PB::SetAttributeOp& Operation::set_attribute() const {
-  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.Operation.set_attribute)
-  return has_set_attribute()
-      ? *op_.set_attribute_
-      : *reinterpret_cast< ::Acoustid::Server::PB::SetAttributeOp*>(&::Acoustid::Server::PB::_SetAttributeOp_default_instance_);
+inline void Operation::unsafe_arena_set_allocated_set_attribute(::Acoustid::Server::PB::SetAttributeOp* set_attribute) {
+  clear_op();
+  if (set_attribute) {
+    set_has_set_attribute();
+    _impl_.op_.set_attribute_ = set_attribute;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Acoustid.Server.PB.Operation.set_attribute)
 }
-inline ::Acoustid::Server::PB::SetAttributeOp* Operation::mutable_set_attribute() {
-  if (!has_set_attribute()) {
+inline ::Acoustid::Server::PB::SetAttributeOp* Operation::_internal_mutable_set_attribute() {
+  if (!_internal_has_set_attribute()) {
     clear_op();
     set_has_set_attribute();
-    op_.set_attribute_ = CreateMaybeMessage< ::Acoustid::Server::PB::SetAttributeOp >(
-        GetArenaNoVirtual());
+    _impl_.op_.set_attribute_ = CreateMaybeMessage< ::Acoustid::Server::PB::SetAttributeOp >(GetArenaForAllocation());
   }
+  return _impl_.op_.set_attribute_;
+}
+inline ::Acoustid::Server::PB::SetAttributeOp* Operation::mutable_set_attribute() {
+  ::Acoustid::Server::PB::SetAttributeOp* _msg = _internal_mutable_set_attribute();
   // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.Operation.set_attribute)
-  return op_.set_attribute_;
+  return _msg;
 }
 
 inline bool Operation::has_op() const {
   return op_case() != OP_NOT_SET;
 }
 inline void Operation::clear_has_op() {
-  _oneof_case_[0] = OP_NOT_SET;
+  _impl_._oneof_case_[0] = OP_NOT_SET;
 }
 inline Operation::OpCase Operation::op_case() const {
-  return Operation::OpCase(_oneof_case_[0]);
+  return Operation::OpCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -2254,85 +3826,92 @@ inline Operation::OpCase Operation::op_case() const {
 
 // string index_name = 1;
 inline void UpdateRequest::clear_index_name() {
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.index_name_.ClearToEmpty();
 }
-inline const ::std::string& UpdateRequest::index_name() const {
+inline const std::string& UpdateRequest::index_name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.UpdateRequest.index_name)
-  return index_name_.GetNoArena();
+  return _internal_index_name();
 }
-inline void UpdateRequest::set_index_name(const ::std::string& value) {
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateRequest::set_index_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.index_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.UpdateRequest.index_name)
 }
-#if LANG_CXX11
-inline void UpdateRequest::set_index_name(::std::string&& value) {
-  
-  index_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.UpdateRequest.index_name)
+inline std::string* UpdateRequest::mutable_index_name() {
+  std::string* _s = _internal_mutable_index_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.UpdateRequest.index_name)
+  return _s;
 }
-#endif
-inline void UpdateRequest::set_index_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.UpdateRequest.index_name)
+inline const std::string& UpdateRequest::_internal_index_name() const {
+  return _impl_.index_name_.Get();
 }
-inline void UpdateRequest::set_index_name(const char* value, size_t size) {
+inline void UpdateRequest::_internal_set_index_name(const std::string& value) {
   
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.UpdateRequest.index_name)
+  _impl_.index_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* UpdateRequest::mutable_index_name() {
+inline std::string* UpdateRequest::_internal_mutable_index_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.UpdateRequest.index_name)
-  return index_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* UpdateRequest::release_index_name() {
+inline std::string* UpdateRequest::release_index_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.UpdateRequest.index_name)
-  
-  return index_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Release();
 }
-inline void UpdateRequest::set_allocated_index_name(::std::string* index_name) {
-  if (index_name != NULL) {
+inline void UpdateRequest::set_allocated_index_name(std::string* index_name) {
+  if (index_name != nullptr) {
     
   } else {
     
   }
-  index_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), index_name);
+  _impl_.index_name_.SetAllocated(index_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.index_name_.IsDefault()) {
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.UpdateRequest.index_name)
 }
 
 // repeated .Acoustid.Server.PB.Operation ops = 2;
+inline int UpdateRequest::_internal_ops_size() const {
+  return _impl_.ops_.size();
+}
 inline int UpdateRequest::ops_size() const {
-  return ops_.size();
+  return _internal_ops_size();
 }
 inline void UpdateRequest::clear_ops() {
-  ops_.Clear();
+  _impl_.ops_.Clear();
 }
 inline ::Acoustid::Server::PB::Operation* UpdateRequest::mutable_ops(int index) {
   // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.UpdateRequest.ops)
-  return ops_.Mutable(index);
+  return _impl_.ops_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::Operation >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::Operation >*
 UpdateRequest::mutable_ops() {
   // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.UpdateRequest.ops)
-  return &ops_;
+  return &_impl_.ops_;
+}
+inline const ::Acoustid::Server::PB::Operation& UpdateRequest::_internal_ops(int index) const {
+  return _impl_.ops_.Get(index);
 }
 inline const ::Acoustid::Server::PB::Operation& UpdateRequest::ops(int index) const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.UpdateRequest.ops)
-  return ops_.Get(index);
+  return _internal_ops(index);
+}
+inline ::Acoustid::Server::PB::Operation* UpdateRequest::_internal_add_ops() {
+  return _impl_.ops_.Add();
 }
 inline ::Acoustid::Server::PB::Operation* UpdateRequest::add_ops() {
+  ::Acoustid::Server::PB::Operation* _add = _internal_add_ops();
   // @@protoc_insertion_point(field_add:Acoustid.Server.PB.UpdateRequest.ops)
-  return ops_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::Operation >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::Operation >&
 UpdateRequest::ops() const {
   // @@protoc_insertion_point(field_list:Acoustid.Server.PB.UpdateRequest.ops)
-  return ops_;
+  return _impl_.ops_;
 }
 
 // -------------------------------------------------------------------
@@ -2345,165 +3924,820 @@ UpdateRequest::ops() const {
 
 // uint32 doc_id = 1;
 inline void SearchResult::clear_doc_id() {
-  doc_id_ = 0u;
+  _impl_.doc_id_ = 0u;
+}
+inline uint32_t SearchResult::_internal_doc_id() const {
+  return _impl_.doc_id_;
 }
-inline ::google::protobuf::uint32 SearchResult::doc_id() const {
+inline uint32_t SearchResult::doc_id() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchResult.doc_id)
-  return doc_id_;
+  return _internal_doc_id();
 }
-inline void SearchResult::set_doc_id(::google::protobuf::uint32 value) {
+inline void SearchResult::_internal_set_doc_id(uint32_t value) {
   
-  doc_id_ = value;
+  _impl_.doc_id_ = value;
+}
+inline void SearchResult::set_doc_id(uint32_t value) {
+  _internal_set_doc_id(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchResult.doc_id)
 }
 
 // float score = 2;
 inline void SearchResult::clear_score() {
-  score_ = 0;
+  _impl_.score_ = 0;
+}
+inline float SearchResult::_internal_score() const {
+  return _impl_.score_;
 }
 inline float SearchResult::score() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchResult.score)
-  return score_;
+  return _internal_score();
 }
-inline void SearchResult::set_score(float value) {
+inline void SearchResult::_internal_set_score(float value) {
   
-  score_ = value;
+  _impl_.score_ = value;
+}
+inline void SearchResult::set_score(float value) {
+  _internal_set_score(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchResult.score)
 }
 
 // -------------------------------------------------------------------
 
+// DocumentFilter
+
+// uint32 min_id = 1;
+inline void DocumentFilter::clear_min_id() {
+  _impl_.min_id_ = 0u;
+}
+inline uint32_t DocumentFilter::_internal_min_id() const {
+  return _impl_.min_id_;
+}
+inline uint32_t DocumentFilter::min_id() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.DocumentFilter.min_id)
+  return _internal_min_id();
+}
+inline void DocumentFilter::_internal_set_min_id(uint32_t value) {
+  
+  _impl_.min_id_ = value;
+}
+inline void DocumentFilter::set_min_id(uint32_t value) {
+  _internal_set_min_id(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.DocumentFilter.min_id)
+}
+
+// uint32 max_id = 2;
+inline void DocumentFilter::clear_max_id() {
+  _impl_.max_id_ = 0u;
+}
+inline uint32_t DocumentFilter::_internal_max_id() const {
+  return _impl_.max_id_;
+}
+inline uint32_t DocumentFilter::max_id() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.DocumentFilter.max_id)
+  return _internal_max_id();
+}
+inline void DocumentFilter::_internal_set_max_id(uint32_t value) {
+  
+  _impl_.max_id_ = value;
+}
+inline void DocumentFilter::set_max_id(uint32_t value) {
+  _internal_set_max_id(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.DocumentFilter.max_id)
+}
+
+// bytes bitmap = 3;
+inline void DocumentFilter::clear_bitmap() {
+  _impl_.bitmap_.ClearToEmpty();
+}
+inline const std::string& DocumentFilter::bitmap() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.DocumentFilter.bitmap)
+  return _internal_bitmap();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DocumentFilter::set_bitmap(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.bitmap_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.DocumentFilter.bitmap)
+}
+inline std::string* DocumentFilter::mutable_bitmap() {
+  std::string* _s = _internal_mutable_bitmap();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.DocumentFilter.bitmap)
+  return _s;
+}
+inline const std::string& DocumentFilter::_internal_bitmap() const {
+  return _impl_.bitmap_.Get();
+}
+inline void DocumentFilter::_internal_set_bitmap(const std::string& value) {
+  
+  _impl_.bitmap_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DocumentFilter::_internal_mutable_bitmap() {
+  
+  return _impl_.bitmap_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DocumentFilter::release_bitmap() {
+  // @@protoc_insertion_point(field_release:Acoustid.Server.PB.DocumentFilter.bitmap)
+  return _impl_.bitmap_.Release();
+}
+inline void DocumentFilter::set_allocated_bitmap(std::string* bitmap) {
+  if (bitmap != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.bitmap_.SetAllocated(bitmap, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bitmap_.IsDefault()) {
+    _impl_.bitmap_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.DocumentFilter.bitmap)
+}
+
+// -------------------------------------------------------------------
+
 // SearchRequest
 
 // string index_name = 1;
 inline void SearchRequest::clear_index_name() {
-  index_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.index_name_.ClearToEmpty();
 }
-inline const ::std::string& SearchRequest::index_name() const {
+inline const std::string& SearchRequest::index_name() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.index_name)
-  return index_name_.GetNoArena();
+  return _internal_index_name();
 }
-inline void SearchRequest::set_index_name(const ::std::string& value) {
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_index_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.index_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.index_name)
 }
-#if LANG_CXX11
-inline void SearchRequest::set_index_name(::std::string&& value) {
-  
-  index_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:Acoustid.Server.PB.SearchRequest.index_name)
+inline std::string* SearchRequest::mutable_index_name() {
+  std::string* _s = _internal_mutable_index_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SearchRequest.index_name)
+  return _s;
 }
-#endif
-inline void SearchRequest::set_index_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:Acoustid.Server.PB.SearchRequest.index_name)
+inline const std::string& SearchRequest::_internal_index_name() const {
+  return _impl_.index_name_.Get();
 }
-inline void SearchRequest::set_index_name(const char* value, size_t size) {
+inline void SearchRequest::_internal_set_index_name(const std::string& value) {
   
-  index_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:Acoustid.Server.PB.SearchRequest.index_name)
+  _impl_.index_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* SearchRequest::mutable_index_name() {
+inline std::string* SearchRequest::_internal_mutable_index_name() {
   
-  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SearchRequest.index_name)
-  return index_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* SearchRequest::release_index_name() {
+inline std::string* SearchRequest::release_index_name() {
   // @@protoc_insertion_point(field_release:Acoustid.Server.PB.SearchRequest.index_name)
-  
-  return index_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.index_name_.Release();
 }
-inline void SearchRequest::set_allocated_index_name(::std::string* index_name) {
-  if (index_name != NULL) {
+inline void SearchRequest::set_allocated_index_name(std::string* index_name) {
+  if (index_name != nullptr) {
     
   } else {
     
   }
-  index_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), index_name);
+  _impl_.index_name_.SetAllocated(index_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.index_name_.IsDefault()) {
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.SearchRequest.index_name)
 }
 
 // repeated uint32 terms = 2;
+inline int SearchRequest::_internal_terms_size() const {
+  return _impl_.terms_.size();
+}
 inline int SearchRequest::terms_size() const {
-  return terms_.size();
+  return _internal_terms_size();
 }
 inline void SearchRequest::clear_terms() {
-  terms_.Clear();
+  _impl_.terms_.Clear();
 }
-inline ::google::protobuf::uint32 SearchRequest::terms(int index) const {
+inline uint32_t SearchRequest::_internal_terms(int index) const {
+  return _impl_.terms_.Get(index);
+}
+inline uint32_t SearchRequest::terms(int index) const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.terms)
-  return terms_.Get(index);
+  return _internal_terms(index);
 }
-inline void SearchRequest::set_terms(int index, ::google::protobuf::uint32 value) {
-  terms_.Set(index, value);
+inline void SearchRequest::set_terms(int index, uint32_t value) {
+  _impl_.terms_.Set(index, value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.terms)
 }
-inline void SearchRequest::add_terms(::google::protobuf::uint32 value) {
-  terms_.Add(value);
+inline void SearchRequest::_internal_add_terms(uint32_t value) {
+  _impl_.terms_.Add(value);
+}
+inline void SearchRequest::add_terms(uint32_t value) {
+  _internal_add_terms(value);
   // @@protoc_insertion_point(field_add:Acoustid.Server.PB.SearchRequest.terms)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SearchRequest::_internal_terms() const {
+  return _impl_.terms_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 SearchRequest::terms() const {
   // @@protoc_insertion_point(field_list:Acoustid.Server.PB.SearchRequest.terms)
-  return terms_;
+  return _internal_terms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SearchRequest::_internal_mutable_terms() {
+  return &_impl_.terms_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 SearchRequest::mutable_terms() {
   // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.SearchRequest.terms)
-  return &terms_;
+  return _internal_mutable_terms();
 }
 
 // int32 max_results = 3;
 inline void SearchRequest::clear_max_results() {
-  max_results_ = 0;
+  _impl_.max_results_ = 0;
 }
-inline ::google::protobuf::int32 SearchRequest::max_results() const {
+inline int32_t SearchRequest::_internal_max_results() const {
+  return _impl_.max_results_;
+}
+inline int32_t SearchRequest::max_results() const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.max_results)
-  return max_results_;
+  return _internal_max_results();
 }
-inline void SearchRequest::set_max_results(::google::protobuf::int32 value) {
+inline void SearchRequest::_internal_set_max_results(int32_t value) {
   
-  max_results_ = value;
+  _impl_.max_results_ = value;
+}
+inline void SearchRequest::set_max_results(int32_t value) {
+  _internal_set_max_results(value);
   // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.max_results)
 }
 
+// bool bypass_cache = 4;
+inline void SearchRequest::clear_bypass_cache() {
+  _impl_.bypass_cache_ = false;
+}
+inline bool SearchRequest::_internal_bypass_cache() const {
+  return _impl_.bypass_cache_;
+}
+inline bool SearchRequest::bypass_cache() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.bypass_cache)
+  return _internal_bypass_cache();
+}
+inline void SearchRequest::_internal_set_bypass_cache(bool value) {
+  
+  _impl_.bypass_cache_ = value;
+}
+inline void SearchRequest::set_bypass_cache(bool value) {
+  _internal_set_bypass_cache(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.bypass_cache)
+}
+
+// bool allow_partial_results = 5;
+inline void SearchRequest::clear_allow_partial_results() {
+  _impl_.allow_partial_results_ = false;
+}
+inline bool SearchRequest::_internal_allow_partial_results() const {
+  return _impl_.allow_partial_results_;
+}
+inline bool SearchRequest::allow_partial_results() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.allow_partial_results)
+  return _internal_allow_partial_results();
+}
+inline void SearchRequest::_internal_set_allow_partial_results(bool value) {
+  
+  _impl_.allow_partial_results_ = value;
+}
+inline void SearchRequest::set_allow_partial_results(bool value) {
+  _internal_set_allow_partial_results(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.allow_partial_results)
+}
+
+// bool sampled = 6;
+inline void SearchRequest::clear_sampled() {
+  _impl_.sampled_ = false;
+}
+inline bool SearchRequest::_internal_sampled() const {
+  return _impl_.sampled_;
+}
+inline bool SearchRequest::sampled() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.sampled)
+  return _internal_sampled();
+}
+inline void SearchRequest::_internal_set_sampled(bool value) {
+  
+  _impl_.sampled_ = value;
+}
+inline void SearchRequest::set_sampled(bool value) {
+  _internal_set_sampled(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.sampled)
+}
+
+// uint32 sample_stride = 7;
+inline void SearchRequest::clear_sample_stride() {
+  _impl_.sample_stride_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_sample_stride() const {
+  return _impl_.sample_stride_;
+}
+inline uint32_t SearchRequest::sample_stride() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.sample_stride)
+  return _internal_sample_stride();
+}
+inline void SearchRequest::_internal_set_sample_stride(uint32_t value) {
+  
+  _impl_.sample_stride_ = value;
+}
+inline void SearchRequest::set_sample_stride(uint32_t value) {
+  _internal_set_sample_stride(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.sample_stride)
+}
+
+// uint32 sample_candidates = 8;
+inline void SearchRequest::clear_sample_candidates() {
+  _impl_.sample_candidates_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_sample_candidates() const {
+  return _impl_.sample_candidates_;
+}
+inline uint32_t SearchRequest::sample_candidates() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.sample_candidates)
+  return _internal_sample_candidates();
+}
+inline void SearchRequest::_internal_set_sample_candidates(uint32_t value) {
+  
+  _impl_.sample_candidates_ = value;
+}
+inline void SearchRequest::set_sample_candidates(uint32_t value) {
+  _internal_set_sample_candidates(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.sample_candidates)
+}
+
+// uint32 expand_distance = 9;
+inline void SearchRequest::clear_expand_distance() {
+  _impl_.expand_distance_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_expand_distance() const {
+  return _impl_.expand_distance_;
+}
+inline uint32_t SearchRequest::expand_distance() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.expand_distance)
+  return _internal_expand_distance();
+}
+inline void SearchRequest::_internal_set_expand_distance(uint32_t value) {
+  
+  _impl_.expand_distance_ = value;
+}
+inline void SearchRequest::set_expand_distance(uint32_t value) {
+  _internal_set_expand_distance(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.expand_distance)
+}
+
+// fixed32 expand_mask = 10;
+inline void SearchRequest::clear_expand_mask() {
+  _impl_.expand_mask_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_expand_mask() const {
+  return _impl_.expand_mask_;
+}
+inline uint32_t SearchRequest::expand_mask() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.expand_mask)
+  return _internal_expand_mask();
+}
+inline void SearchRequest::_internal_set_expand_mask(uint32_t value) {
+  
+  _impl_.expand_mask_ = value;
+}
+inline void SearchRequest::set_expand_mask(uint32_t value) {
+  _internal_set_expand_mask(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchRequest.expand_mask)
+}
+
+// .Acoustid.Server.PB.DocumentFilter filter = 11;
+inline bool SearchRequest::_internal_has_filter() const {
+  return this != internal_default_instance() && _impl_.filter_ != nullptr;
+}
+inline bool SearchRequest::has_filter() const {
+  return _internal_has_filter();
+}
+inline void SearchRequest::clear_filter() {
+  if (GetArenaForAllocation() == nullptr && _impl_.filter_ != nullptr) {
+    delete _impl_.filter_;
+  }
+  _impl_.filter_ = nullptr;
+}
+inline const ::Acoustid::Server::PB::DocumentFilter& SearchRequest::_internal_filter() const {
+  const ::Acoustid::Server::PB::DocumentFilter* p = _impl_.filter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Acoustid::Server::PB::DocumentFilter&>(
+      ::Acoustid::Server::PB::_DocumentFilter_default_instance_);
+}
+inline const ::Acoustid::Server::PB::DocumentFilter& SearchRequest::filter() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchRequest.filter)
+  return _internal_filter();
+}
+inline void SearchRequest::unsafe_arena_set_allocated_filter(
+    ::Acoustid::Server::PB::DocumentFilter* filter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.filter_);
+  }
+  _impl_.filter_ = filter;
+  if (filter) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Acoustid.Server.PB.SearchRequest.filter)
+}
+inline ::Acoustid::Server::PB::DocumentFilter* SearchRequest::release_filter() {
+  
+  ::Acoustid::Server::PB::DocumentFilter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Acoustid::Server::PB::DocumentFilter* SearchRequest::unsafe_arena_release_filter() {
+  // @@protoc_insertion_point(field_release:Acoustid.Server.PB.SearchRequest.filter)
+  
+  ::Acoustid::Server::PB::DocumentFilter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+  return temp;
+}
+inline ::Acoustid::Server::PB::DocumentFilter* SearchRequest::_internal_mutable_filter() {
+  
+  if (_impl_.filter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Acoustid::Server::PB::DocumentFilter>(GetArenaForAllocation());
+    _impl_.filter_ = p;
+  }
+  return _impl_.filter_;
+}
+inline ::Acoustid::Server::PB::DocumentFilter* SearchRequest::mutable_filter() {
+  ::Acoustid::Server::PB::DocumentFilter* _msg = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SearchRequest.filter)
+  return _msg;
+}
+inline void SearchRequest::set_allocated_filter(::Acoustid::Server::PB::DocumentFilter* filter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.filter_;
+  }
+  if (filter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(filter);
+    if (message_arena != submessage_arena) {
+      filter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, filter, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.filter_ = filter;
+  // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.SearchRequest.filter)
+}
+
 // -------------------------------------------------------------------
 
 // SearchResponse
 
 // repeated .Acoustid.Server.PB.SearchResult results = 1;
+inline int SearchResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
 inline int SearchResponse::results_size() const {
-  return results_.size();
+  return _internal_results_size();
 }
 inline void SearchResponse::clear_results() {
-  results_.Clear();
+  _impl_.results_.Clear();
 }
 inline ::Acoustid::Server::PB::SearchResult* SearchResponse::mutable_results(int index) {
   // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.SearchResponse.results)
-  return results_.Mutable(index);
+  return _impl_.results_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >*
 SearchResponse::mutable_results() {
   // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.SearchResponse.results)
-  return &results_;
+  return &_impl_.results_;
+}
+inline const ::Acoustid::Server::PB::SearchResult& SearchResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
 }
 inline const ::Acoustid::Server::PB::SearchResult& SearchResponse::results(int index) const {
   // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchResponse.results)
-  return results_.Get(index);
+  return _internal_results(index);
+}
+inline ::Acoustid::Server::PB::SearchResult* SearchResponse::_internal_add_results() {
+  return _impl_.results_.Add();
 }
 inline ::Acoustid::Server::PB::SearchResult* SearchResponse::add_results() {
+  ::Acoustid::Server::PB::SearchResult* _add = _internal_add_results();
   // @@protoc_insertion_point(field_add:Acoustid.Server.PB.SearchResponse.results)
-  return results_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResult >&
 SearchResponse::results() const {
   // @@protoc_insertion_point(field_list:Acoustid.Server.PB.SearchResponse.results)
-  return results_;
+  return _impl_.results_;
+}
+
+// bool partial = 2;
+inline void SearchResponse::clear_partial() {
+  _impl_.partial_ = false;
+}
+inline bool SearchResponse::_internal_partial() const {
+  return _impl_.partial_;
+}
+inline bool SearchResponse::partial() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchResponse.partial)
+  return _internal_partial();
+}
+inline void SearchResponse::_internal_set_partial(bool value) {
+  
+  _impl_.partial_ = value;
+}
+inline void SearchResponse::set_partial(bool value) {
+  _internal_set_partial(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchResponse.partial)
+}
+
+// -------------------------------------------------------------------
+
+// SearchQuery
+
+// repeated uint32 terms = 1;
+inline int SearchQuery::_internal_terms_size() const {
+  return _impl_.terms_.size();
+}
+inline int SearchQuery::terms_size() const {
+  return _internal_terms_size();
+}
+inline void SearchQuery::clear_terms() {
+  _impl_.terms_.Clear();
+}
+inline uint32_t SearchQuery::_internal_terms(int index) const {
+  return _impl_.terms_.Get(index);
+}
+inline uint32_t SearchQuery::terms(int index) const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchQuery.terms)
+  return _internal_terms(index);
+}
+inline void SearchQuery::set_terms(int index, uint32_t value) {
+  _impl_.terms_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchQuery.terms)
+}
+inline void SearchQuery::_internal_add_terms(uint32_t value) {
+  _impl_.terms_.Add(value);
+}
+inline void SearchQuery::add_terms(uint32_t value) {
+  _internal_add_terms(value);
+  // @@protoc_insertion_point(field_add:Acoustid.Server.PB.SearchQuery.terms)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SearchQuery::_internal_terms() const {
+  return _impl_.terms_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SearchQuery::terms() const {
+  // @@protoc_insertion_point(field_list:Acoustid.Server.PB.SearchQuery.terms)
+  return _internal_terms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SearchQuery::_internal_mutable_terms() {
+  return &_impl_.terms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SearchQuery::mutable_terms() {
+  // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.SearchQuery.terms)
+  return _internal_mutable_terms();
+}
+
+// int32 max_results = 2;
+inline void SearchQuery::clear_max_results() {
+  _impl_.max_results_ = 0;
+}
+inline int32_t SearchQuery::_internal_max_results() const {
+  return _impl_.max_results_;
+}
+inline int32_t SearchQuery::max_results() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.SearchQuery.max_results)
+  return _internal_max_results();
+}
+inline void SearchQuery::_internal_set_max_results(int32_t value) {
+  
+  _impl_.max_results_ = value;
+}
+inline void SearchQuery::set_max_results(int32_t value) {
+  _internal_set_max_results(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.SearchQuery.max_results)
+}
+
+// -------------------------------------------------------------------
+
+// BatchSearchRequest
+
+// string index_name = 1;
+inline void BatchSearchRequest::clear_index_name() {
+  _impl_.index_name_.ClearToEmpty();
+}
+inline const std::string& BatchSearchRequest::index_name() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchRequest.index_name)
+  return _internal_index_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchSearchRequest::set_index_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.index_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.BatchSearchRequest.index_name)
+}
+inline std::string* BatchSearchRequest::mutable_index_name() {
+  std::string* _s = _internal_mutable_index_name();
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.BatchSearchRequest.index_name)
+  return _s;
+}
+inline const std::string& BatchSearchRequest::_internal_index_name() const {
+  return _impl_.index_name_.Get();
+}
+inline void BatchSearchRequest::_internal_set_index_name(const std::string& value) {
+  
+  _impl_.index_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchSearchRequest::_internal_mutable_index_name() {
+  
+  return _impl_.index_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchSearchRequest::release_index_name() {
+  // @@protoc_insertion_point(field_release:Acoustid.Server.PB.BatchSearchRequest.index_name)
+  return _impl_.index_name_.Release();
+}
+inline void BatchSearchRequest::set_allocated_index_name(std::string* index_name) {
+  if (index_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.index_name_.SetAllocated(index_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.index_name_.IsDefault()) {
+    _impl_.index_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Acoustid.Server.PB.BatchSearchRequest.index_name)
+}
+
+// repeated .Acoustid.Server.PB.SearchQuery queries = 2;
+inline int BatchSearchRequest::_internal_queries_size() const {
+  return _impl_.queries_.size();
+}
+inline int BatchSearchRequest::queries_size() const {
+  return _internal_queries_size();
+}
+inline void BatchSearchRequest::clear_queries() {
+  _impl_.queries_.Clear();
+}
+inline ::Acoustid::Server::PB::SearchQuery* BatchSearchRequest::mutable_queries(int index) {
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.BatchSearchRequest.queries)
+  return _impl_.queries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchQuery >*
+BatchSearchRequest::mutable_queries() {
+  // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.BatchSearchRequest.queries)
+  return &_impl_.queries_;
+}
+inline const ::Acoustid::Server::PB::SearchQuery& BatchSearchRequest::_internal_queries(int index) const {
+  return _impl_.queries_.Get(index);
+}
+inline const ::Acoustid::Server::PB::SearchQuery& BatchSearchRequest::queries(int index) const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchRequest.queries)
+  return _internal_queries(index);
+}
+inline ::Acoustid::Server::PB::SearchQuery* BatchSearchRequest::_internal_add_queries() {
+  return _impl_.queries_.Add();
+}
+inline ::Acoustid::Server::PB::SearchQuery* BatchSearchRequest::add_queries() {
+  ::Acoustid::Server::PB::SearchQuery* _add = _internal_add_queries();
+  // @@protoc_insertion_point(field_add:Acoustid.Server.PB.BatchSearchRequest.queries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchQuery >&
+BatchSearchRequest::queries() const {
+  // @@protoc_insertion_point(field_list:Acoustid.Server.PB.BatchSearchRequest.queries)
+  return _impl_.queries_;
+}
+
+// bool allow_partial_results = 3;
+inline void BatchSearchRequest::clear_allow_partial_results() {
+  _impl_.allow_partial_results_ = false;
+}
+inline bool BatchSearchRequest::_internal_allow_partial_results() const {
+  return _impl_.allow_partial_results_;
+}
+inline bool BatchSearchRequest::allow_partial_results() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchRequest.allow_partial_results)
+  return _internal_allow_partial_results();
+}
+inline void BatchSearchRequest::_internal_set_allow_partial_results(bool value) {
+  
+  _impl_.allow_partial_results_ = value;
+}
+inline void BatchSearchRequest::set_allow_partial_results(bool value) {
+  _internal_set_allow_partial_results(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.BatchSearchRequest.allow_partial_results)
+}
+
+// bool interleaved = 4;
+inline void BatchSearchRequest::clear_interleaved() {
+  _impl_.interleaved_ = false;
+}
+inline bool BatchSearchRequest::_internal_interleaved() const {
+  return _impl_.interleaved_;
+}
+inline bool BatchSearchRequest::interleaved() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchRequest.interleaved)
+  return _internal_interleaved();
+}
+inline void BatchSearchRequest::_internal_set_interleaved(bool value) {
+  
+  _impl_.interleaved_ = value;
+}
+inline void BatchSearchRequest::set_interleaved(bool value) {
+  _internal_set_interleaved(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.BatchSearchRequest.interleaved)
+}
+
+// -------------------------------------------------------------------
+
+// BatchSearchResponse
+
+// repeated .Acoustid.Server.PB.SearchResponse responses = 1;
+inline int BatchSearchResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int BatchSearchResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void BatchSearchResponse::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::Acoustid::Server::PB::SearchResponse* BatchSearchResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:Acoustid.Server.PB.BatchSearchResponse.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResponse >*
+BatchSearchResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:Acoustid.Server.PB.BatchSearchResponse.responses)
+  return &_impl_.responses_;
+}
+inline const ::Acoustid::Server::PB::SearchResponse& BatchSearchResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::Acoustid::Server::PB::SearchResponse& BatchSearchResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchResponse.responses)
+  return _internal_responses(index);
+}
+inline ::Acoustid::Server::PB::SearchResponse* BatchSearchResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::Acoustid::Server::PB::SearchResponse* BatchSearchResponse::add_responses() {
+  ::Acoustid::Server::PB::SearchResponse* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:Acoustid.Server.PB.BatchSearchResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Acoustid::Server::PB::SearchResponse >&
+BatchSearchResponse::responses() const {
+  // @@protoc_insertion_point(field_list:Acoustid.Server.PB.BatchSearchResponse.responses)
+  return _impl_.responses_;
+}
+
+// bool partial = 2;
+inline void BatchSearchResponse::clear_partial() {
+  _impl_.partial_ = false;
+}
+inline bool BatchSearchResponse::_internal_partial() const {
+  return _impl_.partial_;
+}
+inline bool BatchSearchResponse::partial() const {
+  // @@protoc_insertion_point(field_get:Acoustid.Server.PB.BatchSearchResponse.partial)
+  return _internal_partial();
+}
+inline void BatchSearchResponse::_internal_set_partial(bool value) {
+  
+  _impl_.partial_ = value;
+}
+inline void BatchSearchResponse::set_partial(bool value) {
+  _internal_set_partial(value);
+  // @@protoc_insertion_point(field_set:Acoustid.Server.PB.BatchSearchResponse.partial)
 }
 
 #ifdef __GNUC__
@@ -2533,6 +4767,14 @@ SearchResponse::results() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -2542,4 +4784,5 @@ SearchResponse::results() const {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_index_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_index_2eproto
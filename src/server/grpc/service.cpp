@@ -1,7 +1,12 @@
 #include "service.h"
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
 
+#include "index/index_reader.h"
+#include "index/top_hits_collector.h"
+
 namespace Acoustid {
 namespace Server {
 
@@ -12,6 +17,11 @@ static inline int remainingTime(std::chrono::system_clock::time_point deadline)
     return std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::system_clock::now()).count();
 }
 
+// Token that is cancelled when the client cancels the call or goes away.
+static inline CancellationTokenSharedPtr makeCancellationToken(grpc::ServerContext* context) {
+    return CancellationTokenSharedPtr::create([context]() { return context->IsCancelled(); });
+}
+
 grpc::Status IndexServiceImpl::Update(grpc::ServerContext* context, const PB::UpdateRequest* request,
                                       PB::UpdateResponse* response) {
     auto indexName = QString::fromStdString(request->index_name());
@@ -61,17 +71,81 @@ grpc::Status IndexServiceImpl::Search(grpc::ServerContext* context, const PB::Se
     terms.assign(request->terms().begin(), request->terms().end());
     try {
         auto index = m_indexes->getIndex(indexName);
-        auto results = index->search(terms, remainingTime(context->deadline()));
-        for (auto result : results) {
-            if (request->max_results() > 0 && response->results_size() >= request->max_results()) {
-                break;
-            }
+        auto reader = index->openReader();
+        reader->setAllowPartialResults(request->allow_partial_results());
+        reader->setCancellationToken(makeCancellationToken(context));
+        if (request->has_filter()) {
+            const auto& filter = request->filter();
+            auto maxId = filter.max_id() ? filter.max_id() : UINT32_MAX;
+            auto bitmap = QByteArray::fromStdString(filter.bitmap());
+            reader->setDocumentFilter(DocumentFilterSharedPtr::create(filter.min_id(), maxId, bitmap));
+        }
+        auto maxResults = request->max_results() > 0 ? request->max_results() : 1000;
+        QList<Result> results;
+        if (request->expand_distance() > 0) {
+            auto expandDistance = std::min<uint32_t>(request->expand_distance(), IndexReader::MAX_EXPANSION_DISTANCE);
+            results = reader->searchExpanded(terms.data(), terms.size(), maxResults, 0, expandDistance, request->expand_mask(),
+                                             remainingTime(context->deadline()));
+        } else if (request->sampled()) {
+            results = reader->searchSampled(terms.data(), terms.size(), maxResults, 0, request->sample_stride(),
+                                            request->sample_candidates(), remainingTime(context->deadline()));
+        } else {
+            results = reader->searchTopHits(terms.data(), terms.size(), maxResults, 0,
+                                            remainingTime(context->deadline()), !request->bypass_cache());
+        }
+        for (const auto& result : results) {
             auto r = response->add_results();
-            r->set_doc_id(result.docId());
+            r->set_doc_id(result.id());
             r->set_score(result.score());
         }
+        response->set_partial(reader->isPartial());
     } catch (const IndexNotFoundException& e) {
         return grpc::Status(grpc::NOT_FOUND, e.what());
+    } catch (const TimeoutExceeded& e) {
+        return grpc::Status(grpc::DEADLINE_EXCEEDED, "search timed out");
+    } catch (const SearchCancelled& e) {
+        return grpc::Status(grpc::CANCELLED, "search cancelled");
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status IndexServiceImpl::BatchSearch(grpc::ServerContext* context, const PB::BatchSearchRequest* request,
+                                           PB::BatchSearchResponse* response) {
+    auto indexName = QString::fromStdString(request->index_name());
+    std::vector<std::vector<uint32_t>> queries;
+    std::vector<std::unique_ptr<TopHitsCollector>> collectors;
+    std::vector<Collector*> collectorPtrs;
+    for (const auto& query : request->queries()) {
+        queries.emplace_back(query.terms().begin(), query.terms().end());
+        collectors.emplace_back(new TopHitsCollector(query.max_results() > 0 ? query.max_results() : 1000));
+        collectors.back()->reserve(query.terms_size());
+        collectorPtrs.push_back(collectors.back().get());
+    }
+    try {
+        auto index = m_indexes->getIndex(indexName);
+        auto reader = index->openReader();
+        reader->setAllowPartialResults(request->allow_partial_results());
+        reader->setCancellationToken(makeCancellationToken(context));
+        if (request->interleaved()) {
+            reader->searchInterleaved(queries, collectorPtrs, remainingTime(context->deadline()));
+        } else {
+            reader->searchBatch(queries, collectorPtrs, remainingTime(context->deadline()));
+        }
+        response->set_partial(reader->isPartial());
+    } catch (const IndexNotFoundException& e) {
+        return grpc::Status(grpc::NOT_FOUND, e.what());
+    } catch (const TimeoutExceeded& e) {
+        return grpc::Status(grpc::DEADLINE_EXCEEDED, "search timed out");
+    } catch (const SearchCancelled& e) {
+        return grpc::Status(grpc::CANCELLED, "search cancelled");
+    }
+    for (const auto& collector : collectors) {
+        auto queryResponse = response->add_responses();
+        for (const auto& result : collector->topResults()) {
+            auto r = queryResponse->add_results();
+            r->set_doc_id(result.id());
+            r->set_score(result.score());
+        }
     }
     return grpc::Status::OK;
 }
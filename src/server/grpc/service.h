@@ -19,6 +19,9 @@ class IndexServiceImpl final : public PB::Index::Service {
     virtual ::grpc::Status Search(::grpc::ServerContext* context, const PB::SearchRequest* request,
                                   PB::SearchResponse* response) override;
 
+    virtual ::grpc::Status BatchSearch(::grpc::ServerContext* context, const PB::BatchSearchRequest* request,
+                                       PB::BatchSearchResponse* response) override;
+
  private:
     QSharedPointer<MultiIndex> m_indexes;
     QSharedPointer<Metrics> m_metrics;
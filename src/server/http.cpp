@@ -3,6 +3,7 @@
 #include <QtConcurrent>
 
 #include "index/index.h"
+#include "index/index_reader.h"
 #include "index/index_writer.h"
 #include "index/multi_index.h"
 #include "index/top_hits_collector.h"
@@ -53,6 +54,14 @@ static HttpResponse errInvalidParameter(const QString &description) {
     return errBadRequest("invalid_parameter", description);
 }
 
+static HttpResponse errTimeout() {
+    return makeJsonErrorResponse(HTTP_SERVICE_UNAVAILABLE, "timeout", "search timed out");
+}
+
+static HttpResponse errCancelled() {
+    return makeJsonErrorResponse(HTTP_SERVICE_UNAVAILABLE, "cancelled", "search cancelled");
+}
+
 static HttpResponse errInvalidTerms() { return errBadRequest("invalid_terms", "invalid terms"); }
 
 static QString getIndexName(const HttpRequest &request) {
@@ -190,6 +199,60 @@ static HttpResponse handleDeleteDocumentRequest(const HttpRequest &request, cons
     return errNotImplemented("not implemented in this version of acoustid-index");
 }
 
+// Search time limit in milliseconds, zero means no limit.
+static int64_t getTimeout(const HttpRequest &request) {
+    auto timeoutStr = request.param("timeout");
+    if (timeoutStr.isEmpty()) {
+        return 0;
+    }
+    bool ok;
+    auto timeout = timeoutStr.toLongLong(&ok);
+    if (!ok || timeout < 0) {
+        throw HttpResponseException(errInvalidParameter("invalid timeout"));
+    }
+    return timeout;
+}
+
+// Restrict the search to the documents in [filter_min_id, filter_max_id], and if filter_bitmap is given,
+// to those with their bit set in it. The bitmap is base64url encoded, bit i stands for document filter_min_id + i.
+static DocumentFilterSharedPtr getDocumentFilter(const HttpRequest &request) {
+    uint32_t minId = 0;
+    uint32_t maxId = UINT32_MAX;
+    bool ok;
+    auto minIdStr = request.param("filter_min_id");
+    if (!minIdStr.isEmpty()) {
+        minId = minIdStr.toUInt(&ok);
+        if (!ok) {
+            throw HttpResponseException(errInvalidParameter("invalid filter_min_id"));
+        }
+    }
+    auto maxIdStr = request.param("filter_max_id");
+    if (!maxIdStr.isEmpty()) {
+        maxId = maxIdStr.toUInt(&ok);
+        if (!ok) {
+            throw HttpResponseException(errInvalidParameter("invalid filter_max_id"));
+        }
+    }
+    auto bitmap = QByteArray::fromBase64Encoding(request.param("filter_bitmap").toLatin1(),
+                                                 QByteArray::Base64UrlEncoding | QByteArray::AbortOnBase64DecodingErrors);
+    if (!bitmap) {
+        throw HttpResponseException(errInvalidParameter("invalid filter_bitmap"));
+    }
+    return DocumentFilterSharedPtr::create(minId, maxId, bitmap.decoded);
+}
+
+// Convert search results to the JSON array returned by the search endpoints.
+static QJsonArray searchResultsToJson(const QList<Result> &results) {
+    QJsonArray resultsJson;
+    for (auto &result : results) {
+        resultsJson.append(QJsonObject{
+            {"id", qint64(result.id())},
+            {"score", result.score()},
+        });
+    }
+    return resultsJson;
+}
+
 // Handle search requests.
 static HttpResponse handleSearchRequest(const HttpRequest &request, const QSharedPointer<MultiIndex> &indexes) {
     auto index = getIndex(request, indexes);
@@ -204,23 +267,135 @@ static HttpResponse handleSearchRequest(const HttpRequest &request, const QShare
         limit = 100;
     }
 
-    auto collector = QSharedPointer<TopHitsCollector>::create(limit);
-    {
+    // Clients can bypass the result cache with cache=false.
+    auto useCache = request.param("cache") != "false";
+    auto timeout = getTimeout(request);
+    auto allowPartialResults = request.param("partial") == "true";
+
+    // Two-phase search with a subsample of the query, zero stride or candidates are picked automatically.
+    auto sampled = request.param("sampled") == "true";
+    auto sampleStride = request.param("sample_stride").toUInt();
+    auto sampleCandidates = request.param("sample_candidates").toUInt();
+
+    // Tolerate bit errors in the query terms, in the bits selected by expand_mask (zero or missing means all bits).
+    auto expandDistance = request.param("expand_distance").toInt();
+    if (expandDistance < 0 || expandDistance > IndexReader::MAX_EXPANSION_DISTANCE) {
+        return errInvalidParameter("invalid expand_distance");
+    }
+    uint32_t expandMask = 0xFFFFFFFF;
+    auto expandMaskStr = request.param("expand_mask");
+    if (!expandMaskStr.isEmpty()) {
+        bool ok;
+        expandMask = expandMaskStr.toUInt(&ok, 0);
+        if (!ok) {
+            return errInvalidParameter("invalid expand_mask");
+        }
+    }
+
+    auto filter = getDocumentFilter(request);
+
+    QList<Result> results;
+    bool partial = false;
+    try {
         auto reader = index->openReader();
-        reader->search(query.data(), query.size(), collector.data());
+        reader->setAllowPartialResults(allowPartialResults);
+        reader->setCancellationToken(request.cancellationToken());
+        reader->setDocumentFilter(filter);
+        if (expandDistance > 0) {
+            results = reader->searchExpanded(query.data(), query.size(), limit, 0, expandDistance, expandMask, timeout);
+        } else if (sampled) {
+            results = reader->searchSampled(query.data(), query.size(), limit, 0, sampleStride, sampleCandidates, timeout);
+        } else {
+            results = reader->searchTopHits(query.data(), query.size(), limit, 0, timeout, useCache);
+        }
+        partial = reader->isPartial();
+    } catch (const TimeoutExceeded &e) {
+        return errTimeout();
+    } catch (const SearchCancelled &e) {
+        return errCancelled();
     }
-    auto results = collector->topResults();
 
-    QJsonArray resultsJson;
-    for (auto &result : results) {
-        resultsJson.append(QJsonObject{
-            {"id", qint64(result.id())},
-            {"score", result.score()},
+    QJsonObject responseJson{
+        {"results", searchResultsToJson(results)},
+    };
+    if (allowPartialResults) {
+        responseJson.insert("partial", partial);
+    }
+    return HttpResponse(HTTP_OK, QJsonDocument(responseJson));
+}
+
+// Handle multi-search requests, all queries are searched in one pass over the index.
+static HttpResponse handleMultiSearchRequest(const HttpRequest &request, const QSharedPointer<MultiIndex> &indexes) {
+    auto index = getIndex(request, indexes);
+
+    QJsonArray queriesJsonArray;
+    auto doc = request.json();
+    if (doc.isObject() && doc.object().value("queries").isArray()) {
+        queriesJsonArray = doc.object().value("queries").toArray();
+    } else if (doc.isArray()) {
+        queriesJsonArray = doc.array();
+    } else {
+        return errBadRequest("invalid_msearch_request",
+                             "request body must be either an array or an object with 'queries' key in it");
+    }
+
+    std::vector<std::vector<uint32_t>> queries;
+    std::vector<std::unique_ptr<TopHitsCollector>> collectors;
+    std::vector<Collector *> collectorPtrs;
+    for (const auto &queryJson : queriesJsonArray) {
+        if (!queryJson.isObject()) {
+            return errBadRequest("invalid_msearch_request", "each query must be an object");
+        }
+        auto queryObj = queryJson.toObject();
+        auto query = parseTerms(queryObj.value("query"));
+        if (query.empty()) {
+            return errInvalidParameter("query is empty");
+        }
+        auto limit = queryObj.value("limit").toInt();
+        if (limit <= 0) {
+            limit = 100;
+        }
+        collectors.emplace_back(new TopHitsCollector(limit));
+        collectors.back()->reserve(query.size());
+        collectorPtrs.push_back(collectors.back().get());
+        queries.push_back(std::move(query));
+    }
+
+    auto timeout = getTimeout(request);
+    auto allowPartialResults = request.param("partial") == "true";
+
+    // Search the queries one by one, interleaved, instead of merging them into one pass.
+    auto interleaved = request.param("interleaved") == "true";
+
+    bool partial = false;
+    try {
+        auto reader = index->openReader();
+        reader->setAllowPartialResults(allowPartialResults);
+        reader->setCancellationToken(request.cancellationToken());
+        if (interleaved) {
+            reader->searchInterleaved(queries, collectorPtrs, timeout);
+        } else {
+            reader->searchBatch(queries, collectorPtrs, timeout);
+        }
+        partial = reader->isPartial();
+    } catch (const TimeoutExceeded &e) {
+        return errTimeout();
+    } catch (const SearchCancelled &e) {
+        return errCancelled();
+    }
+
+    QJsonArray responsesJson;
+    for (const auto &collector : collectors) {
+        responsesJson.append(QJsonObject{
+            {"results", searchResultsToJson(collector->topResults())},
         });
     }
     QJsonObject responseJson{
-        {"results", resultsJson},
+        {"responses", responsesJson},
     };
+    if (allowPartialResults) {
+        responseJson.insert("partial", partial);
+    }
     return HttpResponse(HTTP_OK, QJsonDocument(responseJson));
 }
 
@@ -318,6 +493,9 @@ HttpRequestHandler::HttpRequestHandler(QSharedPointer<MultiIndex> indexes, QShar
     m_router.route(HTTP_GET, "/:index/_search", [=](auto req) {
         return handleSearchRequest(req, m_indexes);
     });
+    m_router.route(HTTP_POST, "/:index/_msearch", [=](auto req) {
+        return handleMultiSearchRequest(req, m_indexes);
+    });
 
     // Index API
     m_router.route(HTTP_HEAD, "/:index", [=](auto req) {
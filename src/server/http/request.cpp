@@ -11,6 +11,7 @@ HttpRequest::HttpRequest(const HttpRequest &other, const QMap<QString, QString>
     setHeaders(other.m_headers);
     setBody(other.m_body);
     setArgs(args);
+    setCancellationToken(other.cancellationToken());
 }
 
 QString HttpRequest::param(const QString &name, const QString &defaultValue) const {
@@ -8,6 +8,8 @@
 #include <QUrlQuery>
 #include <qhttpserverrequest.hpp>
 
+#include "util/cancellation_token.h"
+
 namespace Acoustid {
 namespace Server {
 
@@ -52,6 +54,10 @@ class HttpRequest {
 
     void setArgs(const QMap<QString, QString> &args) { m_args = args; }
 
+    // Cancelled when the client disconnects before getting the response.
+    CancellationTokenSharedPtr cancellationToken() const { return m_cancellation; }
+    void setCancellationToken(CancellationTokenSharedPtr cancellation) { m_cancellation = cancellation; }
+
  private:
     HttpMethod m_method;
     QUrl m_url;
@@ -59,6 +65,7 @@ class HttpRequest {
     HttpHeaderMap m_headers;
     QByteArray m_body;
     QMap<QString, QString> m_args;
+    CancellationTokenSharedPtr m_cancellation;
 };
 
 }  // namespace Server
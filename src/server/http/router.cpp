@@ -2,6 +2,7 @@
 
 #include <QRegularExpression>
 #include <QtConcurrent>
+#include <qhttpserverconnection.hpp>
 
 namespace Acoustid {
 namespace Server {
@@ -48,9 +49,13 @@ HttpResponse HttpRouter::handle(const HttpRequest &request) const {
 void HttpRouter::handle(qhttp::server::QHttpRequest *req, qhttp::server::QHttpResponse *res) const {
     req->collectData();
     req->onEnd([=]() {
+        auto cancellation = CancellationTokenSharedPtr::create();
+        auto disconnected = QObject::connect(req->connection(), &qhttp::server::QHttpConnection::disconnected,
+                                             [cancellation]() { cancellation->cancel(); });
         HttpRequest request(req->method(), req->url());
         request.setHeaders(req->headers());
         request.setBody(req->collectedData());
+        request.setCancellationToken(cancellation);
         QtConcurrent::run([=]() {
             HttpResponse response;
             try {
@@ -60,6 +65,7 @@ void HttpRouter::handle(qhttp::server::QHttpRequest *req, qhttp::server::QHttpRe
                 response = HttpResponse(HTTP_INTERNAL_SERVER_ERROR);
             }
             QMetaObject::invokeMethod(req, [=]() {
+                QObject::disconnect(disconnected);
                 response.send(req, res);
             });
         });
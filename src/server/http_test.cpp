@@ -137,6 +137,19 @@ TEST_F(HttpTest, TestSearchNoResults) {
     ASSERT_EQ(response.body().toStdString(), "{\"results\":[]}");
 }
 
+TEST_F(HttpTest, TestSearchInvalidFilter) {
+    indexes->createIndex("testidx");
+    indexes->getIndex("testidx")->insertOrUpdateDocument(111, {1, 2, 3});
+
+    auto request = HttpRequest(HTTP_GET, QUrl("/testidx/_search?query=1,2,3&filter_bitmap=A*Q"));
+    auto response = handler->router().handle(request);
+    ASSERT_EQ(response.status(), HTTP_BAD_REQUEST);
+
+    request = HttpRequest(HTTP_GET, QUrl("/testidx/_search?query=1,2,3&filter_min_id=x"));
+    response = handler->router().handle(request);
+    ASSERT_EQ(response.status(), HTTP_BAD_REQUEST);
+}
+
 TEST_F(HttpTest, TestBulkArray) {
     indexes->createIndex("testidx");
     indexes->getIndex("testidx")->insertOrUpdateDocument(112, {31, 41, 51});
@@ -72,9 +72,59 @@ int main(int argc, char **argv) {
 
     parser.addOption("threads", 't')
         .setArgument()
-        .setHelp("use specific number of threads")
+        .setHelp("use specific number of threads, also used to search index segments in parallel")
         .setDefaultValue("0");
 
+    parser.addOption("block-cache-size")
+        .setArgument()
+        .setHelp("memory used for caching decoded index blocks, in MB (default: 0, disabled)")
+        .setMetaVar("SIZE")
+        .setDefaultValue("0");
+
+    parser.addOption("result-cache-size")
+        .setArgument()
+        .setHelp("memory used for caching search results, in MB (default: 0, disabled)")
+        .setMetaVar("SIZE")
+        .setDefaultValue("0");
+
+    parser.addOption("no-search-collapsing")
+        .setHelp("run identical concurrent searches separately instead of sharing the results of one of them");
+
+    parser.addOption("prefetch-blocks")
+        .setHelp("request the data blocks a search will read from the OS before searching");
+
+    parser.addOption("approximate-search-threshold")
+        .setArgument()
+        .setHelp("count hits approximately, in bounded memory, for searches expected to read more postings than this "
+                 "(default: 0, disabled)")
+        .setMetaVar("POSTINGS")
+        .setDefaultValue("0");
+
+    parser.addOption("approximate-search-error")
+        .setArgument()
+        .setHelp("error bound of approximate searches, as a fraction of all hits (default: 0.00001)")
+        .setMetaVar("ERROR")
+        .setDefaultValue("0.00001");
+
+    parser.addOption("frequent-term-cutoff")
+        .setArgument()
+        .setHelp("treat query terms found in more documents than this as frequent (default: 0, disabled)")
+        .setMetaVar("DOCS")
+        .setDefaultValue("0");
+
+    parser.addOption("frequent-terms")
+        .setArgument()
+        .setHelp("what to do with frequent query terms, 'skip' or 'demote' them to only add to the scores of "
+                 "documents found by the other terms (default: demote)")
+        .setMetaVar("MODE")
+        .setDefaultValue("demote");
+
+    parser.addOption("segment-index-layout")
+        .setArgument()
+        .setHelp("in-memory layout of the segment block index, 'sorted' or 'stree' (default: sorted)")
+        .setMetaVar("LAYOUT")
+        .setDefaultValue("sorted");
+
     // clang-format on
 
     std::unique_ptr<Options> opts(parser.parse(argc, argv));
@@ -100,7 +150,38 @@ int main(int argc, char **argv) {
 
     auto indexesDir = QSharedPointer<FSDirectory>::create(path, true);
     auto indexes = QSharedPointer<MultiIndex>::create(indexesDir);
+    if (numThreads) {
+        indexes->setThreadPool(QThreadPool::globalInstance());
+        indexes->setSearchThreads(numThreads);
+    }
+    indexes->setPrefetchBlocks(opts->contains("prefetch-blocks"));
+    indexes->setApproximateSearchThreshold(size_t(opts->option("approximate-search-threshold").toULongLong()));
+    bool approximateSearchErrorOk = false;
+    double approximateSearchError = opts->option("approximate-search-error").toDouble(&approximateSearchErrorOk);
+    if (!approximateSearchErrorOk || approximateSearchError <= 0 || approximateSearchError >= 1) {
+        parser.error(QString("invalid approximate search error: %1").arg(opts->option("approximate-search-error")));
+    }
+    indexes->setApproximateSearchError(approximateSearchError);
+    indexes->setFrequentTermCutoff(size_t(opts->option("frequent-term-cutoff").toULongLong()));
+    auto frequentTerms = opts->option("frequent-terms");
+    if (frequentTerms == "skip") {
+        indexes->setFrequentTermMode(SKIP_FREQUENT_TERMS);
+    } else if (frequentTerms != "demote") {
+        parser.error(QString("invalid frequent terms mode: %1").arg(frequentTerms));
+    }
+    indexes->setBlockCacheSize(size_t(opts->option("block-cache-size").toUInt()) * 1024 * 1024);
+    indexes->setResultCacheSize(size_t(opts->option("result-cache-size").toUInt()) * 1024 * 1024);
+    indexes->setSingleFlightEnabled(!opts->contains("no-search-collapsing"));
+    auto segmentIndexLayout = opts->option("segment-index-layout");
+    if (segmentIndexLayout == "stree") {
+        indexes->setSegmentIndexLayout(STREE_INDEX_LAYOUT);
+    } else if (segmentIndexLayout != "sorted") {
+        parser.error(QString("invalid segment index layout: %1").arg(segmentIndexLayout));
+    }
     auto metrics = QSharedPointer<Metrics>::create();
+    metrics->setBlockCache(indexes->getRootIndex(true)->blockCache());
+    metrics->setResultCache(indexes->getRootIndex(true)->resultCache());
+    metrics->setIndex(indexes->getRootIndex(true));
 
     Listener::setupSignalHandlers();
 
@@ -35,6 +35,21 @@ void Metrics::onSearchRequest(int resultCount) {
 	}
 }
 
+void Metrics::setBlockCache(BlockCacheSharedPtr blockCache) {
+	QWriteLocker locker(&m_lock);
+	m_blockCache = blockCache;
+}
+
+void Metrics::setResultCache(SearchResultCacheSharedPtr resultCache) {
+	QWriteLocker locker(&m_lock);
+	m_resultCache = resultCache;
+}
+
+void Metrics::setIndex(IndexSharedPtr index) {
+	QWriteLocker locker(&m_lock);
+	m_index = index;
+}
+
 void Metrics::onRequest(const QString &name, double duration) {
 	QWriteLocker locker(&m_lock);
 	m_requestCount[name] += 1;
@@ -78,5 +93,56 @@ QStringList Metrics::toStringList() {
 	output.append(QString("# TYPE aindex_search_misses_total counter"));
 	output.append(QString("aindex_search_misses_total %1").arg(m_searchMissCount));
 
+	if (m_blockCache) {
+		output.append(QString("# TYPE aindex_block_cache_hits_total counter"));
+		output.append(QString("aindex_block_cache_hits_total %1").arg(m_blockCache->hitCount()));
+
+		output.append(QString("# TYPE aindex_block_cache_misses_total counter"));
+		output.append(QString("aindex_block_cache_misses_total %1").arg(m_blockCache->missCount()));
+
+		output.append(QString("# TYPE aindex_block_cache_evictions_total counter"));
+		output.append(QString("aindex_block_cache_evictions_total %1").arg(m_blockCache->evictionCount()));
+
+		output.append(QString("# TYPE aindex_block_cache_size_bytes gauge"));
+		output.append(QString("aindex_block_cache_size_bytes %1").arg(m_blockCache->size()));
+	}
+
+	if (m_resultCache) {
+		output.append(QString("# TYPE aindex_result_cache_hits_total counter"));
+		output.append(QString("aindex_result_cache_hits_total %1").arg(m_resultCache->hitCount()));
+
+		output.append(QString("# TYPE aindex_result_cache_misses_total counter"));
+		output.append(QString("aindex_result_cache_misses_total %1").arg(m_resultCache->missCount()));
+
+		output.append(QString("# TYPE aindex_result_cache_evictions_total counter"));
+		output.append(QString("aindex_result_cache_evictions_total %1").arg(m_resultCache->evictionCount()));
+
+		output.append(QString("# TYPE aindex_result_cache_size_bytes gauge"));
+		output.append(QString("aindex_result_cache_size_bytes %1").arg(m_resultCache->size()));
+	}
+
+	if (m_index) {
+		output.append(QString("# TYPE aindex_segment_index_size_bytes gauge"));
+		output.append(QString("aindex_segment_index_size_bytes %1").arg(m_index->segmentIndexMemoryUsage()));
+
+		output.append(QString("# TYPE aindex_search_skipped_blocks_total counter"));
+		output.append(QString("aindex_search_skipped_blocks_total %1").arg(m_index->skippedBlockCount()));
+
+		output.append(QString("# TYPE aindex_search_cancelled_total counter"));
+		output.append(QString("aindex_search_cancelled_total %1").arg(m_index->cancelledSearchCount()));
+
+		output.append(QString("# TYPE aindex_search_major_faults_total counter"));
+		output.append(QString("aindex_search_major_faults_total %1").arg(m_index->majorFaultCount()));
+
+		output.append(QString("# TYPE aindex_search_collapsed_total counter"));
+		output.append(QString("aindex_search_collapsed_total %1").arg(m_index->singleFlight()->sharedCount()));
+
+		output.append(QString("# TYPE aindex_search_approximate_total counter"));
+		output.append(QString("aindex_search_approximate_total %1").arg(m_index->approximateSearchCount()));
+
+		output.append(QString("# TYPE aindex_search_frequent_terms_total counter"));
+		output.append(QString("aindex_search_frequent_terms_total %1").arg(m_index->frequentTermCount()));
+	}
+
 	return output;
 }
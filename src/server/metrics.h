@@ -5,7 +5,9 @@
 #define ACOUSTID_SERVER_METRICS_H_
 
 #include <QReadWriteLock>
+#include "index/block_cache.h"
 #include "index/index.h"
+#include "index/search_result_cache.h"
 #include "store/directory.h"
 
 namespace Acoustid {
@@ -23,6 +25,10 @@ public:
 	void onRequest(const QString &name, double duration);
 	void onSearchRequest(int resultCount);
 
+	void setBlockCache(BlockCacheSharedPtr blockCache);
+	void setResultCache(SearchResultCacheSharedPtr resultCache);
+	void setIndex(IndexSharedPtr index);
+
 	QStringList toStringList();
 
 private:
@@ -36,6 +42,10 @@ private:
 
 	uint64_t m_searchHitCount { 0 };
 	uint64_t m_searchMissCount { 0 };
+
+	BlockCacheSharedPtr m_blockCache;
+	SearchResultCacheSharedPtr m_resultCache;
+	IndexSharedPtr m_index;
 };
 
 }
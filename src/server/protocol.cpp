@@ -83,17 +83,23 @@ ScopedHandlerFunc buildHandler(const QString &command, const QStringList &args)
             return QString();
         };
     } else if (command == "search") {
-        if (args.size() != 1) {
+        // An optional "nocache" argument bypasses the result cache.
+        if (args.size() != 1 && !(args.size() == 2 && args.at(1) == "nocache")) {
             throw BadRequest("expected one argumemt");
         }
         return [=](QSharedPointer<Session> session) {
             auto hashes = parseFingerprint(args.at(0));
-            auto results = session->search(hashes);
+            bool partial = false;
+            auto results = session->search(hashes, args.size() == 1, &partial);
             QStringList output;
-            output.reserve(results.size());
+            output.reserve(results.size() + 1);
             for (int i = 0; i < results.size(); i++) {
                 output.append(QString("%1:%2").arg(results[i].id()).arg(results[i].score()));
             }
+            // Only sessions with partial_results enabled can get this marker.
+            if (partial) {
+                output.append("partial");
+            }
             return output.join(" ");
         };
     } else {
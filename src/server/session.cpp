@@ -1,9 +1,11 @@
 // Copyright (C) 2020  Lukas Lalinsky
 // Distributed under the MIT license, see the LICENSE file for details.
 
+#include <algorithm>
 #include "session.h"
 #include "errors.h"
 #include "index/index.h"
+#include "index/index_reader.h"
 #include "index/index_writer.h"
 #include "index/top_hits_collector.h"
 
@@ -65,6 +67,33 @@ QString Session::getAttribute(const QString &name) {
     if (name == "idle_timeout") {
         return QString("%1").arg(m_idle_timeout);
     }
+    if (name == "partial_results") {
+        return QString("%1").arg(m_partialResults ? 1 : 0);
+    }
+    if (name == "sampled_search") {
+        return QString("%1").arg(m_sampledSearch ? 1 : 0);
+    }
+    if (name == "sample_stride") {
+        return QString("%1").arg(m_sampleStride);
+    }
+    if (name == "sample_candidates") {
+        return QString("%1").arg(m_sampleCandidates);
+    }
+    if (name == "expand_distance") {
+        return QString("%1").arg(m_expandDistance);
+    }
+    if (name == "expand_mask") {
+        return QString("0x%1").arg(m_expandMask, 8, 16, QChar('0'));
+    }
+    if (name == "filter_min_id") {
+        return QString("%1").arg(m_filterMinId);
+    }
+    if (name == "filter_max_id") {
+        return QString("%1").arg(m_filterMaxId);
+    }
+    if (name == "filter_bitmap") {
+        return QString::fromLatin1(m_filterBitmap.toBase64(QByteArray::Base64UrlEncoding));
+    }
     if (m_indexWriter.isNull()) {
         return m_index->getAttribute(name);
     }
@@ -89,6 +118,64 @@ void Session::setAttribute(const QString &name, const QString &value) {
         m_idle_timeout = value.toInt();
         return;
     }
+    if (name == "partial_results") {
+        m_partialResults = value.toInt() != 0;
+        return;
+    }
+    if (name == "sampled_search") {
+        m_sampledSearch = value.toInt() != 0;
+        return;
+    }
+    if (name == "sample_stride") {
+        m_sampleStride = std::max(0, value.toInt());
+        return;
+    }
+    if (name == "sample_candidates") {
+        m_sampleCandidates = std::max(0, value.toInt());
+        return;
+    }
+    if (name == "expand_distance") {
+        m_expandDistance = qBound(0, value.toInt(), int(IndexReader::MAX_EXPANSION_DISTANCE));
+        return;
+    }
+    if (name == "expand_mask") {
+        // Decimal or 0x-prefixed hexadecimal, zero means all bits.
+        bool ok;
+        auto expandMask = value.toUInt(&ok, 0);
+        if (!ok) {
+            throw HandlerException("invalid expand_mask");
+        }
+        m_expandMask = expandMask;
+        return;
+    }
+    if (name == "filter_min_id") {
+        bool ok;
+        auto minId = value.toUInt(&ok);
+        if (!ok) {
+            throw HandlerException("invalid filter_min_id");
+        }
+        m_filterMinId = minId;
+        return;
+    }
+    if (name == "filter_max_id") {
+        bool ok = true;
+        auto maxId = value.isEmpty() ? UINT32_MAX : value.toUInt(&ok);
+        if (!ok) {
+            throw HandlerException("invalid filter_max_id");
+        }
+        m_filterMaxId = maxId;
+        return;
+    }
+    if (name == "filter_bitmap") {
+        // Base64 encoded, bit i of the bitmap stands for document filter_min_id + i.
+        auto bitmap = QByteArray::fromBase64Encoding(value.toLatin1(),
+                                                     QByteArray::Base64UrlEncoding | QByteArray::AbortOnBase64DecodingErrors);
+        if (!bitmap) {
+            throw HandlerException("invalid filter_bitmap");
+        }
+        m_filterBitmap = bitmap.decoded;
+        return;
+    }
     if (m_indexWriter.isNull()) {
         throw NotInTransactionException();
     }
@@ -103,14 +190,28 @@ void Session::insert(uint32_t id, const QVector<uint32_t> &hashes) {
     m_indexWriter->addDocument(id, hashes.data(), hashes.size());
 }
 
-QList<Result> Session::search(const QVector<uint32_t> &hashes) {
+QList<Result> Session::search(const QVector<uint32_t> &hashes, bool useCache, bool *partial) {
     QMutexLocker locker(&m_mutex);
-    TopHitsCollector collector(m_maxResults, m_topScorePercent);
     try {
         auto reader = m_index->openReader();
-        reader->search(hashes.data(), hashes.size(), &collector, m_timeout);
+        reader->setAllowPartialResults(m_partialResults);
+        reader->setCancellationToken(m_cancellation);
+        reader->setDocumentFilter(DocumentFilterSharedPtr::create(m_filterMinId, m_filterMaxId, m_filterBitmap));
+        QList<Result> results;
+        if (m_expandDistance > 0) {
+            results = reader->searchExpanded(hashes.data(), hashes.size(), m_maxResults, m_topScorePercent, m_expandDistance, m_expandMask, m_timeout);
+        } else if (m_sampledSearch) {
+            results = reader->searchSampled(hashes.data(), hashes.size(), m_maxResults, m_topScorePercent, m_sampleStride, m_sampleCandidates, m_timeout);
+        } else {
+            results = reader->searchTopHits(hashes.data(), hashes.size(), m_maxResults, m_topScorePercent, m_timeout, useCache);
+        }
+        if (partial) {
+            *partial = reader->isPartial();
+        }
+        return results;
     } catch (TimeoutExceeded &ex) {
         throw HandlerException("timeout exceeded");
+    } catch (SearchCancelled &ex) {
+        throw HandlerException("search cancelled");
     }
-    return collector.topResults();
 }
@@ -4,9 +4,11 @@
 #ifndef ACOUSTID_SERVER_SESSION_H_
 #define ACOUSTID_SERVER_SESSION_H_
 
+#include <QByteArray>
 #include <QMutex>
 #include <QSharedPointer>
 #include "index/top_hits_collector.h"
+#include "util/cancellation_token.h"
 
 namespace Acoustid {
 
@@ -21,7 +23,7 @@ class Session
 {
 public:
 	Session(QSharedPointer<Index> index, QSharedPointer<Metrics> metrics)
-        : m_index(index), m_metrics(metrics) {}
+        : m_index(index), m_metrics(metrics), m_cancellation(CancellationTokenSharedPtr::create()) {}
 
     void begin();
     void commit();
@@ -29,7 +31,9 @@ public:
     void optimize();
     void cleanup();
     void insert(uint32_t id, const QVector<uint32_t> &hashes);
-    QList<Result> search(const QVector<uint32_t> &hashes);
+    // If partial results are enabled and the search runs out of time, `partial`
+    // is set to true and the hits found so far are returned.
+    QList<Result> search(const QVector<uint32_t> &hashes, bool useCache = true, bool *partial = nullptr);
 
     QString getAttribute(const QString &name);
     void setAttribute(const QString &name, const QString &value);
@@ -39,14 +43,28 @@ public:
 
     QSharedPointer<Metrics> metrics() const { return m_metrics; }
 
+    // Stop the search in progress, if any, and all future ones. Called when the client goes away.
+    void cancel() { m_cancellation->cancel(); }
+
 private:
 	QMutex m_mutex;
     QSharedPointer<Index> m_index;
     QSharedPointer<IndexWriter> m_indexWriter;
     QSharedPointer<Metrics> m_metrics;
+    CancellationTokenSharedPtr m_cancellation;
 	int m_topScorePercent { 10 };
 	int m_maxResults { 500 };
     int64_t m_timeout { 0 };
+    bool m_partialResults { false };
+    bool m_sampledSearch { false };
+    int m_sampleStride { 0 };
+    int m_sampleCandidates { 0 };
+    int m_expandDistance { 0 };
+    uint32_t m_expandMask { 0xFFFFFFFF };
+    // Searches only return documents matching the filter, see DocumentFilter.
+    uint32_t m_filterMinId { 0 };
+    uint32_t m_filterMaxId { UINT32_MAX };
+    QByteArray m_filterBitmap;
     int64_t m_idle_timeout { 60 * 1000 };
 };
 
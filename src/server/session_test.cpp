@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 #include "store/ram_directory.h"
 #include "index/index.h"
+#include "server/errors.h"
 #include "server/metrics.h"
 #include "server/session.h"
 
@@ -35,6 +36,12 @@ TEST(SessionTest, Attributes)
     ASSERT_EQ("0", session->getAttribute("timeout").toStdString());
     session->setAttribute("timeout", "100");
     ASSERT_EQ("100", session->getAttribute("timeout").toStdString());
+
+    ASSERT_EQ("0xffffffff", session->getAttribute("expand_mask").toStdString());
+    session->setAttribute("expand_mask", "0xff");
+    ASSERT_EQ("0x000000ff", session->getAttribute("expand_mask").toStdString());
+    ASSERT_THROW(session->setAttribute("expand_mask", "ff"), HandlerException);
+    ASSERT_EQ("0x000000ff", session->getAttribute("expand_mask").toStdString());
 }
 
 TEST(SessionTest, InsertAndSearch)
@@ -76,3 +83,62 @@ TEST(SessionTest, InsertAndSearch)
         ASSERT_EQ(3, results[0].score());
     }
 }
+
+TEST(SessionTest, SearchWithDocumentFilter)
+{
+	auto storage = QSharedPointer<RAMDirectory>::create();
+	auto index = QSharedPointer<Index>::create(storage, true);
+    auto metrics = QSharedPointer<Metrics>::create();
+    auto session = QSharedPointer<Session>::create(index, metrics);
+
+    session->begin();
+    session->insert(1, { 1, 2, 3 });
+    session->insert(2, { 1, 200, 300 });
+    session->insert(3, { 1, 2, 300 });
+    session->commit();
+
+    session->setAttribute("filter_min_id", "2");
+    ASSERT_EQ("2", session->getAttribute("filter_min_id").toStdString());
+    {
+        auto results = session->search({ 1, 2, 3 });
+        ASSERT_EQ(2, results.size());
+        ASSERT_EQ(3, results[0].id());
+        ASSERT_EQ(2, results[0].score());
+        ASSERT_EQ(2, results[1].id());
+        ASSERT_EQ(1, results[1].score());
+    }
+
+    // Only document 2, the bitmap starts at filter_min_id.
+    session->setAttribute("filter_bitmap", "AQ");
+    ASSERT_EQ("AQ==", session->getAttribute("filter_bitmap").toStdString());
+    {
+        auto results = session->search({ 1, 2, 3 });
+        ASSERT_EQ(1, results.size());
+        ASSERT_EQ(2, results[0].id());
+    }
+
+    session->setAttribute("filter_bitmap", "");
+    session->setAttribute("filter_max_id", "2");
+    ASSERT_EQ("2", session->getAttribute("filter_max_id").toStdString());
+    {
+        auto results = session->search({ 1, 2, 3 });
+        ASSERT_EQ(1, results.size());
+        ASSERT_EQ(2, results[0].id());
+    }
+
+    session->setAttribute("filter_min_id", "0");
+    session->setAttribute("filter_max_id", "");
+    ASSERT_EQ("4294967295", session->getAttribute("filter_max_id").toStdString());
+    {
+        auto results = session->search({ 1, 2, 3 });
+        ASSERT_EQ(3, results.size());
+    }
+
+    // Invalid values are rejected and the filter stays as it was.
+    ASSERT_THROW(session->setAttribute("filter_min_id", "x"), HandlerException);
+    ASSERT_THROW(session->setAttribute("filter_max_id", "-1"), HandlerException);
+    ASSERT_THROW(session->setAttribute("filter_bitmap", "A*Q"), HandlerException);
+    ASSERT_EQ("0", session->getAttribute("filter_min_id").toStdString());
+    ASSERT_EQ("4294967295", session->getAttribute("filter_max_id").toStdString());
+    ASSERT_EQ("", session->getAttribute("filter_bitmap").toStdString());
+}
@@ -1,6 +1,7 @@
 // Copyright (C) 2011  Lukas Lalinsky
 // Distributed under the MIT license, see the LICENSE file for details.
 
+#include <algorithm>
 #include "util/vint.h"
 #include "buffered_input_stream.h"
 
@@ -29,6 +30,23 @@ void BufferedInputStream::setBufferSize(size_t bufferSize)
 	m_length = 0;
 }
 
+void BufferedInputStream::readBytes(uint8_t *data, size_t length)
+{
+	while (length > 0) {
+		if (m_position >= m_length) {
+			refill();
+			if (m_length == 0) {
+				throw IOException("reading past the end of data");
+			}
+		}
+		size_t size = std::min(length, m_length - m_position);
+		memcpy(data, &m_buffer[m_position], size);
+		m_position += size;
+		data += size;
+		length -= size;
+	}
+}
+
 uint32_t BufferedInputStream::readVInt32()
 {
 	if (m_position >= m_length) {
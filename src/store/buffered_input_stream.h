@@ -26,6 +26,7 @@ public:
 		return m_buffer[m_position++];
 	}
 
+	void readBytes(uint8_t *data, size_t length);
 	uint32_t readVInt32();
 
 	size_t position();
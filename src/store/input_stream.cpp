@@ -9,6 +9,13 @@ InputStream::~InputStream()
 {
 }
 
+void InputStream::readBytes(uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++) {
+		data[i] = readByte();
+	}
+}
+
 QString InputStream::readString()
 {
 	size_t size = readVInt32();
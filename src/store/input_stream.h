@@ -15,6 +15,7 @@ public:
 	virtual ~InputStream();
 
 	virtual uint8_t readByte() = 0;
+	virtual void readBytes(uint8_t *data, size_t length);
 
 	virtual uint16_t readInt16()
 	{
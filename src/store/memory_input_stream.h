@@ -14,10 +14,14 @@ public:
 	explicit MemoryInputStream(const uint8_t *addr, size_t m_length);
 	~MemoryInputStream();
 
+	const uint8_t *data() const { return m_addr; }
+	size_t length() const { return m_length; }
+
 	size_t position();
 	void seek(size_t position);
 
 	uint8_t readByte();
+	void readBytes(uint8_t *data, size_t length);
 	uint32_t readVInt32();
 
 private:
@@ -3,6 +3,7 @@
 
 #include <QString>
 #include <QFile>
+#include <algorithm>
 #include <errno.h>
 #include <sys/mman.h>
 #include "common.h"
@@ -25,6 +26,18 @@ const FSFileSharedPtr& MMapInputStream::file() const
 	return m_file;
 }
 
+void MMapInputStream::willNeed(size_t offset, size_t length)
+{
+	static const size_t pageSize = sysconf(_SC_PAGESIZE);
+	if (offset >= this->length()) {
+		return;
+	}
+	size_t end = std::min(offset + length, this->length());
+	// The mapping starts at a page boundary, so the offsets only need to be aligned.
+	size_t start = offset & ~(pageSize - 1);
+	::madvise(const_cast<uint8_t *>(data()) + start, end - start, MADV_WILLNEED);
+}
+
 MMapInputStream *MMapInputStream::open(const QString &fileName)
 {
 	QByteArray encodedFileName = QFile::encodeName(fileName);
@@ -39,7 +52,9 @@ MMapInputStream *MMapInputStream::open(const QString &fileName)
         ::close(fd);
         throw IOException(QString("Couldn't map the file '%1' to memory (errno %2)").arg(fileName).arg(errno));
     }
-	::madvise(addr, sb.st_size, MADV_RANDOM | MADV_WILLNEED);
+	// The advice values are not flags, so they need separate calls.
+	::madvise(addr, sb.st_size, MADV_RANDOM);
+	::madvise(addr, sb.st_size, MADV_WILLNEED);
 	return new MMapInputStream(FSFileSharedPtr(new FSFile(fd, addr, sb.st_size)));
 }
 
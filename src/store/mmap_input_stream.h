@@ -17,6 +17,9 @@ public:
 	int fileDescriptor() const;
 	const FSFileSharedPtr &file() const;
 
+	// Ask the kernel to start reading the given byte range of the file into memory.
+	void willNeed(size_t offset, size_t length);
+
 	static MMapInputStream *open(const QString &fileName);
 
 private:
@@ -0,0 +1,185 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdio.h>
+#include <memory>
+#include <QSet>
+#include <QStringList>
+#include "index/index.h"
+#include "index/index_reader.h"
+#include "index/top_hits_collector.h"
+#include "store/fs_directory.h"
+#include "util/options.h"
+#include "util/timer.h"
+
+using namespace Acoustid;
+
+// Compares the latency and recall of sampled two-phase searches with the exact search.
+// With --batch-size, it also compares the throughput of searching the queries one at a
+// time with the merged and the interleaved batch search.
+//
+// Queries are read from stdin in the same "id|{term,term,...}" format as fpi-import uses,
+// so a sample of the imported data can be used directly.
+int main(int argc, char **argv)
+{
+	OptionParser parser("%prog [options] < QUERIES");
+	parser.addOption("directory", 'd')
+		.setArgument()
+		.setHelp("index directory")
+		.setMetaVar("DIR");
+	parser.addOption("limit", 'l')
+		.setArgument()
+		.setHelp("number of results per query (default: 10)")
+		.setMetaVar("N")
+		.setDefaultValue("10");
+	parser.addOption("sample-strides", 's')
+		.setArgument()
+		.setHelp("comma-separated list of sample strides to test, 0 means automatic (default: 0,2,4,8)")
+		.setMetaVar("LIST")
+		.setDefaultValue("0,2,4,8");
+	parser.addOption("candidates", 'c')
+		.setArgument()
+		.setHelp("number of candidates rescored in the second phase, 0 means automatic (default: 0)")
+		.setMetaVar("N")
+		.setDefaultValue("0");
+	parser.addOption("batch-size", 'b')
+		.setArgument()
+		.setHelp("number of queries per batch in the batch search benchmark, 0 disables it (default: 0)")
+		.setMetaVar("N")
+		.setDefaultValue("0");
+	parser.addOption("prefetch", 'p')
+		.setHelp("request the data blocks from the OS before each search");
+	Options *opts = parser.parse(argc, argv);
+
+	QString path = ".";
+	if (opts->contains("directory")) {
+		path = opts->option("directory");
+	}
+	size_t limit = opts->option("limit").toUInt();
+	size_t numCandidates = opts->option("candidates").toUInt();
+	size_t batchSize = opts->option("batch-size").toUInt();
+	QList<size_t> strides;
+	for (const auto &stride : opts->option("sample-strides").split(',')) {
+		strides.append(stride.toUInt());
+	}
+
+	DirectorySharedPtr dir(new FSDirectory(path));
+	IndexSharedPtr index;
+	try {
+		index = IndexSharedPtr(new Index(dir));
+	}
+	catch (IOException &ex) {
+		qCritical() << "ERROR:" << ex.what();
+		return 1;
+	}
+
+	const size_t lineSize = 1024 * 1024;
+	static char line[lineSize];
+	std::vector<std::vector<uint32_t>> queries;
+	while (fgets(line, lineSize, stdin) != NULL) {
+		char *ptr = strchr(line, '{');
+		if (!ptr) {
+			qWarning() << "Invalid line";
+			continue;
+		}
+		std::vector<uint32_t> fp;
+		while (*ptr != '}' && *ptr != 0) {
+			ptr++;
+			fp.push_back(strtol(ptr, &ptr, 10));
+		}
+		if (!fp.empty()) {
+			queries.push_back(std::move(fp));
+		}
+	}
+	if (queries.empty()) {
+		qCritical() << "ERROR: no queries";
+		return 1;
+	}
+
+	index->setPrefetchBlocks(opts->contains("prefetch"));
+	auto reader = index->openReader();
+
+	// Variant 0 is the exact search, the others are sampled searches with the given strides.
+	// The first search of a query reads its blocks from disk and the next ones find them cached,
+	// so each query starts with a different variant to spread that cost evenly.
+	size_t numVariants = strides.size() + 1;
+	std::vector<double> times(numVariants, 0.0);
+	std::vector<uint64_t> majorFaults(numVariants, 0);
+	std::vector<size_t> found(numVariants, 0);
+	size_t total = 0;
+	Timer timer;
+	for (size_t i = 0; i < queries.size(); i++) {
+		std::vector<QList<Result>> results(numVariants);
+		for (size_t j = 0; j < numVariants; j++) {
+			size_t variant = (i + j) % numVariants;
+			timer.start();
+			if (variant == 0) {
+				results[variant] = reader->searchTopHits(queries[i].data(), queries[i].size(), limit, 0, 0, false);
+			}
+			else {
+				results[variant] = reader->searchSampled(queries[i].data(), queries[i].size(), limit, 0, strides.at(variant - 1), numCandidates);
+			}
+			times[variant] += timer.elapsed();
+			majorFaults[variant] += reader->majorFaultCount();
+		}
+		// Exact results are the reference for recall.
+		QSet<uint32_t> expected;
+		for (const auto &result : results[0]) {
+			expected.insert(result.id());
+		}
+		for (size_t variant = 0; variant < numVariants; variant++) {
+			for (const auto &result : results[variant]) {
+				if (expected.contains(result.id())) {
+					found[variant]++;
+				}
+			}
+		}
+		total += expected.size();
+	}
+
+	double exactTime = times[0];
+	printf("exact:      %8.3f ms/query, %.2f major faults/query\n", exactTime / queries.size(), double(majorFaults[0]) / queries.size());
+	for (size_t variant = 1; variant < numVariants; variant++) {
+		double time = times[variant];
+		printf("stride %3zu: %8.3f ms/query, %5.1fx faster, recall %.4f, %.2f major faults/query\n", strides.at(variant - 1),
+			time / queries.size(), time > 0 ? exactTime / time : 0.0, total ? double(found[variant]) / total : 1.0,
+			double(majorFaults[variant]) / queries.size());
+	}
+
+	if (batchSize > 0) {
+		printf("\n");
+		for (int mode = 0; mode < 3; mode++) {
+			const char *names[] = { "one by one", "batch", "interleaved" };
+			timer.start();
+			for (size_t begin = 0; begin < queries.size(); begin += batchSize) {
+				size_t end = std::min(begin + batchSize, queries.size());
+				std::vector<std::vector<uint32_t>> batch(queries.begin() + begin, queries.begin() + end);
+				std::vector<std::unique_ptr<TopHitsCollector>> collectors;
+				std::vector<Collector *> collectorPtrs;
+				for (const auto &query : batch) {
+					collectors.emplace_back(new TopHitsCollector(limit));
+					collectors.back()->reserve(query.size());
+					collectorPtrs.push_back(collectors.back().get());
+				}
+				if (mode == 0) {
+					for (size_t i = 0; i < batch.size(); i++) {
+						reader->search(batch[i].data(), batch[i].size(), collectorPtrs[i]);
+					}
+				}
+				else if (mode == 1) {
+					reader->searchBatch(batch, collectorPtrs);
+				}
+				else {
+					reader->searchInterleaved(batch, collectorPtrs);
+				}
+			}
+			double time = timer.elapsed();
+			printf("%-11s %8.3f ms/query, %8.1f queries/s\n", names[mode], time / queries.size(),
+				time > 0 ? queries.size() * 1000.0 / time : 0.0);
+		}
+	}
+
+	return 0;
+}
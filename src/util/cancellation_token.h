@@ -0,0 +1,37 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_UTIL_CANCELLATION_TOKEN_H_
+#define ACOUSTID_UTIL_CANCELLATION_TOKEN_H_
+
+#include <QAtomicInt>
+#include <QSharedPointer>
+#include <functional>
+
+namespace Acoustid {
+
+// Flag shared between the code that runs a search and the protocol layer that
+// started it, used to stop the search once nobody is waiting for the result.
+//
+// The token is either cancelled explicitly, or it can poll an external source,
+// e.g. a gRPC server context. Long running code should check isCancelled()
+// regularly and throw SearchCancelled.
+class CancellationToken {
+ public:
+    CancellationToken() : m_cancelled(0) {}
+    explicit CancellationToken(std::function<bool()> check) : m_cancelled(0), m_check(check) {}
+
+    void cancel() { m_cancelled.storeRelease(1); }
+
+    bool isCancelled() const { return m_cancelled.loadAcquire() || (m_check && m_check()); }
+
+ private:
+    QAtomicInt m_cancelled;
+    std::function<bool()> m_check;
+};
+
+typedef QSharedPointer<CancellationToken> CancellationTokenSharedPtr;
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_UTIL_CANCELLATION_TOKEN_H_
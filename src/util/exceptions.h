@@ -56,6 +56,11 @@ class TimeoutExceeded : public Exception {
     TimeoutExceeded() : Exception("timeout exceeded") {}
 };
 
+class SearchCancelled : public Exception {
+ public:
+    SearchCancelled() : Exception("search cancelled") {}
+};
+
 }  // namespace Acoustid
 
 #endif
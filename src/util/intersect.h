@@ -0,0 +1,123 @@
+// Copyright (C) 2011  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_UTIL_INTERSECT_H_
+#define ACOUSTID_UTIL_INTERSECT_H_
+
+#include "common.h"
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Acoustid {
+
+/**
+ * Range [begin,end) of positions in the keys array, all equal to terms[term].
+ */
+struct IntersectMatch
+{
+	uint32_t begin;
+	uint32_t end;
+	uint32_t term;
+};
+
+/**
+ * Advance pos to the first element of the sorted array that is not smaller
+ * than the value, comparing four elements at a time.
+ */
+inline size_t scanLowerBound(const uint32_t *data, size_t pos, size_t size, uint32_t value)
+{
+#ifdef __SSE2__
+	// SSE2 only has signed comparisons, flipping the sign bit makes them work for unsigned values.
+	const __m128i sign = _mm_set1_epi32(0x80000000);
+	const __m128i needle = _mm_xor_si128(_mm_set1_epi32(value), sign);
+	while (pos + 4 <= size) {
+		__m128i chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos)), sign);
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(chunk, needle)));
+		if (mask != 0xF) {
+			// The data is sorted, so the smaller elements are a prefix of the chunk.
+			return pos + __builtin_ctz(~mask);
+		}
+		pos += 4;
+	}
+#endif
+	while (pos < size && data[pos] < value) {
+		pos++;
+	}
+	return pos;
+}
+
+/**
+ * Advance pos to the first element of the sorted array that is greater
+ * than the value, comparing four elements at a time.
+ */
+inline size_t scanUpperBound(const uint32_t *data, size_t pos, size_t size, uint32_t value)
+{
+#ifdef __SSE2__
+	const __m128i sign = _mm_set1_epi32(0x80000000);
+	const __m128i needle = _mm_xor_si128(_mm_set1_epi32(value), sign);
+	while (pos + 4 <= size) {
+		__m128i chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos)), sign);
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(chunk, needle)));
+		if (mask != 0) {
+			return pos + __builtin_ctz(mask);
+		}
+		pos += 4;
+	}
+#endif
+	while (pos < size && data[pos] <= value) {
+		pos++;
+	}
+	return pos;
+}
+
+/**
+ * Advance pos to the first element of the sorted array that is not smaller
+ * than the value, using exponential steps followed by a binary search.
+ */
+inline size_t gallopLowerBound(const uint32_t *data, size_t pos, size_t size, uint32_t value)
+{
+	size_t lo = pos, hi = pos, step = 1;
+	while (hi < size && data[hi] < value) {
+		lo = hi + 1;
+		hi += step;
+		step *= 2;
+	}
+	return std::lower_bound(data + lo, data + std::min(hi, size), value) - data;
+}
+
+/**
+ * Keys per term above which intersectSorted() gallops over the keys instead
+ * of scanning them.
+ */
+const size_t INTERSECT_GALLOP_RATIO = 32;
+
+/**
+ * Find all elements of the sorted keys array that are equal to one of the
+ * sorted terms. Keys can repeat, each run of equal keys is reported as one
+ * match. A term that repeats only matches once.
+ *
+ * The matches array must have room for numTerms entries. Returns the number
+ * of matches found.
+ */
+inline size_t intersectSorted(const uint32_t *keys, size_t numKeys, const uint32_t *terms, size_t numTerms, IntersectMatch *matches)
+{
+	size_t numMatches = 0;
+	size_t pos = 0;
+	bool gallop = numKeys > numTerms * INTERSECT_GALLOP_RATIO;
+	for (size_t i = 0; i < numTerms && pos < numKeys; i++) {
+		uint32_t term = terms[i];
+		pos = gallop ? gallopLowerBound(keys, pos, numKeys, term) : scanLowerBound(keys, pos, numKeys, term);
+		if (pos < numKeys && keys[pos] == term) {
+			size_t end = scanUpperBound(keys, pos + 1, numKeys, term);
+			matches[numMatches++] = IntersectMatch { uint32_t(pos), uint32_t(end), uint32_t(i) };
+			pos = end;
+		}
+	}
+	return numMatches;
+}
+
+}
+
+#endif
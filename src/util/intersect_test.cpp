@@ -0,0 +1,78 @@
+// Copyright (C) 2011  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "util/intersect.h"
+
+using namespace Acoustid;
+
+TEST(IntersectTest, Bounds)
+{
+	uint32_t data[] = { 1, 3, 3, 3, 3, 3, 7, 0x80000000, 0xFFFFFFFF };
+	ASSERT_EQ(0, scanLowerBound(data, 0, 9, 0));
+	ASSERT_EQ(1, scanLowerBound(data, 0, 9, 3));
+	ASSERT_EQ(6, scanLowerBound(data, 0, 9, 4));
+	ASSERT_EQ(7, scanLowerBound(data, 0, 9, 8));
+	ASSERT_EQ(8, scanLowerBound(data, 0, 9, 0x80000001));
+	ASSERT_EQ(8, scanLowerBound(data, 0, 9, 0xFFFFFFFF));
+	ASSERT_EQ(6, scanUpperBound(data, 1, 9, 3));
+	ASSERT_EQ(8, scanUpperBound(data, 0, 9, 0x80000000));
+	ASSERT_EQ(9, scanUpperBound(data, 0, 9, 0xFFFFFFFF));
+	ASSERT_EQ(1, gallopLowerBound(data, 0, 9, 3));
+	ASSERT_EQ(6, gallopLowerBound(data, 2, 9, 4));
+	ASSERT_EQ(8, gallopLowerBound(data, 0, 9, 0xFFFFFFFF));
+	ASSERT_EQ(8, gallopLowerBound(data, 0, 8, 0xFFFFFFFF));
+}
+
+TEST(IntersectTest, IntersectSorted)
+{
+	uint32_t keys[] = { 1, 3, 3, 5, 8, 8, 8, 9 };
+	uint32_t terms[] = { 2, 3, 8, 8, 10 };
+	IntersectMatch matches[5];
+	ASSERT_EQ(2, intersectSorted(keys, 8, terms, 5, matches));
+	ASSERT_EQ(1, matches[0].begin);
+	ASSERT_EQ(3, matches[0].end);
+	ASSERT_EQ(1, matches[0].term);
+	ASSERT_EQ(4, matches[1].begin);
+	ASSERT_EQ(7, matches[1].end);
+	ASSERT_EQ(2, matches[1].term);
+}
+
+TEST(IntersectTest, IntersectSortedRandom)
+{
+	std::mt19937 rng(1234);
+	// Small and large key counts, so that both the scanning and the galloping path are used.
+	for (size_t numKeys : { 5, 50, 5000 }) {
+		for (int round = 0; round < 20; round++) {
+			std::vector<uint32_t> keys(numKeys), terms(8);
+			for (auto &key : keys) {
+				key = rng() % (numKeys * 2);
+			}
+			for (auto &term : terms) {
+				term = rng() % (numKeys * 2);
+			}
+			std::sort(keys.begin(), keys.end());
+			std::sort(terms.begin(), terms.end());
+			terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+
+			std::vector<IntersectMatch> matches(terms.size());
+			size_t numMatches = intersectSorted(keys.data(), keys.size(), terms.data(), terms.size(), matches.data());
+
+			size_t j = 0;
+			for (size_t i = 0; i < terms.size(); i++) {
+				auto range = std::equal_range(keys.begin(), keys.end(), terms[i]);
+				if (range.first == range.second) {
+					continue;
+				}
+				ASSERT_LT(j, numMatches);
+				ASSERT_EQ(i, matches[j].term);
+				ASSERT_EQ(range.first - keys.begin(), matches[j].begin);
+				ASSERT_EQ(range.second - keys.begin(), matches[j].end);
+				j++;
+			}
+			ASSERT_EQ(j, numMatches);
+		}
+	}
+}
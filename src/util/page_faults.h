@@ -0,0 +1,30 @@
+// Copyright (C) 2011  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_UTIL_PAGE_FAULTS_H_
+#define ACOUSTID_UTIL_PAGE_FAULTS_H_
+
+#include "common.h"
+#include <sys/resource.h>
+
+/**
+ * Number of major page faults (the ones that had to wait for the disk) of the
+ * calling thread so far. Falls back to the whole process where per-thread
+ * counts are not available.
+ */
+inline uint64_t majorPageFaults()
+{
+	struct rusage usage;
+#ifdef RUSAGE_THREAD
+	if (getrusage(RUSAGE_THREAD, &usage) != 0) {
+		return 0;
+	}
+#else
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#endif
+	return usage.ru_majflt;
+}
+
+#endif
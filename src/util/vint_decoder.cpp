@@ -0,0 +1,204 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include "vint_decoder.h"
+
+#include "vint.h"
+
+#ifdef ACOUSTID_HAVE_SSSE3_VINT_DECODER
+#include <tmmintrin.h>
+
+#include <map>
+#include <vector>
+#endif
+
+namespace Acoustid {
+
+ssize_t decodeVInt32ArrayScalar(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count) {
+    const uint8_t *ptr = input;
+    const uint8_t *end = input + inputSize;
+    for (size_t i = 0; i < count; i++) {
+        if (ptr >= end) {
+            return -1;
+        }
+        ssize_t size = readVInt32FromArray(ptr, &output[i]);
+        if (size < 0) {
+            return -1;
+        }
+        ptr += size;
+    }
+    if (ptr > end) {
+        return -1;
+    }
+    return ptr - input;
+}
+
+#ifdef ACOUSTID_HAVE_SSSE3_VINT_DECODER
+
+namespace {
+
+// For each combination of continuation bits in the next 12 input bytes,
+// this describes how many complete varints of up to 4 bytes they start with
+// (at most 4) and how to shuffle their bytes into 32-bit lanes. There are
+// only a few hundred distinct shuffle patterns, so they are stored separately
+// to keep the table small.
+struct VInt32ShuffleTable {
+    static const int WINDOW = 12;
+
+    // Sequences of 0-4 varints, each 1-4 bytes long.
+    static const int MAX_PATTERNS = 1 + 4 + 16 + 64 + 256;
+
+    struct Entry {
+        uint16_t pattern;
+        uint8_t count;
+        uint8_t consumed;
+    };
+
+    Entry entries[1 << WINDOW];
+    alignas(16) int8_t patterns[MAX_PATTERNS][16];
+
+    VInt32ShuffleTable() {
+        std::map<std::vector<int>, uint16_t> patternIndex;
+        for (int mask = 0; mask < (1 << WINDOW); mask++) {
+            std::vector<int> lengths;
+            int pos = 0;
+            while (lengths.size() < 4) {
+                int end = pos;
+                while (end < WINDOW && (mask & (1 << end))) {
+                    end++;
+                }
+                if (end >= WINDOW || end - pos >= 4) {
+                    break;
+                }
+                lengths.push_back(end - pos + 1);
+                pos = end + 1;
+            }
+            auto it = patternIndex.find(lengths);
+            if (it == patternIndex.end()) {
+                uint16_t index = patternIndex.size();
+                assert(index < MAX_PATTERNS);
+                int8_t *shuffle = patterns[index];
+                for (int i = 0; i < 16; i++) {
+                    shuffle[i] = -1;
+                }
+                int offset = 0;
+                for (size_t i = 0; i < lengths.size(); i++) {
+                    for (int j = 0; j < lengths[i]; j++) {
+                        shuffle[i * 4 + j] = offset++;
+                    }
+                }
+                it = patternIndex.insert(std::make_pair(lengths, index)).first;
+            }
+            Entry &entry = entries[mask];
+            entry.pattern = it->second;
+            entry.count = lengths.size();
+            entry.consumed = pos;
+        }
+    }
+};
+
+const VInt32ShuffleTable &shuffleTable() {
+    static const VInt32ShuffleTable table;
+    return table;
+}
+
+}  // namespace
+
+__attribute__((target("ssse3")))
+ssize_t decodeVInt32ArraySSSE3(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count) {
+    const VInt32ShuffleTable &table = shuffleTable();
+    const uint8_t *ptr = input;
+    const uint8_t *end = input + inputSize;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lowBits = _mm_set1_epi8(0x7F);
+    const __m128i mask1 = _mm_set1_epi32(0x0000007F);
+    const __m128i mask2 = _mm_set1_epi32(0x00003F80);
+    const __m128i mask3 = _mm_set1_epi32(0x001FC000);
+    const __m128i mask4 = _mm_set1_epi32(0x0FE00000);
+    size_t i = 0;
+    // Work on 64 byte chunks. The continuation bits of the whole chunk are
+    // extracted up front, so the position of the next varint only depends on
+    // the table lookup, not on loading the data.
+    while (i + 4 <= count && ptr + 48 <= end) {
+        uint64_t bits = 0;
+        for (int j = 0; j < 4; j++) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + j * 16));
+            bits |= uint64_t(uint16_t(_mm_movemask_epi8(chunk))) << (j * 16);
+        }
+        size_t offset = 0;
+        while (offset <= 48 && i + 4 <= count) {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + offset));
+            uint64_t mask = bits >> offset;
+            if ((mask & 0xFFFF) == 0 && i + 16 <= count) {
+                // 16 single byte varints, just widen them.
+                __m128i lo16 = _mm_unpacklo_epi8(data, zero);
+                __m128i hi16 = _mm_unpackhi_epi8(data, zero);
+                __m128i *out = reinterpret_cast<__m128i *>(&output[i]);
+                _mm_storeu_si128(out, _mm_unpacklo_epi16(lo16, zero));
+                _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo16, zero));
+                _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi16, zero));
+                _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi16, zero));
+                offset += 16;
+                i += 16;
+                continue;
+            }
+            const VInt32ShuffleTable::Entry &entry = table.entries[mask & 0xFFF];
+            if (entry.count == 0) {
+                break;
+            }
+            __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i *>(table.patterns[entry.pattern]));
+            __m128i bytes = _mm_and_si128(_mm_shuffle_epi8(data, shuffle), lowBits);
+            __m128i result = _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(bytes, mask1), _mm_and_si128(_mm_srli_epi32(bytes, 1), mask2)),
+                _mm_or_si128(_mm_and_si128(_mm_srli_epi32(bytes, 2), mask3),
+                             _mm_and_si128(_mm_srli_epi32(bytes, 3), mask4)));
+            // This writes four output values, even if fewer were decoded.
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&output[i]), result);
+            offset += entry.consumed;
+            i += entry.count;
+        }
+        ptr += offset;
+        if (offset == 0) {
+            // The next varint is longer than 4 bytes, this is rare.
+            ssize_t size = readVInt32FromArray(ptr, &output[i]);
+            if (size < 0) {
+                return -1;
+            }
+            ptr += size;
+            i++;
+        }
+    }
+    if (ptr > end) {
+        return -1;
+    }
+    ssize_t size = decodeVInt32ArrayScalar(ptr, end - ptr, &output[i], count - i);
+    if (size < 0) {
+        return -1;
+    }
+    return ptr + size - input;
+}
+
+#endif
+
+namespace {
+
+typedef ssize_t (*DecodeVInt32ArrayFunc)(const uint8_t *, size_t, uint32_t *, size_t);
+
+DecodeVInt32ArrayFunc selectDecodeVInt32ArrayImpl() {
+#ifdef ACOUSTID_HAVE_SSSE3_VINT_DECODER
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3")) {
+        return decodeVInt32ArraySSSE3;
+    }
+#endif
+    return decodeVInt32ArrayScalar;
+}
+
+}  // namespace
+
+ssize_t decodeVInt32Array(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count) {
+    static const DecodeVInt32ArrayFunc impl = selectDecodeVInt32ArrayImpl();
+    return impl(input, inputSize, output, count);
+}
+
+}  // namespace Acoustid
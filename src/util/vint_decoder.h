@@ -0,0 +1,36 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#ifndef ACOUSTID_UTIL_VINT_DECODER_H_
+#define ACOUSTID_UTIL_VINT_DECODER_H_
+
+#include "common.h"
+
+namespace Acoustid {
+
+// Number of bytes after the end of the input that the decoder is allowed to
+// read. The input buffer must be at least this much larger than the data.
+static const size_t kVInt32DecoderPadding = 16;
+
+// Decode `count` 32-bit varints from `input` into `output`.
+//
+// Returns the number of bytes consumed, or -1 if the input does not contain
+// `count` valid varints within `inputSize` bytes.
+//
+// Uses a SIMD implementation if the CPU supports it.
+ssize_t decodeVInt32Array(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count);
+
+// Portable implementation of decodeVInt32Array.
+ssize_t decodeVInt32ArrayScalar(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ACOUSTID_HAVE_SSSE3_VINT_DECODER 1
+
+// SSSE3 implementation of decodeVInt32Array, based on the Masked VByte
+// algorithm. Must only be called if the CPU supports SSSE3.
+ssize_t decodeVInt32ArraySSSE3(const uint8_t *input, size_t inputSize, uint32_t *output, size_t count);
+#endif
+
+}  // namespace Acoustid
+
+#endif  // ACOUSTID_UTIL_VINT_DECODER_H_
@@ -0,0 +1,97 @@
+// Copyright (C) 2021  Lukas Lalinsky
+// Distributed under the MIT license, see the LICENSE file for details.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "util/test_utils.h"
+#include "util/vint.h"
+#include "util/vint_decoder.h"
+
+using namespace Acoustid;
+
+namespace {
+
+std::vector<uint8_t> encode(const std::vector<uint32_t> &values) {
+    std::vector<uint8_t> data(values.size() * kMaxVInt32Bytes + kVInt32DecoderPadding);
+    size_t size = 0;
+    for (auto value : values) {
+        size += writeVInt32ToArray(&data[size], value);
+    }
+    data.resize(size + kVInt32DecoderPadding);
+    return data;
+}
+
+std::vector<uint32_t> generate(size_t count) {
+    std::vector<uint32_t> values;
+    uint32_t x = 12345;
+    for (size_t i = 0; i < count; i++) {
+        x = x * 1103515245 + 12345;
+        // Mix varints of all lengths, with short ones being the most common.
+        values.push_back(x >> (x % 32));
+    }
+    return values;
+}
+
+}  // namespace
+
+TEST(VIntDecoderTest, Scalar) {
+    auto values = generate(1000);
+    auto data = encode(values);
+    size_t size = data.size() - kVInt32DecoderPadding;
+    std::vector<uint32_t> output(values.size());
+    ASSERT_EQ(ssize_t(size), decodeVInt32ArrayScalar(data.data(), size, output.data(), output.size()));
+    ASSERT_INTARRAY_EQ(values, output, values.size());
+}
+
+TEST(VIntDecoderTest, Dispatch) {
+    for (size_t count = 0; count < 50; count++) {
+        auto values = generate(count);
+        auto data = encode(values);
+        size_t size = data.size() - kVInt32DecoderPadding;
+        std::vector<uint32_t> output(values.size());
+        ASSERT_EQ(ssize_t(size), decodeVInt32Array(data.data(), size, output.data(), output.size()));
+        ASSERT_INTARRAY_EQ(values, output, values.size());
+    }
+}
+
+TEST(VIntDecoderTest, Truncated) {
+    auto values = generate(100);
+    auto data = encode(values);
+    size_t size = data.size() - kVInt32DecoderPadding;
+    std::vector<uint32_t> output(values.size() + 1);
+    ASSERT_EQ(-1, decodeVInt32ArrayScalar(data.data(), size, output.data(), output.size()));
+    ASSERT_EQ(-1, decodeVInt32Array(data.data(), size, output.data(), output.size()));
+}
+
+#ifdef ACOUSTID_HAVE_SSSE3_VINT_DECODER
+TEST(VIntDecoderTest, SSSE3) {
+    if (!__builtin_cpu_supports("ssse3")) {
+        return;
+    }
+    for (size_t count : {1, 3, 4, 5, 8, 100, 1000}) {
+        auto values = generate(count);
+        auto data = encode(values);
+        size_t size = data.size() - kVInt32DecoderPadding;
+        std::vector<uint32_t> output(values.size());
+        ASSERT_EQ(ssize_t(size), decodeVInt32ArraySSSE3(data.data(), size, output.data(), output.size()));
+        ASSERT_INTARRAY_EQ(values, output, values.size());
+    }
+}
+
+TEST(VIntDecoderTest, SSSE3SmallValues) {
+    if (!__builtin_cpu_supports("ssse3")) {
+        return;
+    }
+    std::vector<uint32_t> values;
+    for (uint32_t i = 0; i < 300; i++) {
+        values.push_back(i % 3 == 0 && i < 100 ? i * 1000 : i % 100);
+    }
+    auto data = encode(values);
+    size_t size = data.size() - kVInt32DecoderPadding;
+    std::vector<uint32_t> output(values.size());
+    ASSERT_EQ(ssize_t(size), decodeVInt32ArraySSSE3(data.data(), size, output.data(), output.size()));
+    ASSERT_INTARRAY_EQ(values, output, values.size());
+}
+#endif